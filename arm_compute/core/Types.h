@@ -74,6 +74,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -2034,6 +2035,9 @@ class EmbeddingLayerInfo final
      * @param[in] d_segment     Sentence segmentation size
      * @param[in] d_position    Maximum sentence postion encoding length
      * @param[in] pretrained    If use pretained positional encoding
+     * @param[in] c_policy      Convert policy of the embedding sum
+     * @param[in] data_type     (Optional) Data type of the embedding tables and of the output. UNKNOWN follows a
+     *                          floating point input and falls back to F32 for integer ids
      * 
      */
     EmbeddingLayerInfo(unsigned int  d_model    = 512U,
@@ -2041,13 +2045,15 @@ class EmbeddingLayerInfo final
                        unsigned int  d_segment  = 2U,
                        unsigned int  d_position = 512U,
                        bool          pretrained = false,
-                       ConvertPolicy c_policy   = ConvertPolicy::SATURATE)
+                       ConvertPolicy c_policy   = ConvertPolicy::SATURATE,
+                       DataType      data_type  = DataType::UNKNOWN)
         : _d_model(d_model),
           _d_vocab(d_vocab),
           _d_segment(d_segment),
           _d_position(d_position),
           _pretrained(pretrained),
-          _c_policy(c_policy)
+          _c_policy(c_policy),
+          _data_type(data_type)
     {
     }
 
@@ -2081,6 +2087,12 @@ class EmbeddingLayerInfo final
         return _c_policy;
     }
 
+    /* Get data type of the embedding tables */
+    DataType data_type() const
+    {
+        return _data_type;
+    }
+
     private:
     unsigned int  _d_model;
     unsigned int  _d_vocab;
@@ -2088,6 +2100,15 @@ class EmbeddingLayerInfo final
     unsigned int  _d_position;
     bool          _pretrained;
     ConvertPolicy _c_policy;
+    DataType      _data_type;
+};
+
+/** Packed formats of the weights of a weight-only quantized linear layer */
+enum class WeightOnlyQuantization
+{
+    NONE, /**< Weights are kept in the data type of the input */
+    INT8, /**< Signed 8-bit weights, one scale per group of input features */
+    INT4  /**< Signed 4-bit weights packed two per byte, one scale per group of input features */
 };
 
 /** Linear Layer Information Class */
@@ -2097,13 +2118,19 @@ class LinearLayerInfo final
     /** Constructor
      * 
      * @param[in] d_d_linear_hidden Linear layer hidden depth
+     * @param[in] w_shape           Weight shape
+     * @param[in] b_shape           Bias shape
+     * @param[in] fuse_qkv          (Optional) Attention linear layer only, run the query, key and value projections
+     *                              as one GEMM over weights concatenated at prepare time
      */
     LinearLayerInfo(unsigned int d_linear_hidden = 2048U,
                     TensorShape  w_shape         = TensorShape(),
-                    TensorShape  b_shape         = TensorShape())
+                    TensorShape  b_shape         = TensorShape(),
+                    bool         fuse_qkv        = false)
         : _d_linear_hidden(d_linear_hidden),
           _w_shape(w_shape),
-          _b_shape(b_shape)
+          _b_shape(b_shape),
+          _fuse_qkv(fuse_qkv)
     {
     }
 
@@ -2125,10 +2152,181 @@ class LinearLayerInfo final
         return _b_shape;
     }
 
+    /** Whether query, key and value projections run as one fused GEMM */
+    bool fuse_qkv() const
+    {
+        return _fuse_qkv;
+    }
+
+    /** Whether F32 GEMMs may run on BF16 weights and dot products */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
+
+    /** Set fast math
+     *
+     * With F32 tensors the weights are converted once to BF16 when they are packed, the activations stay F32 and are
+     * rounded to BF16 inside the GEMM kernels. Ignored where no BF16 kernel is available.
+     *
+     * @param[in] fast_math Whether BF16 GEMMs may be used
+     */
+    void set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+    }
+
+    /** Whether the GEMM runs on dynamically quantized int8 operands */
+    bool dynamic_int8() const
+    {
+        return _dynamic_int8;
+    }
+
+    /** Set dynamic int8 quantization
+     *
+     * The F32 weights are quantized once to int8 with one scale per output channel, the activations are quantized at
+     * every run with one scale per row. The S32 accumulators are dequantized and the bias added in the output stage.
+     * Ignored where no int8 GEMM is available.
+     *
+     * @param[in] dynamic_int8 Whether int8 GEMMs may be used
+     */
+    void set_dynamic_int8(bool dynamic_int8)
+    {
+        _dynamic_int8 = dynamic_int8;
+    }
+
+    /** Packed format of the weights of single row GEMMs */
+    WeightOnlyQuantization weight_only_quantization() const
+    {
+        return _weight_only_quantization;
+    }
+
+    /** Number of consecutive input features sharing a weight scale */
+    unsigned int weight_group_size() const
+    {
+        return _weight_group_size;
+    }
+
+    /** Set weight-only quantization
+     *
+     * When the input has a single row, e.g. token by token decoding, the F32 weights are packed once to 8 or 4 bits
+     * with one scale per group of input features and dequantized in registers by a GEMV kernel. The input and output
+     * stay F32. Ignored for inputs of more than one row or where the number of input features is not a multiple of
+     * @p group_size.
+     *
+     * @param[in] quantization Packed format of the weights
+     * @param[in] group_size   (Optional) Number of consecutive input features sharing a scale, a multiple of 16
+     */
+    void set_weight_only_quantization(WeightOnlyQuantization quantization, unsigned int group_size = 32U)
+    {
+        _weight_only_quantization = quantization;
+        _weight_group_size        = group_size;
+    }
+
+    /** Activation applied to the output of the layer */
+    const ActivationLayerInfo &activation_info() const
+    {
+        return _act_info;
+    }
+
+    /** Set the fused activation
+     *
+     * The activation is applied together with the bias in the output stage of the GEMM, so the output is written
+     * once. Supported functions: RELU, BOUNDED_RELU, LU_BOUNDED_RELU and GELU.
+     *
+     * @param[in] act_info Activation to apply to the output
+     */
+    void set_activation_info(const ActivationLayerInfo &act_info)
+    {
+        _act_info = act_info;
+    }
+
+    /** Whether a fused GELU uses the tanh approximation */
+    bool approximate_gelu() const
+    {
+        return _approximate_gelu;
+    }
+
+    /** Set the GELU approximation
+     *
+     * A fused GELU computes 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) instead of the erf based
+     * definition. Cheaper, and the form GPT-2 was trained with.
+     *
+     * @param[in] approximate_gelu Whether a fused GELU uses the tanh approximation
+     */
+    void set_approximate_gelu(bool approximate_gelu)
+    {
+        _approximate_gelu = approximate_gelu;
+    }
+
     private:
     unsigned int _d_linear_hidden;
     TensorShape  _w_shape;
     TensorShape  _b_shape;
+    bool         _fuse_qkv;
+    bool         _fast_math{false};
+    bool         _dynamic_int8{false};
+
+    WeightOnlyQuantization _weight_only_quantization{WeightOnlyQuantization::NONE};
+    unsigned int           _weight_group_size{32U};
+    ActivationLayerInfo    _act_info{};
+    bool                   _approximate_gelu{false};
+};
+
+/** Vocabulary projection with top-k selection Information Class */
+class TopKProjectionLayerInfo final
+{
+    public:
+    /** Constructor
+     *
+     * @param[in] k       Number of best (id, score) pairs kept per projected row
+     * @param[in] w_shape Weight shape, (d_model, d_vocab)
+     * @param[in] b_shape Bias shape, (d_vocab)
+     * @param[in] rows    (Optional) Input rows to project, empty projects the last valid row only
+     */
+    TopKProjectionLayerInfo(unsigned int              k       = 1U,
+                            TensorShape               w_shape = TensorShape(),
+                            TensorShape               b_shape = TensorShape(),
+                            std::vector<unsigned int> rows    = {})
+        : _k(k), _w_shape(w_shape), _b_shape(b_shape), _rows(std::move(rows))
+    {
+    }
+
+    /** Get k */
+    unsigned int k() const
+    {
+        return _k;
+    }
+
+    /** Get _w_shape */
+    TensorShape w_shape() const
+    {
+        return _w_shape;
+    }
+
+    /** Get _b_shape */
+    TensorShape b_shape() const
+    {
+        return _b_shape;
+    }
+
+    /** Get the projected rows, empty for the last valid row */
+    const std::vector<unsigned int> &rows() const
+    {
+        return _rows;
+    }
+
+    /** Number of projected rows */
+    unsigned int num_rows() const
+    {
+        return _rows.empty() ? 1U : static_cast<unsigned int>(_rows.size());
+    }
+
+    private:
+    unsigned int              _k;
+    TensorShape               _w_shape;
+    TensorShape               _b_shape;
+    std::vector<unsigned int> _rows;
 };
 
 /** Layer Normalization Layer Information Class */
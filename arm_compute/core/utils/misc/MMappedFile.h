@@ -45,11 +45,13 @@ public:
      *
      * @note file will be created if it doesn't exist.
      *
-     * @param[in] filename File to be mapped, if doesn't exist will be created.
-     * @param[in] size     Size of file to map
-     * @param[in] offset   Offset to mapping point, should be multiple of page size
+     * @param[in] filename      File to be mapped, if doesn't exist will be created.
+     * @param[in] size          Size of file to map
+     * @param[in] offset        Offset to mapping point, should be multiple of page size
+     * @param[in] copy_on_write (Optional) Open the file read-only and keep writes to the mapping private to the process.
+     *                          The file is not created if it doesn't exist.
      */
-    MMappedFile(std::string filename, size_t size, size_t offset);
+    MMappedFile(std::string filename, size_t size, size_t offset, bool copy_on_write = false);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     MMappedFile(const MMappedFile &) = delete;
     /** Default move constructor */
@@ -64,13 +66,15 @@ public:
      *
      * @note file will be created if it doesn't exist.
      *
-     * @param[in] filename File to be mapped, if doesn't exist will be created.
-     * @param[in] size     Size of file to map. If 0 all the file will be mapped.
-     * @param[in] offset   Offset to mapping point, should be multiple of page size.
+     * @param[in] filename      File to be mapped, if doesn't exist will be created.
+     * @param[in] size          Size of file to map. If 0 all the file will be mapped.
+     * @param[in] offset        Offset to mapping point, should be multiple of page size.
+     * @param[in] copy_on_write (Optional) Open the file read-only and keep writes to the mapping private to the process.
+     *                          The file is not created if it doesn't exist.
      *
      * @return True if operation was successful else false
      */
-    bool map(const std::string &filename, size_t size, size_t offset);
+    bool map(const std::string &filename, size_t size, size_t offset, bool copy_on_write = false);
     /** Unmaps and closes file */
     void release();
     /** Mapped data accessor
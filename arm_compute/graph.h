@@ -33,7 +33,10 @@
 #include "arm_compute/graph/IGraphPrinter.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/KVCache.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SequenceBatch.h"
+#include "arm_compute/graph/SharedConstTensors.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/TypePrinter.h"
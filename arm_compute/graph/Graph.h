@@ -338,6 +338,15 @@ inline NodeID Graph::add_node(Target assigned_target, Ts &&...args)
     case NodeType::LayerNormLayer:
         std::cout << " LayerNormLayer" << std::endl;
         break;
+    case NodeType::AddLayerNormLayer:
+        std::cout << " AddLayerNormLayer" << std::endl;
+        break;
+    case NodeType::EmbeddingGatherSumLayer:
+        std::cout << " EmbeddingGatherSumLayer" << std::endl;
+        break;
+    case NodeType::TopKProjectionLayer:
+        std::cout << " TopKProjectionLayer" << std::endl;
+        break;
     case NodeType::EltwiseLayer:
         std::cout << " EltwiseLayer" << std::endl;
         break;
@@ -711,24 +711,56 @@ class GraphBuilder final
                                      ITensorAccessorUPtr vocabs   = nullptr,
                                      ITensorAccessorUPtr segments = nullptr,
                                      ITensorAccessorUPtr position = nullptr);
+    /** Adds a linear layer to the graph
+     *
+     * @param[in] g              Graph to add the node to
+     * @param[in] params         Common node parameters
+     * @param[in] input          Input to the linear layer node as a NodeID-Index pair
+     * @param[in] info           Linear layer parameters
+     * @param[in] ff_weights     Weights accessor
+     * @param[in] ff_bias        Bias accessor
+     * @param[in] fast_math_hint (Optional) Fast math hint, enabled lets F32 GEMMs run on BF16 weights
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
     static NodeID add_linear_node(Graph              &g,
                                   NodeParams          params,
                                   NodeIdxPair         input,
-                                  LinearLayerInfo     info       = LinearLayerInfo(),
-                                  ITensorAccessorUPtr ff_weights = nullptr,
-                                  ITensorAccessorUPtr ff_bias    = nullptr);
+                                  LinearLayerInfo     info           = LinearLayerInfo(),
+                                  ITensorAccessorUPtr ff_weights     = nullptr,
+                                  ITensorAccessorUPtr ff_bias        = nullptr,
+                                  FastMathHint        fast_math_hint = FastMathHint::Disabled);
+    /** Adds a vocabulary projection keeping only the best k tokens of the selected rows
+     *
+     * @param[in] g       Graph to add the node to
+     * @param[in] params  Common node parameters
+     * @param[in] input   Input to the projection node as a NodeID-Index pair
+     * @param[in] info    Top-k projection layer parameters
+     * @param[in] weights Projection weights accessor
+     * @param[in] bias    Projection bias accessor
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_topk_projection_node(Graph                  &g,
+                                           NodeParams              params,
+                                           NodeIdxPair             input,
+                                           TopKProjectionLayerInfo info,
+                                           ITensorAccessorUPtr     weights = nullptr,
+                                           ITensorAccessorUPtr     bias    = nullptr);
     /** Adds a linear layer computing Key, Value, Query to the graph
      *
      * @param[in] g             Graph to add the node to
      * @param[in] params        Common node parameters
      * @param[in] input         Input to the normalization layer node as a NodeID-Index pair
-     * @param[in] linear_info   Linear layer info
+     * @param[in] linear_info   Linear layer info. With @ref LinearLayerInfo::fuse_qkv() set the backend runs the three
+     *                          projections as a single GEMM over the concatenated weights
      * @param[in] query_weights Query weight
      * @param[in] query_bias    Query bias
      * @param[in] key_weights   Key weight
      * @param[in] key_bias      Key bias
      * @param[in] value_weights Value weight
      * @param[in] value_bias    Value bias
+     * @param[in] fast_math_hint (Optional) Fast math hint, enabled lets F32 GEMMs run on BF16 weights
      * 
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
@@ -739,7 +771,8 @@ class GraphBuilder final
                                              ITensorAccessorUPtr key_weights,
                                              ITensorAccessorUPtr key_bias,
                                              ITensorAccessorUPtr value_weights,
-                                             ITensorAccessorUPtr value_bias);
+                                             ITensorAccessorUPtr value_bias,
+                                             FastMathHint        fast_math_hint = FastMathHint::Disabled);
     /** Adds a multi-head attention layer to the graph
      *
      * @param[in] g         Graph to add the node to
@@ -756,10 +789,14 @@ class GraphBuilder final
      * @param[in] params  Common node parameters
      * @param[in] input   Input to the normalization layer node as a NodeID-Index pair
      * @param[in] info    Layer normalization infomation
+     * @param[in] gamma_accessor (Optional) Accessor of the per-channel gamma tensor, scalar gamma of @p info is used if nullptr
+     * @param[in] beta_accessor  (Optional) Accessor of the per-channel beta tensor, scalar beta of @p info is used if nullptr
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
-    static NodeID add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info);
+    static NodeID add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info,
+                                      ITensorAccessorUPtr gamma_accessor = nullptr,
+                                      ITensorAccessorUPtr beta_accessor  = nullptr);
 };
 } // namespace graph
 } // namespace arm_compute
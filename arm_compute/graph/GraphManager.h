@@ -72,6 +72,13 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Returns the execution profiler of a finalized graph
+     *
+     * @param[in] graph Graph to profile
+     *
+     * @return The workload profiler, can be enabled or disabled between runs
+     */
+    Profiler &profiler(Graph &graph);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -0,0 +1,71 @@
+#ifndef ARM_COMPUTE_GRAPH_KV_CACHE_H
+#define ARM_COMPUTE_GRAPH_KV_CACHE_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Key and value history of the attention layers, for incremental decoding
+ *
+ * A cache is shared by a prefill graph, that runs the prompt, and a decode graph with a sequence length of one, that
+ * runs one generated token per step. Every attention layer appends the key and value rows of its tokens and attends
+ * over all the rows held so far, so a decode step never recomputes the prefix. The number of held rows is the valid
+ * region of the cache tensors, the fused embedding reads it to place the new tokens.
+ */
+class KVCache final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] d_model   Width of the key and value rows
+     * @param[in] max_len   Largest number of tokens held, prompt included
+     * @param[in] data_type (Optional) Data type of the rows
+     */
+    KVCache(unsigned int d_model, unsigned int max_len, DataType data_type = DataType::F32);
+    /** Prevent instances of this class from being copied (As this class contains tensors) */
+    KVCache(const KVCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains tensors) */
+    KVCache &operator=(const KVCache &) = delete;
+    /** Number of tokens held */
+    unsigned int length() const;
+    /** Largest number of tokens held */
+    unsigned int max_length() const;
+    /** Drops the history, the next run starts a new sequence at position zero */
+    void reset();
+    /** Key history of an attention layer, allocated on first use
+     *
+     * @param[in] layer Index of the attention layer in graph order
+     *
+     * @return The key cache tensor
+     */
+    ITensor *key(unsigned int layer);
+    /** Value history of an attention layer, allocated on first use
+     *
+     * @param[in] layer Index of the attention layer in graph order
+     *
+     * @return The value cache tensor
+     */
+    ITensor *value(unsigned int layer);
+
+private:
+    struct Layer
+    {
+        arm_compute::Tensor key{};
+        arm_compute::Tensor value{};
+    };
+
+    Layer &layer(unsigned int index);
+
+    TensorInfo                          _info;
+    std::vector<std::unique_ptr<Layer>> _layers;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_KV_CACHE_H */
@@ -0,0 +1,109 @@
+#ifndef ARM_COMPUTE_GRAPH_PROFILER_H
+#define ARM_COMPUTE_GRAPH_PROFILER_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Per-node execution profiler of a graph workload
+ *
+ * Spans are written into a ring buffer allocated when profiling is enabled, so recording never allocates or
+ * touches files. Once the buffer is full the oldest spans are overwritten.
+ */
+class Profiler final
+{
+public:
+    /** Reserved slots for the stages of a graph run */
+    enum Slot : uint32_t
+    {
+        InputSlot  = 0, /**< Input accessors */
+        TasksSlot  = 1, /**< All tasks of a run */
+        OutputSlot = 2, /**< Output accessors */
+    };
+
+    /** Recorded span */
+    struct Record
+    {
+        uint32_t slot;     /**< Slot the span belongs to */
+        uint32_t run;      /**< Run the span belongs to */
+        int64_t  start_ns; /**< Start timestamp in nanoseconds */
+        int64_t  end_ns;   /**< End timestamp in nanoseconds */
+    };
+
+    /** Default constructor */
+    Profiler();
+    /** Enables profiling and preallocates the record buffer
+     *
+     * @param[in] capacity (Optional) Number of spans kept before the oldest ones are overwritten
+     */
+    void enable(size_t capacity = 1 << 16);
+    /** Disables profiling, recorded spans are kept until @ref clear */
+    void disable();
+    /** Whether spans are being recorded */
+    bool is_enabled() const
+    {
+        return _enabled;
+    }
+    /** Registers a slot, usually one per execution task
+     *
+     * @param[in] name   Name reported for the slot
+     * @param[in] target Target the slot runs on
+     *
+     * @return The slot index
+     */
+    uint32_t add_slot(std::string name, Target target);
+    /** Marks the start of a new graph run */
+    void begin_run();
+    /** Records a span, a no-op while profiling is disabled
+     *
+     * @param[in] slot     Slot of the span
+     * @param[in] start_ns Start timestamp returned by @ref now
+     * @param[in] end_ns   End timestamp returned by @ref now
+     */
+    void record(uint32_t slot, int64_t start_ns, int64_t end_ns);
+    /** Drops all recorded spans */
+    void clear();
+    /** Monotonic timestamp in nanoseconds */
+    static int64_t now();
+    /** Recorded spans from the oldest to the newest */
+    std::vector<Record> records() const;
+    /** Writes the spans in Chrome trace event format, one track per target
+     *
+     * @param[in] filename Output JSON file
+     */
+    void export_chrome_trace(const std::string &filename) const;
+    /** Writes the spans as CSV (run,name,target,start_us,duration_us)
+     *
+     * @param[in] filename Output CSV file
+     */
+    void export_csv(const std::string &filename) const;
+    /** Prints per-slot count, mean, p50 and p99 of the span durations over the recorded runs
+     *
+     * @param[out] os Output stream
+     */
+    void print_summary(std::ostream &os) const;
+
+private:
+    struct SlotInfo
+    {
+        std::string name;
+        Target      target;
+    };
+
+    bool                  _enabled;
+    uint32_t              _run;
+    size_t                _next;
+    size_t                _count;
+    std::vector<Record>   _buffer;
+    std::vector<SlotInfo> _slots;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_PROFILER_H */
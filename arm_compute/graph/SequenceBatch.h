@@ -0,0 +1,52 @@
+#ifndef ARM_COMPUTE_GRAPH_SEQUENCE_BATCH_H
+#define ARM_COMPUTE_GRAPH_SEQUENCE_BATCH_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Valid lengths of the sequences of a batched graph
+ *
+ * A batched graph takes ids shaped (max_len, batch_size), one padded sequence per column, and flattens them into
+ * max_len * batch_size hidden rows, so the row-wise layers run one GEMM over the whole batch. The attention layers
+ * read the lengths to keep every sequence on its own rows: padded tokens neither attend nor are attended to.
+ */
+class SequenceBatch final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] batch_size Number of sequences
+     * @param[in] max_len    Padded length of every sequence
+     */
+    SequenceBatch(unsigned int batch_size, unsigned int max_len);
+    /** Prevent instances of this class from being copied (As this class contains tensors) */
+    SequenceBatch(const SequenceBatch &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains tensors) */
+    SequenceBatch &operator=(const SequenceBatch &) = delete;
+    /** Number of sequences */
+    unsigned int batch_size() const;
+    /** Padded length of every sequence */
+    unsigned int max_length() const;
+    /** Sets the valid lengths for the next runs
+     *
+     * Lengths are clamped to @ref max_length, sequences past the given lengths are empty.
+     *
+     * @param[in] lengths Valid length of each sequence
+     */
+    void set_lengths(const std::vector<unsigned int> &lengths);
+    /** Valid lengths as a U32 tensor of shape (batch_size) */
+    ITensor *lengths();
+
+private:
+    arm_compute::Tensor _lengths;
+    unsigned int        _max_len;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_SEQUENCE_BATCH_H */
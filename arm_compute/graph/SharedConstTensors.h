@@ -0,0 +1,81 @@
+#ifndef ARM_COMPUTE_GRAPH_SHARED_CONST_TENSORS_H
+#define ARM_COMPUTE_GRAPH_SHARED_CONST_TENSORS_H
+
+#include "arm_compute/graph/TensorDescriptor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class IWeightsManager;
+
+namespace graph
+{
+// Forward declarations
+class ITensorHandle;
+
+/** Const tensors shared by graphs built with the same topology
+ *
+ * The first graph finalized with the pool registers its const tensors in node creation order. Graphs finalized after
+ * it alias the registered tensor of the same shape, data type and target instead of allocating and loading their own,
+ * e.g. the sequence length buckets of one model. Shared tensors are never released after preparation, and the graph
+ * that registered them must outlive the graphs aliasing them.
+ *
+ * The graphs also share one NEON weights manager, so functions reading the same shared weights reuse the reshaped
+ * copy of the first graph instead of packing their own.
+ */
+class SharedConstTensors final
+{
+public:
+    /** Default constructor */
+    SharedConstTensors() = default;
+    /** Prevent instances of this class from being copied (As this class refers to tensors of a graph) */
+    SharedConstTensors(const SharedConstTensors &) = delete;
+    /** Prevent instances of this class from being copied (As this class refers to tensors of a graph) */
+    SharedConstTensors &operator=(const SharedConstTensors &) = delete;
+    /** Number of registered const tensors */
+    size_t size() const;
+    /** Registers the next const tensor
+     *
+     * @param[in] handle Backend handle of the tensor, nullptr keeps the slot unshared
+     * @param[in] desc   Descriptor of the tensor
+     */
+    void add(ITensorHandle *handle, const TensorDescriptor &desc);
+    /** Registered tensor a const tensor can alias
+     *
+     * @param[in] index Index of the const tensor in node creation order
+     * @param[in] desc  Descriptor of the const tensor
+     *
+     * @return The registered handle, nullptr if there is none or its descriptor does not match
+     */
+    ITensorHandle *find(size_t index, const TensorDescriptor &desc) const;
+    /** Checks if a handle is one of the registered tensors
+     *
+     * @param[in] handle Handle to look for
+     *
+     * @return True if the handle is registered
+     */
+    bool contains(const ITensorHandle *handle) const;
+    /** Weights manager shared by the graphs, nullptr until the first graph sets it */
+    std::shared_ptr<IWeightsManager> weights_manager() const;
+    /** Sets the weights manager shared by the graphs
+     *
+     * @param[in] wm Weights manager of the first graph
+     */
+    void set_weights_manager(std::shared_ptr<IWeightsManager> wm);
+
+private:
+    struct Entry
+    {
+        ITensorHandle   *handle;
+        TensorDescriptor desc;
+    };
+
+    std::vector<Entry>               _entries{};
+    std::shared_ptr<IWeightsManager> _weights_manager{ nullptr };
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_SHARED_CONST_TENSORS_H */
@@ -200,6 +200,18 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::Dummy:
             os << "Dummy";
             break;
+        case NodeType::LayerNormLayer:
+            os << "LayerNormLayer";
+            break;
+        case NodeType::AddLayerNormLayer:
+            os << "AddLayerNormLayer";
+            break;
+        case NodeType::EmbeddingGatherSumLayer:
+            os << "EmbeddingGatherSumLayer";
+            break;
+        case NodeType::TopKProjectionLayer:
+            os << "TopKProjectionLayer";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
@@ -35,6 +35,7 @@
 #include "arm_compute/runtime/CL/CLTypes.h"
 
 #include <limits>
+#include <memory>
 #include <string>
 
 namespace arm_compute
@@ -82,6 +83,9 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 
 // Forward declarations
 struct TensorDescriptor;
+class KVCache;
+class SharedConstTensors;
+class SequenceBatch;
 
 /** Graph configuration structure */
 struct GraphConfig
@@ -98,6 +102,17 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    std::string   placement_cost_file{};               /**< Cost table used to place nodes automatically when switching, empty keeps the assigned targets */
+    bool          enable_profiling{false};             /**< Record per-node execution spans in the workload profiler */
+    std::shared_ptr<KVCache> kv_cache{nullptr};        /**< Key/value history the attention layers append to, shared by the prefill and decode graphs */
+    bool          overlap_devices{true};               /**< Order the tasks of a switching graph so that host nodes run while CL work is in flight */
+    std::shared_ptr<SharedConstTensors> shared_consts{nullptr}; /**< Const tensors shared with graphs of the same topology, e.g. sequence length buckets */
+    std::shared_ptr<SequenceBatch> sequence_batch{nullptr}; /**< Valid lengths of the sequences when the ids hold a batch of padded sequences */
+    std::string   packed_weights_dir{};                /**< Directory caching the reshaped weights of the NEON linear layers across runs, empty disables it */
+    bool          dynamic_int8_linear{false};          /**< Run the F32 NEON linear layers as int8 GEMMs on per-channel quantized weights and per-row quantized inputs */
+    WeightOnlyQuantization weight_only_linear{WeightOnlyQuantization::NONE}; /**< Pack the weights of the F32 NEON linear layers to 8 or 4 bits for single-row inputs */
+    unsigned int  weight_group_size{32U};              /**< Number of input features sharing a scale in the weight-only packed weights */
+    bool          approximate_gelu{false};             /**< Compute the GELU fused into the NEON linear layers with the tanh approximation */
 };
 
 /**< Device target types */
@@ -209,7 +224,10 @@ enum class NodeType
     LinearLayer,
     AttentionLinearLayer,
     ScaleDotProductionAttentionLayer,
-    LayerNormLayer
+    LayerNormLayer,
+    AddLayerNormLayer,
+    EmbeddingGatherSumLayer,
+    TopKProjectionLayer
 };
 
 /** Backend Memory Manager affinity **/
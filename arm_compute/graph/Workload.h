@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_GRAPH_WORKLOAD_H
 
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Profiler.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
@@ -83,8 +84,10 @@ struct ExecutionTask
     /** Default destructor */
     ~ExecutionTask() = default;
     // TODO (geopin01) : Support vector of functions?
-    std::unique_ptr<arm_compute::IFunction> task = {}; /**< Task to execute */
-    INode                                  *node = {}; /**< Node bound to this workload */
+    std::unique_ptr<arm_compute::IFunction> task                = {}; /**< Task to execute */
+    INode                                  *node                = {}; /**< Node bound to this workload */
+    std::vector<ITensorHandle *>            host_mapped_handles = {}; /**< CL handles the task accesses from the host */
+    uint32_t                                profile_slot        = {}; /**< Profiler slot of the task */
 
     /** Function operator */
     void operator()();
@@ -96,11 +99,13 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};        /**< Input handles */
-    std::vector<Tensor *>      outputs = {};        /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
-    Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
-    GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    std::vector<Tensor *>        inputs         = {};        /**< Input handles */
+    std::vector<Tensor *>        outputs        = {};        /**< Output handles */
+    std::vector<ExecutionTask>   tasks          = {};        /**< Execution workload */
+    Graph                       *graph          = {nullptr}; /**< Graph bound to the workload */
+    GraphContext                *ctx            = {nullptr}; /**< Graph execution context */
+    std::vector<ITensorHandle *> mapped_handles = {};        /**< CL handles currently mapped to the host */
+    Profiler                     profiler       = {};        /**< Per-task execution profiler */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -49,6 +49,18 @@ std::vector<NodeID> bfs(Graph &g);
  * @return A vector with the node id traversal order
  */
 std::vector<NodeID> dfs(Graph &g);
+/** Reorders a traversal so that host work overlaps in-flight device work
+ *
+ * CL nodes only enqueue work, so they are issued as soon as their inputs are issued. Ready NEON nodes that do not
+ * touch CL tensors then run while the device is busy. NEON nodes that map CL tensors wait for the queue, so they are
+ * deferred until no other host work is ready. Ties keep the order of @p order.
+ *
+ * @param g     Graph to traverse
+ * @param order Valid traversal of @p g, e.g. returned by @ref dfs
+ *
+ * @return A vector with the node id traversal order
+ */
+std::vector<NodeID> device_overlap_sort(Graph &g, const std::vector<NodeID> &order);
 } // namespace graph
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H */
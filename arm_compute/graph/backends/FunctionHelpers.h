@@ -27,7 +27,9 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/graph/KVCache.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SequenceBatch.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Types.h"
@@ -1809,6 +1811,7 @@ std::unique_ptr<IFunction> create_position_embedding_layer(PositionEmbeddingLaye
     typename TargetInfo::TensorType *input    = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *position = get_backing_tensor<TargetInfo>(node.input(1));
     typename TargetInfo::TensorType *output   = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->dimension(1) > 1, "Batched sequences are only supported by the fused NEON embedding");
 
     // Create function
     auto func = std::make_unique<PositionEmbeddingLayerFunction>();
@@ -1851,11 +1854,12 @@ std::unique_ptr<IFunction> create_embedding_sum_layer(EmbeddingSumLayerNode &nod
  * @tparam TargetInfo           Target-specific information
  *
  * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
  *
  * @return Backend linear layer function
  */
 template <typename LinearLayerFunction, typename TargetInfo>
-std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node)
+std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node, GraphContext &ctx)
 {
     validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
 
@@ -1864,10 +1868,15 @@ std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node)
     ITensor              *weight      = get_backing_tensor_from_TensorType<ITensor>(node.input(1));
     ITensor              *bias        = get_backing_tensor_from_TensorType<ITensor>(node.input(2));
     ITensor              *output      = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
-    const LinearLayerInfo linear_info = node.linear_info();
+    LinearLayerInfo       linear_info = node.linear_info();
+    linear_info.set_dynamic_int8(ctx.config().dynamic_int8_linear);
+    linear_info.set_weight_only_quantization(ctx.config().weight_only_linear, ctx.config().weight_group_size);
+    linear_info.set_approximate_gelu(ctx.config().approximate_gelu);
 
     // Create function
-    auto func = std::make_unique<LinearLayerFunction>();
+    auto wm   = get_weights_manager(ctx, TargetInfo::TargetType);
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<LinearLayerFunction>(mm, wm.get());
     func->configure(input, weight, bias, output, linear_info);
 
     ARM_COMPUTE_LOG_GRAPH_INFO(
@@ -1893,11 +1902,12 @@ static struct recurrence_attention_linear
  * @tparam TargetInfo                       Target-specific information
  *
  * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
  *
  * @return Backend attention linear function
  */
 template <typename AttentionLinearLayerFunction, typename TargetInfo>
-std::unique_ptr<IFunction> create_attention_linear_layer(AttentionLinearNode &node)
+std::unique_ptr<IFunction> create_attention_linear_layer(AttentionLinearNode &node, GraphContext &ctx)
 {
     validate_node<TargetInfo>(node, 9 /* expected inputs */, 3 /* expected outputs */);
 
@@ -1915,7 +1925,9 @@ std::unique_ptr<IFunction> create_attention_linear_layer(AttentionLinearNode &no
     ITensor              *query_output = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
     ITensor              *key_output   = get_backing_tensor_from_TensorType<ITensor>(node.output(1));
     ITensor              *value_output = get_backing_tensor_from_TensorType<ITensor>(node.output(2));
-    const LinearLayerInfo linear_info  = node.linear_info();
+    LinearLayerInfo       linear_info  = node.linear_info();
+    linear_info.set_dynamic_int8(ctx.config().dynamic_int8_linear);
+    linear_info.set_weight_only_quantization(ctx.config().weight_only_linear, ctx.config().weight_group_size);
 
     if(attention_linear_recurrence.recurrence_count == 0)
     {
@@ -1930,7 +1942,9 @@ std::unique_ptr<IFunction> create_attention_linear_layer(AttentionLinearNode &no
     std::cout << "value_output id: " <<attention_linear_recurrence.value_output->info()->id() << std::endl;
 
     // Create and configure function
-    auto func = std::make_unique<AttentionLinearLayerFunction>();
+    auto wm   = get_weights_manager(ctx, TargetInfo::TargetType);
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<AttentionLinearLayerFunction>(mm, wm.get());
     func->configure(query_input, query_w, query_b,
                     key_input, key_w, key_b,
                     value_input, value_w, value_b,
@@ -1986,14 +2000,27 @@ std::unique_ptr<IFunction> create_attention_linear_layer(AttentionLinearNode &no
     return func;
 }*/
 
-static struct recurrence_sdpa
+/** Index of an attention node among the attention nodes of its graph, in node order
+ *
+ * Graphs built by the same code number their attention layers identically, so a prefill graph and a decode graph
+ * sharing a @ref KVCache pick the same cache for the same layer.
+ *
+ * @param[in] node Attention node
+ *
+ * @return The attention layer index
+ */
+inline unsigned int attention_layer_index(const ScaleDotProductionAttentionNode &node)
 {
-    unsigned int recurrence_count = 0;
-    ITensor     *query            = nullptr;
-    ITensor     *key              = nullptr;
-    ITensor     *value            = nullptr;
-    ITensor     *output           = nullptr;
-} sdpa_recurrence;
+    unsigned int index = 0;
+    for(const auto &n : node.graph()->nodes())
+    {
+        if(n != nullptr && n->type() == NodeType::ScaleDotProductionAttentionLayer && n->id() < node.id())
+        {
+            ++index;
+        }
+    }
+    return index;
+}
 
 /** Creates a backend scale dot production function
  *
@@ -2001,14 +2028,22 @@ static struct recurrence_sdpa
  * @tparam TargetInfo                       Target-specific information
  *
  * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
  *
  * @return Backend simple forwardlayer function
  */
 template <typename ScaleDotProductionLayerFunction, typename TargetInfo>
-std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionAttentionNode &node)
+std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionAttentionNode &node, GraphContext &ctx)
 {
     validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
-    std::cout << "recurrent: " << sdpa_recurrence.recurrence_count << std::endl;
+    if(ctx.config().kv_cache != nullptr)
+    {
+        ARM_COMPUTE_ERROR("KV cache decoding is only supported by NEON attention");
+    }
+    if(ctx.config().sequence_batch != nullptr)
+    {
+        ARM_COMPUTE_ERROR("Batched sequences are only supported by NEON attention");
+    }
 
     // Extract IO and info
     typename TargetInfo::TensorType *query  = get_backing_tensor<TargetInfo>(node.input(0));
@@ -2016,30 +2051,15 @@ std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionA
     typename TargetInfo::TensorType *value  = get_backing_tensor<TargetInfo>(node.input(2));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
 
-    if(sdpa_recurrence.recurrence_count == 0)
-    {
-        sdpa_recurrence.query = query;
-        sdpa_recurrence.key = key;
-        sdpa_recurrence.value = value;
-        sdpa_recurrence.output = output;
-    }
-
-
-    std::cout << "query id: " << sdpa_recurrence.query->info()->id() << std::endl;
-    std::cout << "key id: " << sdpa_recurrence.key->info()->id() << std::endl;
-    std::cout << "value id: " <<sdpa_recurrence.value->info()->id() << std::endl;
-    std::cout << "output id: " << sdpa_recurrence.output->info()->id() << std::endl;
-
     // Create and configure function
     auto func = std::make_unique<ScaleDotProductionLayerFunction>();
-    func->configure(sdpa_recurrence.query, sdpa_recurrence.key, sdpa_recurrence.value, sdpa_recurrence.output, node.sdpa_info(),sdpa_recurrence.recurrence_count);
+    func->configure(query, key, value, output, node.sdpa_info(), attention_layer_index(node));
 
     // Log info
     ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
-                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
-                                               << " Input shape: " << input->info()->tensor_shape()
+                                               << TargetInfo::TargetType << " Data Type: " << query->info()->data_type()
+                                               << " Query shape: " << query->info()->tensor_shape()
                                                << " Output shape: " << output->info()->tensor_shape() << std::endl);
-    sdpa_recurrence.recurrence_count++;
 
     return func;
 }
@@ -2056,10 +2076,12 @@ std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionA
 template <typename LayerNormLayerFunction, typename TargetInfo>
 std::unique_ptr<IFunction> create_layer_norm_layer(LayerNormNode &node)
 {
-    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
 
-    // Extract IO and info
+    // Extract IO and info, gamma and beta are optional
     ITensor *input  = get_backing_tensor_from_TensorType<ITensor>(node.input(0));
+    ITensor *gamma  = get_backing_tensor_from_TensorType<ITensor>(node.input(1));
+    ITensor *beta   = get_backing_tensor_from_TensorType<ITensor>(node.input(2));
     ITensor *output = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
 
     ARM_COMPUTE_ERROR_ON(input == nullptr);
@@ -2067,17 +2089,130 @@ std::unique_ptr<IFunction> create_layer_norm_layer(LayerNormNode &node)
 
     // Create and configure function
     auto func = std::make_unique<LayerNormLayerFunction>();
-    func->configure(input, output, node.layer_norm_info());
+    func->configure(input, gamma, beta, output, node.layer_norm_info());
 
     // Log info
     ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
                                                << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
                                                << " Input shape: " << input->info()->tensor_shape()
+                                               << " Per-channel gamma/beta: " << (gamma != nullptr)
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
+/** Create a backend fused residual add + layer normalization function
+ *
+ * @tparam AddLayerNormLayerFunction Backend fused add + layer normalization function
+ * @tparam TargetInfo                Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused add + layer normalization function
+ */
+template <typename AddLayerNormLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_add_layer_norm_layer(AddLayerNormNode &node)
+{
+    validate_node<TargetInfo>(node, 4 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info, gamma and beta are optional
+    ITensor *input0 = get_backing_tensor_from_TensorType<ITensor>(node.input(0));
+    ITensor *input1 = get_backing_tensor_from_TensorType<ITensor>(node.input(1));
+    ITensor *gamma  = get_backing_tensor_from_TensorType<ITensor>(node.input(2));
+    ITensor *beta   = get_backing_tensor_from_TensorType<ITensor>(node.input(3));
+    ITensor *output = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
+
+    ARM_COMPUTE_ERROR_ON(input0 == nullptr);
+    ARM_COMPUTE_ERROR_ON(input1 == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<AddLayerNormLayerFunction>();
+    func->configure(input0, input1, gamma, beta, output, node.layer_norm_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input0->info()->data_type()
+                                               << " Input shape: " << input0->info()->tensor_shape()
+                                               << " Per-channel gamma/beta: " << (gamma != nullptr)
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
+/** Create a backend fused embedding gather and sum function
+ *
+ * @tparam EmbeddingGatherSumLayerFunction Backend fused embedding function
+ * @tparam TargetInfo                      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused embedding gather and sum function
+ */
+template <typename EmbeddingGatherSumLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_embedding_gather_sum_layer(EmbeddingGatherSumNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    ITensor *tokens         = get_backing_tensor_from_TensorType<ITensor>(node.input(0));
+    ITensor *segments       = get_backing_tensor_from_TensorType<ITensor>(node.input(1));
+    ITensor *vocab          = get_backing_tensor_from_TensorType<ITensor>(node.input(2));
+    ITensor *segment_table  = get_backing_tensor_from_TensorType<ITensor>(node.input(3));
+    ITensor *position_table = get_backing_tensor_from_TensorType<ITensor>(node.input(4));
+    ITensor *output         = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
+
+    // Create and configure function
+    auto func = std::make_unique<EmbeddingGatherSumLayerFunction>();
+    // While decoding, the tokens sit after the history held by the first attention layer
+    const ITensor *history = (ctx.config().kv_cache != nullptr) ? ctx.config().kv_cache->key(0) : nullptr;
+    func->configure(tokens, segments, vocab, segment_table, position_table, output, node.embedding_info(), history);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << vocab->info()->data_type()
+                                               << " Tokens shape: " << tokens->info()->tensor_shape()
                                                << " Output shape: " << output->info()->tensor_shape() << std::endl);
 
     return func;
 }
 
+/** Create a backend vocabulary projection function with a fused top-k
+ *
+ * @tparam TopKProjectionLayerFunction Backend top-k projection function
+ * @tparam TargetInfo                  Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend top-k projection function
+ */
+template <typename TopKProjectionLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_topk_projection_layer(TopKProjectionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    ITensor *input   = get_backing_tensor_from_TensorType<ITensor>(node.input(0));
+    ITensor *weights = get_backing_tensor_from_TensorType<ITensor>(node.input(1));
+    ITensor *bias    = get_backing_tensor_from_TensorType<ITensor>(node.input(2));
+    ITensor *output  = get_backing_tensor_from_TensorType<ITensor>(node.output(0));
+
+    // Create and configure function
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<TopKProjectionLayerFunction>(mm);
+    func->configure(input, weights, bias, output, node.topk_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
+                                               << " Input shape: " << input->info()->tensor_shape()
+                                               << " k: " << node.topk_info().k() << std::endl);
+
+    return func;
+}
+
 } // namespace detail
 } // namespace backends
 } // namespace graph
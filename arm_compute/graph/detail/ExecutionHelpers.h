@@ -36,6 +36,7 @@ class GraphContext;
 struct ExecutionWorkload;
 class Tensor;
 class INode;
+class SharedConstTensors;
 
 namespace detail
 {
@@ -49,6 +50,12 @@ void validate_all_nodes(Graph &g);
  * @param[in] g Graph to configure
  */
 void configure_all_tensors(Graph &g);
+/** Aliases the const tensors of a graph to the ones registered in a pool, or registers them
+ *
+ * @param[in]     g      Graph whose const tensor handles are configured
+ * @param[in,out] shared Pool of const tensors shared by graphs of the same topology
+ */
+void share_const_tensors(Graph &g, SharedConstTensors &shared);
 /** Allocates all input tensors of a node.
  *
  * @param[in] node Node to allocate the input tensor of
@@ -80,9 +87,10 @@ void allocate_all_tensors(Graph &g);
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
 /** Release the memory of all unused const nodes
  *
- * @param[in] g Graph to release the memory from
+ * @param[in] g      Graph to release the memory from
+ * @param[in] shared (Optional) Const tensors shared with other graphs, these are kept
  */
-void release_unused_tensors(Graph &g);
+void release_unused_tensors(Graph &g, const SharedConstTensors *shared = nullptr);
 /** Calls accessor of a given tensor
  *
  * @param[in] tensor The tensor of which the accessor should be called
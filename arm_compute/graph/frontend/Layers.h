@@ -1574,7 +1574,8 @@ class LinearLayer final : public ILayer
         NodeIdxPair input         = { s.tail_node(), 0 };
         common_params.target      = assigned_target();
 
-        return GraphBuilder::add_linear_node(s.graph(), common_params, input, _info, std::move(_ff_weights), std::move(_ff_bias));
+        return GraphBuilder::add_linear_node(s.graph(), common_params, input, _info, std::move(_ff_weights), std::move(_ff_bias),
+                                             s.hints().fast_math_hint);
     }
 
     private:
@@ -1583,6 +1584,40 @@ class LinearLayer final : public ILayer
     ITensorAccessorUPtr _ff_bias;
 };
 
+/** Vocabulary projection of the selected rows with a fused top-k */
+class TopKProjectionLayer final : public ILayer
+{
+    public:
+    /** Construct a top-k projection layer.
+     *
+     * @param[in] info    Top-k projection layer information
+     * @param[in] weights Projection weights accessor
+     * @param[in] bias    Projection bias accessor
+     */
+    TopKProjectionLayer(TopKProjectionLayerInfo info,
+                        ITensorAccessorUPtr     weights,
+                        ITensorAccessorUPtr     bias)
+        : _info(std::move(info)),
+          _weights(std::move(weights)),
+          _bias(std::move(bias))
+    {
+    }
+
+    NodeID create_layer(IStream &s) override
+    {
+        NodeParams  common_params = { name(), s.hints().target_hint };
+        NodeIdxPair input         = { s.tail_node(), 0 };
+        common_params.target      = assigned_target();
+
+        return GraphBuilder::add_topk_projection_node(s.graph(), common_params, input, _info, std::move(_weights), std::move(_bias));
+    }
+
+    private:
+    TopKProjectionLayerInfo _info;
+    ITensorAccessorUPtr     _weights;
+    ITensorAccessorUPtr     _bias;
+};
+
 /** Multi Head Linear Layer */
 class AttentionLinearLayer final : public ILayer
 {
@@ -1618,7 +1653,8 @@ class AttentionLinearLayer final : public ILayer
                                                         std::move(_key_weights),
                                                         std::move(_key_bias),
                                                         std::move(_value_weights),
-                                                        std::move(_value_bias));
+                                                        std::move(_value_bias),
+                                                        s.hints().fast_math_hint);
     }
 
     private:
@@ -1662,9 +1698,12 @@ class LayerNormLayer final : public ILayer
     public:
     /** Construct a layer norm layer.
      *
+     * @param[in] info  Layer normalization information
+     * @param[in] gamma (Optional) Accessor of the per-channel gamma values, scalar gamma of @p info is used if nullptr
+     * @param[in] beta  (Optional) Accessor of the per-channel beta values, scalar beta of @p info is used if nullptr
      */
-    LayerNormLayer(LayerNormLayerInfo info)
-        : _info(info)
+    LayerNormLayer(LayerNormLayerInfo info, ITensorAccessorUPtr gamma = nullptr, ITensorAccessorUPtr beta = nullptr)
+        : _info(info), _gamma(std::move(gamma)), _beta(std::move(beta))
     {
     }
 
@@ -1674,11 +1713,13 @@ class LayerNormLayer final : public ILayer
         NodeIdxPair input         = { s.tail_node(), 0 };
         common_params.target      = assigned_target();
 
-        return GraphBuilder::add_layer_norm_node(s.graph(), common_params, input, _info);
+        return GraphBuilder::add_layer_norm_node(s.graph(), common_params, input, _info, std::move(_gamma), std::move(_beta));
     }
 
     private:
-    LayerNormLayerInfo _info;
+    LayerNormLayerInfo  _info;
+    ITensorAccessorUPtr _gamma;
+    ITensorAccessorUPtr _beta;
 };
 
 } // namespace frontend
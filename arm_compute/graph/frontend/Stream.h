@@ -62,6 +62,8 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Returns the execution profiler of the finalized stream */
+    Profiler &profiler();
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
@@ -0,0 +1,62 @@
+#ifndef ARM_COMPUTE_GRAPH_DEVICE_PLACEMENT_MUTATOR_H
+#define ARM_COMPUTE_GRAPH_DEVICE_PLACEMENT_MUTATOR_H
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Per-node execution costs on each backend and the cost of moving a tensor between them */
+struct DeviceCostTable
+{
+    /** Execution cost of a node on each backend */
+    struct NodeCost
+    {
+        double neon{-1.f}; /**< Cost on NEON in seconds, negative if unsupported */
+        double cl{-1.f};   /**< Cost on CL in seconds, negative if unsupported */
+    };
+
+    std::map<std::string, NodeCost> nodes{};               /**< Node costs keyed by node name, repeated layers share an entry */
+    double                          transfer_latency{0.f};  /**< Fixed cost of a device boundary in seconds */
+    double                          transfer_per_byte{0.f}; /**< Cost of a device boundary per tensor byte in seconds */
+};
+
+/** Loads a persisted cost table
+ *
+ * Each line holds "name,neon_seconds,cl_seconds", where an empty or "-" cost marks the backend as unsupported.
+ * A "transfer,latency_seconds,seconds_per_byte" line sets the edge costs. Lines starting with '#' are ignored.
+ *
+ * @param[in] filename Cost table file
+ *
+ * @return The cost table
+ */
+DeviceCostTable load_device_cost_table(const std::string &filename);
+
+/** Mutation pass that places every node of a switching graph on NEON or CL
+ *
+ * Picks the assignment with the lowest sum of node costs and boundary transfer costs by solving a minimum s-t cut.
+ * Nodes without a cost entry keep their assigned target; const, input and output nodes follow their neighbours.
+ * Nodes only the NEON backend implements, such as the fused nodes and linear layers with a fused activation, stay on
+ * NEON whatever their cost entry says.
+ */
+class DevicePlacementMutator final : public IGraphMutator
+{
+public:
+    // Constructor
+    DevicePlacementMutator(DeviceCostTable costs);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    DeviceCostTable _costs;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DEVICE_PLACEMENT_MUTATOR_H */
@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
+#include "arm_compute/graph/mutators/DevicePlacementMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
@@ -0,0 +1,49 @@
+#ifndef ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H
+#define ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Residual add followed by Layer Normalization node
+ *
+ * Created by @ref NodeFusionMutator from an Eltwise Add node feeding a @ref LayerNormNode.
+ * Inputs are the two addends and optionally the per-channel gamma and beta tensors.
+ */
+class AddLayerNormNode final : public INode
+{
+    public:
+    /** Constructor
+     *
+     * @param[in] info Contains information described in @ref LayerNormLayerInfo.
+     */
+    AddLayerNormNode(LayerNormLayerInfo info);
+    /** Prevent instances of this class from being copy constructed */
+    AddLayerNormNode(const AddLayerNormNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    AddLayerNormNode &operator=(const AddLayerNormNode &) = delete;
+
+    /** LayerNormInfo accessor
+     *
+     * @return LayerNormInfo
+     */
+    const LayerNormLayerInfo &layer_norm_info() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::AddLayerNormLayer;
+
+    private:
+    LayerNormLayerInfo _info;
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H */
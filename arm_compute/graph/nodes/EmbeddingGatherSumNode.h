@@ -0,0 +1,59 @@
+#ifndef ARM_COMPUTE_GRAPH_EMBEDDING_GATHER_SUM_NODE_H
+#define ARM_COMPUTE_GRAPH_EMBEDDING_GATHER_SUM_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused token, segment and position embedding node
+ *
+ * Created by @ref NodeFusionMutator from the token, segment and position embedding nodes feeding an
+ * @ref EmbeddingSumLayerNode. Inputs are the token ids, the segment ids, and the vocabulary, segment and
+ * position embedding tables.
+ */
+class EmbeddingGatherSumNode final : public INode
+{
+    public:
+    /** Constructor
+     *
+     * @param[in] info Embedding layer information
+     */
+    EmbeddingGatherSumNode(EmbeddingLayerInfo info);
+    /** Prevent instances of this class from being copy constructed */
+    EmbeddingGatherSumNode(const EmbeddingGatherSumNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    EmbeddingGatherSumNode &operator=(const EmbeddingGatherSumNode &) = delete;
+
+    /** Embedding Layer Info Accessor
+     *
+     * @return Embedding Layer Info
+     */
+    const EmbeddingLayerInfo &embedding_info() const;
+    /** Computes the fused embedding output descriptor
+     *
+     * @param[in] tokens_descriptor Token ids tensor descriptor
+     * @param[in] vocab_descriptor  Vocabulary table tensor descriptor
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &tokens_descriptor,
+                                                      const TensorDescriptor &vocab_descriptor);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::EmbeddingGatherSumLayer;
+
+    private:
+    EmbeddingLayerInfo _info;
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_EMBEDDING_GATHER_SUM_NODE_H */
@@ -45,6 +45,8 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::EmbeddingSumLayer;
+
 private:
     EmbeddingLayerInfo _info;
 };
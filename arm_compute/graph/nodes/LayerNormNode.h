@@ -8,13 +8,17 @@ namespace arm_compute
 {
 namespace graph
 {
-/** Layer Normalization node */
+/** Layer Normalization node
+ *
+ * Inputs are the tensor to normalize and optionally the per-channel gamma and beta tensors.
+ * When gamma and beta are not connected the scalars of @ref LayerNormLayerInfo are used.
+ */
 class LayerNormNode final : public INode
 {
     public:
     /** Constructor
      *
-     * @param[in] linear_info Contains information described in @ref LayerNormLayerInfo.
+     * @param[in] info Contains information described in @ref LayerNormLayerInfo.
      */
     LayerNormNode(LayerNormLayerInfo info);
     /** Prevent instances of this class from being copy constructed */
@@ -34,6 +38,8 @@ class LayerNormNode final : public INode
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::LayerNormLayer;
+
     private:
     LayerNormLayerInfo _info;
 };
@@ -27,6 +27,16 @@ class LinearLayerNode final : public INode
      * @return LinearLayerInfo
      */
     const LinearLayerInfo &linear_info() const;
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -34,6 +44,8 @@ class LinearLayerNode final : public INode
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::LinearLayer;
+
     private:
     LinearLayerInfo _linear_info;
 };
@@ -72,9 +72,12 @@
 #include "arm_compute/graph/nodes/SegmentEmbeddingLayerNode.h"
 #include "arm_compute/graph/nodes/PositionEmbeddingLayerNode.h"
 #include "arm_compute/graph/nodes/EmbeddingSumLayerNode.h"
+#include "arm_compute/graph/nodes/EmbeddingGatherSumNode.h"
+#include "arm_compute/graph/nodes/TopKProjectionLayerNode.h"
 #include "arm_compute/graph/nodes/LinearLayerNode.h"
 #include "arm_compute/graph/nodes/AttentionLinearNode.h"
 #include "arm_compute/graph/nodes/ScaleDotProductionAttentionNode.h"
 #include "arm_compute/graph/nodes/LayerNormNode.h"
+#include "arm_compute/graph/nodes/AddLayerNormNode.h"
 
 #endif // ACL_ARM_COMPUTE_GRAPH_NODES_NODES_H
@@ -30,6 +30,8 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::PositionEmbeddingLayer;
+
 private:
 };
 } // namespace graph
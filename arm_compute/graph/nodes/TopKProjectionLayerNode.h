@@ -0,0 +1,49 @@
+#ifndef ARM_COMPUTE_GRAPH_TOPK_PROJECTION_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_TOPK_PROJECTION_LAYER_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Vocabulary projection node keeping only the best k tokens of the selected rows
+ *
+ * Inputs are the hidden states, the projection weights and the bias. The output holds (id, score) pairs of shape
+ * (2, k, num_rows), so the logits of the whole sequence are never materialised.
+ */
+class TopKProjectionLayerNode final : public INode
+{
+    public:
+    /** Constructor
+     *
+     * @param[in] info Top-k projection layer information
+     */
+    TopKProjectionLayerNode(TopKProjectionLayerInfo info);
+    /** Prevent instances of this class from being copy constructed */
+    TopKProjectionLayerNode(const TopKProjectionLayerNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    TopKProjectionLayerNode &operator=(const TopKProjectionLayerNode &) = delete;
+
+    /** TopKProjectionLayerInfo accessor
+     *
+     * @return TopKProjectionLayerInfo
+     */
+    const TopKProjectionLayerInfo &topk_info() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::TopKProjectionLayer;
+
+    private:
+    TopKProjectionLayerInfo _info;
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_TOPK_PROJECTION_LAYER_NODE_H */
@@ -83,6 +83,7 @@ class CLAttentionLinearLayer : public IFunction
 
     // Inherited methods overridden
     void run() override;
+    void prepare() override;
 
     private:
     struct Impl;
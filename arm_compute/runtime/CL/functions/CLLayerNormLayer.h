@@ -64,6 +64,33 @@ class CLLayerNormLayer : public IFunction
                    const ITensor          *input,
                    ITensor                *output,
                    const LayerNormLayerInfo &LayerNorm_info);
+    /** Initialise the kernel's inputs and output with per-channel gamma and beta
+     *
+     * @param[in]  input          First tensor input. Data type supported: F32.
+     * @param[in]  gamma          (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     *                            If nullptr, the scalar gamma of @p LayerNorm_info is used.
+     * @param[in]  beta           (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
+     *                            If nullptr, the scalar beta of @p LayerNorm_info is used.
+     * @param[out] output         Output tensor. Data type supported: F32.
+     * @param[in]  LayerNorm_info Layer normalization information.
+     */
+    void configure(const ITensor          *input,
+                   const ITensor          *gamma,
+                   const ITensor          *beta,
+                   ITensor                *output,
+                   const LayerNormLayerInfo &LayerNorm_info);
+    /** Initialise the kernel's inputs and output with per-channel gamma and beta
+     *
+     * Similar to @ref CLLayerNormLayer::configure(const ITensor *, const ITensor *, const ITensor *, ITensor *, const LayerNormLayerInfo &)
+     *
+     * @param[in] compile_context The compile context to be used.
+     */
+    void configure(const CLCompileContext   &compile_context,
+                   const ITensor          *input,
+                   const ITensor          *gamma,
+                   const ITensor          *beta,
+                   ITensor                *output,
+                   const LayerNormLayerInfo &LayerNorm_info);
     /** Static function to check if given info will lead to a valid configuration of @ref CLLayerNormLayer
      *
      * @param[in] input     First input tensor info. Data types supported: F32.
@@ -74,8 +74,11 @@ class CLLinearLayer : public IFunction
                    const LinearLayerInfo  &linear_info);
     /** Static function to check if given info will lead to a valid configuration of @ref CLLinearLayer
      *
-     * @param[in] input1 First input tensor info. Data types supported: F32.
-     * @param[in] output Output tensor info. Data type supported: F32.
+     * @note Only @ref NELinearLayer applies a fused activation, an enabled activation in @p linear_info is rejected.
+     *
+     * @param[in] input1      First input tensor info. Data types supported: F32.
+     * @param[in] output      Output tensor info. Data type supported: F32.
+     * @param[in] linear_info Linear layer information
      *
      * @return a status
      */
@@ -27,8 +27,12 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/PackedWeightsCache.h"
 
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -86,6 +90,27 @@ public:
      * @param weights Weights to mark unused
      */
     void pre_mark_as_unused(const ITensor *weights);
+    /** Sets the on-disk cache the managed functions store their reshaped weights to
+     *
+     * @param[in] cache Cache shared by the functions of this manager, nullptr disables it
+     */
+    void set_packed_weights_cache(std::shared_ptr<PackedWeightsCache> cache);
+    /** Cache of reshaped weights, nullptr if not set */
+    PackedWeightsCache *packed_weights_cache() const;
+    /** Shares the reshaped weights of a prepared function with the functions of this manager prepared after it
+     *
+     * @param[in] key     Key naming the reshape and the weights it was applied to
+     * @param[in] buffers Persistent workspace tensors holding the reshaped weights, they must outlive every function
+     *                    importing them
+     */
+    void register_packed_weights(const std::string &key, std::vector<const ITensor *> buffers);
+    /** Reshaped weights registered under a key
+     *
+     * @param[in] key Key naming the reshape and the weights it was applied to
+     *
+     * @return The registered workspace tensors, empty if none
+     */
+    std::vector<const ITensor *> find_packed_weights(const std::string &key) const;
 
 private:
     struct CounterElement
@@ -98,6 +123,8 @@ private:
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, CounterElement>                   _managed_counter;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::shared_ptr<PackedWeightsCache>                         _packed_weights_cache;
+    std::map<std::string, std::vector<const ITensor *>>         _packed_weights;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_IWEIGHTSMANAGER_H */
@@ -113,9 +113,12 @@
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
 
 #include "arm_compute/runtime/NEON/functions/NELayerNormLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEAddLayerNormLayer.h"
 #include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEAttentionLinearLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEEmbeddingSumLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingGatherSumLayer.h"
+#include "arm_compute/runtime/NEON/functions/NETopKProjectionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEPositionEmbeddingLayer.h"
 #include "arm_compute/runtime/NEON/functions/NETokenEmbeddingLayer.h"
 #include "arm_compute/runtime/NEON/functions/NESegmentEmbeddingLayer.h"
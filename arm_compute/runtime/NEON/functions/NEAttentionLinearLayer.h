@@ -3,6 +3,8 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/IRuntimeContext.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -17,8 +19,13 @@ class ITensorInfo;
 class NEAttentionLinearLayer : public IFunction
 {
     public:
-    /** Default Constructor */
-    NEAttentionLinearLayer();
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager for the fused projection output, which only lives until it is split.
+     * @param[in] weights_manager (Optional) Weights manager of the projections, see @ref NELinearLayer.
+     */
+    NEAttentionLinearLayer(std::shared_ptr<IMemoryManager> memory_manager  = nullptr,
+                           IWeightsManager                *weights_manager = nullptr);
     /** Default Destructor */
     ~NEAttentionLinearLayer();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -27,11 +34,14 @@ class NEAttentionLinearLayer : public IFunction
     NEAttentionLinearLayer &operator=(const NEAttentionLinearLayer &) = delete;
 
     /** Set the input and output tensor.
-     * 
-     * @param[in]  query      Input tenser of Attention Query, Data type supported: F32
-     * @param[in]  key        Input tensor of Attention Key, Data type supported: F32
-     * @param[in]  value      Input tenser of Attention Value, Data type supported: F32
-     * @param[out] output     Output tensor, shape (d_model,d_model). Data type supported: F32
+     *
+     * Biases can be nullptr. With @ref LinearLayerInfo::fuse_qkv the projections of a shared input run as one GEMM,
+     * unless only some of them have a bias.
+     *
+     * @param[in]  query      Input tenser of Attention Query, Data type supported: F16/F32
+     * @param[in]  key        Input tensor of Attention Key, Data type supported: F16/F32
+     * @param[in]  value      Input tenser of Attention Value, Data type supported: F16/F32
+     * @param[out] output     Output tensor, shape (d_model,d_model). Data type supported: F16/F32
      */
     void configure(const ITensor *query_input, const ITensor *query_w, const ITensor *query_b,
                    const ITensor *key_input, const ITensor *key_w, const ITensor *key_b,
@@ -48,6 +58,7 @@ class NEAttentionLinearLayer : public IFunction
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
     private:
     struct Impl;
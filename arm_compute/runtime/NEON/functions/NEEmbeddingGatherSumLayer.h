@@ -0,0 +1,83 @@
+#ifndef ARM_COMPUTE_NEEMBEDDINGGATHERSUMLAYER_H
+#define ARM_COMPUTE_NEEMBEDDINGGATHERSUMLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Gather the token, segment and position embeddings of every token and sum them in a single kernel */
+class NEEmbeddingGatherSumLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEEmbeddingGatherSumLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingGatherSumLayer(const NEEmbeddingGatherSumLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingGatherSumLayer(NEEmbeddingGatherSumLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingGatherSumLayer &operator=(const NEEmbeddingGatherSumLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingGatherSumLayer &operator=(NEEmbeddingGatherSumLayer &&) = delete;
+    /** Destructor */
+    ~NEEmbeddingGatherSumLayer();
+
+    /** Set the input and output tensor.
+     *
+     * Valid data type configurations:
+     * |tokens/segments    |tables         |output       |
+     * |:------------------|:--------------|:------------|
+     * |U32 ids (4 bytes)  |F16            |F16          |
+     * |U32 ids (4 bytes)  |F32            |F32          |
+     *
+     * @param[in]  tokens         Token ids, shape (seq_len).
+     * @param[in]  segments       Segment ids, shape (seq_len).
+     * @param[in]  vocab          Vocabulary embedding table, shape (d_model, d_vocab). Data type supported: F16/F32.
+     * @param[in]  segment_table  Segment embedding table, shape (d_model, d_segment). Data type supported: Same as @p vocab.
+     * @param[in]  position_table Position embedding table, shape (d_model, d_position). Data type supported: Same as @p vocab.
+     * @param[out] output         Output tensor, shape (d_model, seq_len). Data type supported: Same as @p vocab.
+     * @param[in]  emb_info       Embedding layer parameters.
+     * @param[in]  history        (Optional) Tensor whose valid rows count the tokens already decoded, e.g. a key cache.
+     *                            Positions of the tokens start after them.
+     */
+    void configure(const ITensor            *tokens,
+                   const ITensor            *segments,
+                   const ITensor            *vocab,
+                   const ITensor            *segment_table,
+                   const ITensor            *position_table,
+                   ITensor                  *output,
+                   const EmbeddingLayerInfo &emb_info,
+                   const ITensor            *history = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEEmbeddingGatherSumLayer
+     *
+     * Similar to @ref NEEmbeddingGatherSumLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *tokens,
+                           const ITensorInfo        *segments,
+                           const ITensorInfo        *vocab,
+                           const ITensorInfo        *segment_table,
+                           const ITensorInfo        *position_table,
+                           const ITensorInfo        *output,
+                           const EmbeddingLayerInfo &emb_info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_NEEMBEDDINGGATHERSUMLAYER_H */
@@ -38,20 +38,32 @@ public:
      * Valid data type configurations:
      * |src0           |dst          |
      * |:--------------|:------------|
+     * |F16            |F16          |
      * |F32            |F32          |
      *
-     * @param[in]  input1 First tensor input. Data type supported: F32.
-     * @param[out] output Output tensor. Data type supported: F32.
+     * @param[in]  input          Input tensor, normalized along dimension 0. Data type supported: F16/F32.
+     * @param[in]  gamma          (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     *                            If nullptr, the scalar gamma of @p LayerNorm_info is used.
+     * @param[in]  beta           (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
+     *                            If nullptr, the scalar beta of @p LayerNorm_info is used.
+     * @param[out] output         Output tensor. Data type supported: Same as @p input.
+     * @param[in]  LayerNorm_info Layer normalization information.
+     */
+    void configure(const ITensor *input, const ITensor *gamma, const ITensor *beta, ITensor *output, const LayerNormLayerInfo& LayerNorm_info);
+    /** Initialise the kernel's inputs and output with the scalar gamma and beta of @p LayerNorm_info
+     *
+     * @param[in]  input          Input tensor. Data type supported: F16/F32.
+     * @param[out] output         Output tensor. Data type supported: Same as @p input.
+     * @param[in]  LayerNorm_info Layer normalization information.
      */
     void configure(const ITensor *input, ITensor *output, const LayerNormLayerInfo& LayerNorm_info);
     /** Static function to check if given info will lead to a valid configuration of @ref NELayerNormLayer
      *
-     * @param[in] input     First input tensor info. Data types supported: F32.
-     * @param[in] output Output tensor info. Data type supported: F32.
+     * Similar to @ref NELayerNormLayer::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensor *input, ITensor *output, const LayerNormLayerInfo& LayerNorm_info);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *gamma, const ITensorInfo *beta, const ITensorInfo *output, const LayerNormLayerInfo& LayerNorm_info);
 
     // Inherited methods overridden
     void run() override;
@@ -4,8 +4,12 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -17,8 +21,16 @@ class ITensorInfo;
 class NELinearLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NELinearLayer();
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager for the function's temporary workspace.
+     * @param[in] weights_manager (Optional) Weights manager tracking when the original weights can be released.
+     *                            Functions of the same manager reading the same weights memory share one reshaped copy,
+     *                            which the first function prepared owns.
+     *                            If it holds a @ref PackedWeightsCache the reshaped weights are loaded from it or stored to it.
+     */
+    NELinearLayer(std::shared_ptr<IMemoryManager> memory_manager  = nullptr,
+                  IWeightsManager                *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NELinearLayer(const NELinearLayer &) = delete;
     /** Prevent instances of this class from being moved (As this class contains non movable objects) */
@@ -38,23 +50,36 @@ public:
      * Valid data type configurations:
      * |src0           |dst          |
      * |:--------------|:------------|
+     * |F16            |F16          |
      * |F32            |F32          |
      *
-     * @param[in]  input1 First tensor input. Data type supported: F32.
-     * @param[out] output Output tensor. Data type supported: F32.
+     * @param[in]  input1 First tensor input. Data type supported: F16/F32.
+     * @param[in]  bias   Bias tensor, can be nullptr. Data type supported: same as @p input1.
+     * @param[out] output Output tensor. Data type supported: same as @p input1.
      */
     void configure(const ITensor *input1, const ITensor *weight, const ITensor *bias, ITensor *output, const LinearLayerInfo& linear_info);
     /** Static function to check if given info will lead to a valid configuration of @ref NELinearLayer
      *
-     * @param[in] input1 First input tensor info. Data types supported: F32.
-     * @param[in] output Output tensor info. Data type supported: F32.
+     * @param[in] input1 First input tensor info. Data types supported: F16/F32.
+     * @param[in] output Output tensor info. Data type supported: same as @p input1.
      *
      * @return a status
      */
     static Status validate(const ITensor *input, const ITensor *weight, const ITensor *bias, ITensor *output, const LinearLayerInfo& linear_info);
+    /** Fills the weights on demand from the 2D tensors they are concatenated from along Y
+     *
+     * The reshaped weights are then looked up by the sources, and @p fill only runs when the weights have to be
+     * reshaped, so a function sharing them or loading them from the packed weights cache never concatenates them.
+     * Must be called before @ref prepare.
+     *
+     * @param[in] sources Allocated tensors the weights are concatenated from, in order
+     * @param[in] fill    Allocates and fills the weights passed to @ref configure
+     */
+    void set_weights_source(std::vector<const ITensor *> sources, std::function<void()> fill);
 
     // Inherited methods overridden
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
@@ -28,8 +28,8 @@ public:
     /** Set the input and output tensor.
      * 
      * @param[in]  input        Input tensor of char text, Data type supported: U8
-     * @param[in]  Position     Const tenser of Position vector, Data type supported: F32
-     * @param[out] output       Output tensor, shape (seq_len,d_model). Data type supported: F32
+     * @param[in]  Position     Const tenser of Position vector, Data type supported: F16/F32
+     * @param[out] output       Output tensor, shape (seq_len,d_model). Data type supported: same as @p Position
      */
     void configure(ITensor *input, ITensor *Position, ITensor *output);
     /** Static function to check if given info will lead to a valid configuration of @ref NEPositionEmbeddingLayer
@@ -3,6 +3,7 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IRuntimeContext.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -17,8 +18,11 @@ class ITensorInfo;
 class NEScaleDotProductionAttentionLayer : public IFunction
 {
 public:
-    /** Default Constructor */
-    NEScaleDotProductionAttentionLayer();
+    /** Constructor
+     *
+     * @param[in] memory_manager (Optional) Memory manager for the intermediates of the unfused attention.
+     */
+    NEScaleDotProductionAttentionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Default Destructor */
     ~NEScaleDotProductionAttentionLayer();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -28,12 +32,18 @@ public:
 
     /** Set the input and output tensor.
      * 
-     * @param[in]  query      Input tenser of Attention Query, Data type supported: F32
-     * @param[in]  key        Input tensor of Attention Key, Data type supported: F32
-     * @param[in]  value      Input tenser of Attention Value, Data type supported: F32
-     * @param[out] output     Output tensor, shape (d_model,d_model). Data type supported: F32
+     * @param[in]  query       Input tenser of Attention Query, Data type supported: F16/F32
+     * @param[in]  key         Input tensor of Attention Key, Data type supported: F16/F32
+     * @param[in]  value       Input tenser of Attention Value, Data type supported: F16/F32
+     * @param[out] output      Output tensor, shape (d_model,d_model). Data type supported: F16/F32
+     * @param[in]  key_cache   (Optional) Persistent key history, shape (d_model, max_len). Every run appends the valid
+     *                         rows of @p key and grows its valid region, the queries attend over all the cached rows.
+     * @param[in]  value_cache (Optional) Persistent value history, same shape as @p key_cache.
+     * @param[in]  lengths     (Optional) Valid length of each sequence when the rows hold a batch of padded sequences,
+     *                         shape (batch). Data type supported: U32. Read on every run.
      */
-    void configure(ITensor *query,ITensor *key,ITensor *value, ITensor *output, const ScaleDotProductionLayerInfo& info, int recurrence_count);
+    void configure(ITensor *query,ITensor *key,ITensor *value, ITensor *output, const ScaleDotProductionLayerInfo& info, int recurrence_count,
+                   ITensor *key_cache = nullptr, ITensor *value_cache = nullptr, ITensor *lengths = nullptr);
     /** Static function to check if given info will lead to a valid configuration of @ref NEScaleDotProductionAttentionLayer
      *
      * @param[in] output Destination tensor info. Data type supported: same as @p input
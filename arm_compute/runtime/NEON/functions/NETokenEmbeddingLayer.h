@@ -29,9 +29,9 @@ public:
     /** Set the input and output tensor.
      * 
      * @param[in]  input        Input tensor of char text, Data type supported: U8
-     * @param[in]  vocab        Const tenser of char 2 vec, Data type supported: F32
+     * @param[in]  vocab        Const tenser of char 2 vec, Data type supported: F16/F32
      * @param[in]  emb_info     Token Embedding Layer Info.
-     * @param[out] output       Output tensor, shape (seq_len,d_model). Data type supported: F32
+     * @param[out] output       Output tensor, shape (seq_len,d_model). Data type supported: same as @p vocab
      */
     void configure(ITensor *input, ITensor *vocab, ITensor *output, const EmbeddingLayerInfo& emb_info);
     /** Static function to check if given info will lead to a valid configuration of @ref NETokenEmbeddingLayer
@@ -0,0 +1,79 @@
+#ifndef ARM_COMPUTE_NETOPKPROJECTIONLAYER_H
+#define ARM_COMPUTE_NETOPKPROJECTIONLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Project selected rows onto the vocabulary and keep the best k tokens, without storing the logits */
+class NETopKProjectionLayer : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] memory_manager (Optional) Memory manager for the function's temporary workspace.
+     */
+    NETopKProjectionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKProjectionLayer(const NETopKProjectionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NETopKProjectionLayer(NETopKProjectionLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKProjectionLayer &operator=(const NETopKProjectionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NETopKProjectionLayer &operator=(NETopKProjectionLayer &&) = delete;
+    /** Destructor */
+    ~NETopKProjectionLayer();
+
+    /** Set the input and output tensor.
+     *
+     * Valid data type configurations:
+     * |input          |weights/bias   |output       |
+     * |:--------------|:--------------|:------------|
+     * |F16            |F16            |F32          |
+     * |F32            |F32            |F32          |
+     *
+     * @param[in]  input   Input tensor, shape (d_model, seq_len).
+     * @param[in]  weights Weights tensor, shape (d_model, d_vocab).
+     * @param[in]  bias    Bias tensor, shape (d_vocab). Can be nullptr.
+     * @param[out] output  Output tensor, shape (2, k, num_rows). (id, score) pairs from the best to the worst score,
+     *                     ids are stored as floats.
+     * @param[in]  info    Top-k projection layer information.
+     */
+    void configure(const ITensor                 *input,
+                   const ITensor                 *weights,
+                   const ITensor                 *bias,
+                   ITensor                       *output,
+                   const TopKProjectionLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NETopKProjectionLayer
+     *
+     * Similar to @ref NETopKProjectionLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *input,
+                           const ITensorInfo             *weights,
+                           const ITensorInfo             *bias,
+                           const ITensorInfo             *output,
+                           const TopKProjectionLayerInfo &info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_NETOPKPROJECTIONLAYER_H */
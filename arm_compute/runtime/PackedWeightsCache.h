@@ -0,0 +1,75 @@
+#ifndef ARM_COMPUTE_PACKED_WEIGHTS_CACHE_H
+#define ARM_COMPUTE_PACKED_WEIGHTS_CACHE_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** On-disk cache of reshaped weights, so that a cold start skips the weight transformations
+ *
+ * A function that reshapes its weights once stores the persistent results under a key naming the reshape (shapes,
+ * reshape path, selected kernel) and a fingerprint of the original weights. On the next start the blob is mapped
+ * copy-on-write and imported into the workspace tensors, the original weights are then only read to fingerprint them.
+ *
+ * Blobs are written to a temporary file and renamed, so concurrent processes sharing a directory only ever see whole
+ * blobs. A blob whose key or sizes do not match is ignored and rewritten.
+ */
+class PackedWeightsCache final
+{
+public:
+    /** Handle keeping a loaded blob mapped, the tensors it was imported into must not outlive it */
+    using Mapping = std::shared_ptr<void>;
+
+    /** Constructor
+     *
+     * @param[in] directory Existing directory the blobs are read from and written to
+     */
+    explicit PackedWeightsCache(std::string directory);
+    /** Fingerprint of a weights tensor
+     *
+     * Hashes the shape, the data type and the whole content, so a checkpoint differing in a single weight never loads
+     * the blob of another one. This reads the weights once per start, far cheaper than reshaping them.
+     *
+     * @param[in] weights Allocated weights tensor
+     *
+     * @return The fingerprint
+     */
+    static uint64_t fingerprint(const ITensor &weights);
+    /** Fingerprint of 2D weights concatenated along Y, without concatenating them
+     *
+     * @param[in] weights Allocated weights tensors, in concatenation order
+     *
+     * @return The fingerprint, equal to the one of the concatenated tensor
+     */
+    static uint64_t fingerprint(const std::vector<const ITensor *> &weights);
+    /** Imports a stored blob into the given tensors
+     *
+     * @param[in]      key     Key the blob was stored under
+     * @param[in, out] buffers Allocated U8 tensors, in the order they were stored
+     *
+     * @return A handle keeping the blob mapped, nullptr if there is no matching blob or it can not be imported.
+     *         @p buffers then keep memory of their own, though its content is undefined after a failed import
+     */
+    Mapping load(const std::string &key, const std::vector<Tensor *> &buffers) const;
+    /** Stores the content of the given tensors under a key
+     *
+     * Failing to write the blob is not an error, the next start reshapes the weights again.
+     *
+     * @param[in] key     Key of the blob
+     * @param[in] buffers Allocated U8 tensors
+     */
+    void store(const std::string &key, const std::vector<const ITensor *> &buffers) const;
+
+private:
+    std::string path(const std::string &key) const;
+
+    std::string _directory;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_PACKED_WEIGHTS_CACHE_H */
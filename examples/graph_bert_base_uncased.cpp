@@ -28,18 +28,34 @@
 #include "support/ToolchainSupport.h"
 #include "utils/CommonGraphOptions.h"
 #include "utils/GraphUtils.h"
+#include "utils/TextLoader.h"
 #include "utils/Utils.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 using namespace arm_compute::utils;
 using namespace arm_compute::graph::frontend;
 using namespace arm_compute::graph_utils;
 
+namespace
+{
+// Model parameters
+constexpr unsigned int d_model    = 768U;   // Dim layer output
+constexpr unsigned int d_vocab    = 30522U; // Vocaboary size
+constexpr unsigned int d_segemnt  = 2U;     // Sentence segmentation size
+constexpr unsigned int d_position = 512U;   // Pretrained positional encoding length
+constexpr unsigned int h          = 12U;    // Parallel attention (Heads)
+constexpr float        eps        = 1e-12;  // Layer normalization eplision
+constexpr unsigned int d_ff       = 3072U;  // Dim feedforward
+} // namespace
+
 class GraphVanillaTransformerExample : public Example
 {
     public:
     GraphVanillaTransformerExample()
-        : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "Vanilla_Transformer")
+        : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "Vanilla_Transformer"), buckets(), request_tokens(), request_segments(),
+          sequence_batch(), batch_tokens(), batch_segments(), tokenizer()
     {
     }
     bool do_setup(int argc, char **argv) override
@@ -61,74 +77,6 @@ class GraphVanillaTransformerExample : public Example
         // Print parameter values
         std::cout << common_params << std::endl;
 
-        // Get trainable parameters data path
-        std::string data_path = common_params.data_path;
-
-        // Model parameters
-        constexpr unsigned int d_model    = 768U;   // Dim layer output
-        constexpr unsigned int d_vocab    = 30522U; // Vocaboary size
-        constexpr unsigned int d_segemnt  = 2U;     // Sentence segmentation size
-        constexpr unsigned int d_position = 512U;   // Pretrained positional encoding length
-        constexpr unsigned int h          = 12U;    // Parallel attention (Heads)
-        constexpr float        eps        = 1e-12;  // Layer normalization eplision
-        constexpr unsigned int d_ff       = 3072U;  // Dim feedforward
-
-        // Create input tensor
-        const TensorShape src_tensor = TensorShape(common_params.input_len);
-        ScaleDotProductionLayerInfo sdpa_info = ScaleDotProductionLayerInfo(d_model, h);
-
-        // Data layout
-        const DataLayout operation_layout = DataLayout::NCHW;
-
-        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, common_params.data_type);
-
-        // Set graph hints
-        graph << common_params.target << common_params.fast_math_hint;
-
-        // Text preprocessor
-        std::unique_ptr<IPreprocessor> at2_preproccessor = std::make_unique<atoiPreprocessor>();
-
-        // Encode Input
-        graph << InputLayer(input_descriptor, get_token_accessor(common_params),
-                            get_segment_accessor(common_params.segment, move(at2_preproccessor)))
-                     .set_name("in").set_target(Target::NEON)
-
-              << EmbeddingLayer(EmbeddingLayerInfo(d_model,
-                                                   d_vocab,
-                                                   d_segemnt,
-                                                   d_position,
-                                                   true /*Use pretrained positional encoding*/,
-                                                   ConvertPolicy::SATURATE),
-                                get_weights_accessor(data_path, "token_embedding.npy", operation_layout),
-                                get_weights_accessor(data_path, "segment_embedding.npy", operation_layout),
-                                get_weights_accessor(data_path, "positional_embedding.npy", operation_layout))
-                     .set_name("tkemb").set_target(Target::NEON);
-
-        add_encoder_block(data_path, "layer_0/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_1/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_2/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_3/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_4/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_5/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-
-        add_encoder_block(data_path, "layer_6/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_7/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_8/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_9/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_10/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-        add_encoder_block(data_path, "layer_11/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
-
-        // Pooler
-        graph << LinearLayer(LinearLayerInfo(d_model, TensorShape(d_model, d_model),
-                                             TensorShape(d_model)),
-                             get_weights_accessor(data_path, "pooler_weight.npy"),
-                             get_weights_accessor(data_path, "pooler_bias.npy")).set_target(Target::NEON).set_name("post_linear")
-
-              << ActivationLayer(ActivationLayerInfo(ActivationFunction::TANH, 1.f, 1.f)).set_target(Target::NEON).set_name("post_acti")
-
-              << OutputLayer(get_output_accessor(common_params)).set_name("out").set_target(Target::NEON);
-
-        // Finalize graph
         GraphConfig config;
 
         config.num_threads = common_params.threads;
@@ -136,45 +84,227 @@ class GraphVanillaTransformerExample : public Example
         config.tuner_mode  = common_params.tuner_mode;
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
+        config.placement_cost_file = common_params.placement_cost_file;
+        config.packed_weights_dir  = common_params.packed_weights_dir;
+        config.dynamic_int8_linear = common_params.dynamic_int8;
+        config.weight_only_linear  = common_params.weight_only;
+        config.weight_group_size   = common_params.weight_group_size;
+        config.approximate_gelu    = common_params.approximate_gelu;
+        config.enable_profiling    = common_params.measure;
 
         config.use_transition_memory_manager = false;
 
-#ifdef MEASURE_TIME
-        // Clear previous output
-        std::ofstream ofs;
-        ofs.open("measure_output.txt", std::ofstream::out | std::ofstream::trunc);
-        ofs.close();
-#endif
+        if(common_params.batches > 1)
+        {
+            ARM_COMPUTE_EXIT_ON_MSG(!common_params.buckets.empty(), "Sequence buckets and batches cannot be combined");
 
-        graph.finalize(common_params.target, config);
+            // One padded query per column, the attention layers mask every query to its own length
+            sequence_batch        = std::make_shared<graph::SequenceBatch>(common_params.batches, common_params.input_len);
+            config.sequence_batch = sequence_batch;
+
+            add_model(graph, TensorShape(common_params.input_len, common_params.batches),
+                      std::make_unique<PaddedBatchAccessor>(batch_tokens), std::make_unique<PaddedBatchAccessor>(batch_segments));
+
+            graph.finalize(common_params.target, config);
+            return true;
+        }
+
+        if(common_params.buckets.empty())
+        {
+            // Text preprocessor
+            std::unique_ptr<IPreprocessor> at2_preproccessor = std::make_unique<atoiPreprocessor>();
+
+            add_model(graph, TensorShape(common_params.input_len), get_token_accessor(common_params),
+                      get_segment_accessor(common_params.segment, move(at2_preproccessor)));
+
+            // Finalize graph
+            graph.finalize(common_params.target, config);
+            return true;
+        }
+
+        // One workload per sequence length bucket, the first one loads the weights and the others alias them
+        config.shared_consts = std::make_shared<graph::SharedConstTensors>();
+        for(auto length : common_params.buckets)
+        {
+            ARM_COMPUTE_EXIT_ON_MSG(length > d_position, "Sequence buckets cannot exceed the positional encoding length");
+            buckets.push_back({ length, std::make_unique<Stream>(buckets.size() + 1, "Vanilla_Transformer_" + std::to_string(length)) });
+
+            Stream &g = *buckets.back().stream;
+            add_model(g, TensorShape(length), std::make_unique<PaddedIdsAccessor>(request_tokens),
+                      std::make_unique<PaddedIdsAccessor>(request_segments));
+            g.finalize(common_params.target, config);
+        }
 
         return true;
     }
 
     void do_run() override
     {
+        Stream *to_run = &graph;
+        if(!buckets.empty())
+        {
+            to_run = &dispatch_request();
+        }
+        if(sequence_batch != nullptr)
+        {
+            dispatch_batch();
+        }
+
         auto start_time = std::chrono::high_resolution_clock::now();
 
         // Run graph
-        graph.run();
+        to_run->run();
 
         auto   end_time  = std::chrono::high_resolution_clock::now();
         double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
         std::cout << "Run cost: " << cost_time << std::endl;
+
+        if(common_params.measure)
+        {
+            to_run->profiler().export_csv(common_params.measure_file + ".csv");
+            to_run->profiler().export_chrome_trace(common_params.measure_file + ".json");
+            to_run->profiler().print_summary(std::cout);
+        }
     }
 
     private:
-    CommandLineParser  cmd_parser;
-    CommonGraphOptions common_opts;
-    CommonGraphParams  common_params;
-    Stream             graph;
+    /** Workload configured for one sequence length */
+    struct Bucket
+    {
+        unsigned int            length;
+        std::unique_ptr<Stream> stream;
+    };
+
+    CommandLineParser         cmd_parser;
+    CommonGraphOptions        common_opts;
+    CommonGraphParams         common_params;
+    Stream                    graph;
+    std::vector<Bucket>       buckets;
+    std::vector<unsigned int> request_tokens;
+    std::vector<unsigned int> request_segments;
+
+    std::shared_ptr<graph::SequenceBatch>  sequence_batch;
+    std::vector<std::vector<unsigned int>> batch_tokens;
+    std::vector<std::vector<unsigned int>> batch_segments;
+
+    std::unique_ptr<utils::WordPieceTokenizer> tokenizer;
+
+    /** Tokenizer of the vocabulary, loaded on first use and kept across requests */
+    const utils::WordPieceTokenizer &vocabulary()
+    {
+        if(tokenizer == nullptr)
+        {
+            tokenizer = std::make_unique<utils::WordPieceTokenizer>(lower_string(common_params.vocabulary));
+        }
+        return *tokenizer;
+    }
+
+    /** Tokenizes one query per line of the input text, queries past the batch size are dropped */
+    void dispatch_batch()
+    {
+        auto textloader = utils::TextLoaderFactory::create(lower_string(common_params.text));
+        ARM_COMPUTE_EXIT_ON_MSG(textloader == nullptr, "Unsupported Text type");
+        textloader->open(lower_string(common_params.text));
+        batch_tokens = textloader->read_token_id_lines(vocabulary());
+        if(batch_tokens.size() > sequence_batch->batch_size())
+        {
+            batch_tokens.resize(sequence_batch->batch_size());
+        }
+
+        std::vector<unsigned int> lengths;
+        batch_segments.clear();
+        for(const auto &ids : batch_tokens)
+        {
+            lengths.push_back(static_cast<unsigned int>(ids.size()));
+            batch_segments.emplace_back(ids.size(), 0U);
+        }
+        sequence_batch->set_lengths(lengths);
+        std::cout << "Queries: " << batch_tokens.size() << " Batch: " << sequence_batch->batch_size() << std::endl;
+    }
+
+    /** Tokenizes the input text and picks the smallest bucket holding it, the largest one truncates longer inputs */
+    Stream &dispatch_request()
+    {
+        auto textloader = utils::TextLoaderFactory::create(lower_string(common_params.text));
+        ARM_COMPUTE_EXIT_ON_MSG(textloader == nullptr, "Unsupported Text type");
+        textloader->open(lower_string(common_params.text));
+        request_tokens = textloader->read_token_ids(vocabulary());
+
+        request_segments.assign(request_tokens.size(), 0U);
+        if(!common_params.segment.empty())
+        {
+            auto segmentloader = utils::TextLoaderFactory::create(common_params.segment);
+            ARM_COMPUTE_EXIT_ON_MSG(segmentloader == nullptr, "Unsupported Text type");
+            segmentloader->open(common_params.segment);
+            request_segments = segmentloader->read_digit_ids();
+        }
+
+        auto bucket = std::find_if(buckets.begin(), buckets.end(),
+                                   [&](const Bucket &b) { return b.length >= request_tokens.size(); });
+        if(bucket == buckets.end())
+        {
+            bucket = std::prev(buckets.end());
+        }
+        std::cout << "Tokens: " << request_tokens.size() << " Bucket: " << bucket->length << std::endl;
+        return *bucket->stream;
+    }
+
+    /** Adds the input, embedding, encoder blocks and pooler to @p g for inputs of shape @p input_shape */
+    void add_model(Stream &g, const TensorShape &input_shape, std::unique_ptr<graph::ITensorAccessor> token_accessor,
+                   std::unique_ptr<graph::ITensorAccessor> segment_accessor)
+    {
+        // Get trainable parameters data path
+        std::string data_path = common_params.data_path;
+
+        ScaleDotProductionLayerInfo sdpa_info = ScaleDotProductionLayerInfo(d_model, h);
+
+        // Data layout
+        const DataLayout operation_layout = DataLayout::NCHW;
+
+        // Ids are 32-bit integers whatever the model data type
+        TensorDescriptor input_descriptor = TensorDescriptor(input_shape, DataType::U32);
+
+        // Set graph hints
+        g << common_params.target << common_params.fast_math_hint;
+
+        // Encode Input
+        g << InputLayer(input_descriptor, std::move(token_accessor), std::move(segment_accessor))
+                 .set_name("in").set_target(Target::NEON)
+
+          << EmbeddingLayer(EmbeddingLayerInfo(d_model,
+                                               d_vocab,
+                                               d_segemnt,
+                                               d_position,
+                                               true /*Use pretrained positional encoding*/,
+                                               ConvertPolicy::SATURATE,
+                                               common_params.data_type),
+                            get_weights_accessor(data_path, "token_embedding.npy", operation_layout),
+                            get_weights_accessor(data_path, "segment_embedding.npy", operation_layout),
+                            get_weights_accessor(data_path, "positional_embedding.npy", operation_layout))
+                 .set_name("tkemb").set_target(Target::NEON);
+
+        for(unsigned int layer = 0; layer < 12; ++layer)
+        {
+            add_encoder_block(g, data_path, "layer_" + std::to_string(layer) + "/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff, sdpa_info);
+        }
+
+        // Pooler
+        g << LinearLayer(LinearLayerInfo(d_model, TensorShape(d_model, d_model),
+                                         TensorShape(d_model)),
+                         get_weights_accessor(data_path, "pooler_weight.npy"),
+                         get_weights_accessor(data_path, "pooler_bias.npy")).set_target(Target::NEON).set_name("post_linear")
+
+          << ActivationLayer(ActivationLayerInfo(ActivationFunction::TANH, 1.f, 1.f)).set_target(Target::NEON).set_name("post_acti")
+
+          << OutputLayer(get_output_accessor(common_params)).set_name("out").set_target(Target::NEON);
+    }
 
-    void add_encoder_block(std::string data_path, std::string layer_path,
+    void add_encoder_block(Stream &g, std::string data_path, std::string layer_path,
                            unsigned int d_model, unsigned int h, float eps, unsigned int d_ff, ScaleDotProductionLayerInfo &sdpa_info)
     {
         ARM_COMPUTE_UNUSED(h);
-        SubStream without_attention(graph);
-        SubStream with_attention(graph);
+        SubStream without_attention(g);
+        SubStream with_attention(g);
 
         with_attention
             /* Self Attention */
@@ -186,13 +316,13 @@ class GraphVanillaTransformerExample : public Example
                                     get_weights_accessor(data_path + layer_path, "value_bias.npy")).set_target(Target::CL).set_name("attention_linear")
             << ScaleDotProductionLayer(sdpa_info).set_name("mha").set_target(Target::NEON);
 
-        graph << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add, 1).set_name("attention_res_add").set_target(Target::NEON);
+        g << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add, 1).set_name("attention_res_add").set_target(Target::NEON);
 
         /* Self output */
-        graph << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("attention_norm");
+        g << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("attention_norm");
 
-        SubStream without_ff(graph);
-        SubStream with_ff(graph);
+        SubStream without_ff(g);
+        SubStream with_ff(g);
         /* Self Intermediate(Feed Forward)*/
         with_ff << LinearLayer(LinearLayerInfo(d_ff, TensorShape(d_model, d_ff) /*weight*/,
                                                TensorShape(d_ff) /*bias*/),
@@ -204,10 +334,10 @@ class GraphVanillaTransformerExample : public Example
                                get_weights_accessor(data_path + layer_path, "ff_weight_1.npy"),
                                get_weights_accessor(data_path + layer_path, "ff_bias_1.npy")).set_target(Target::CL).set_name("ff_linear_2");
 
-        graph << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add, 0).set_name("ff_res_add").set_target(Target::NEON);
+        g << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add, 0).set_name("ff_res_add").set_target(Target::NEON);
 
         /* Output*/
-        graph << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("ff_norm");
+        g << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("ff_norm");
     }
 };
 
@@ -80,7 +80,8 @@ class GraphVanillaTransformerExample : public Example
         // Data layout
         const DataLayout operation_layout = DataLayout::NCHW;
 
-        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, common_params.data_type);
+        // Ids are 32-bit integers whatever the model data type
+        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, DataType::U32);
 
         // Set graph hints
         graph << common_params.target << common_params.fast_math_hint;
@@ -98,7 +99,8 @@ class GraphVanillaTransformerExample : public Example
                                                    d_segemnt,
                                                    d_position,
                                                    true /*Use pretrained positional encoding*/,
-                                                   ConvertPolicy::SATURATE),
+                                                   ConvertPolicy::SATURATE,
+                                                   common_params.data_type),
                                 get_weights_accessor(data_path, "token_embedding.npy", operation_layout),
                                 get_weights_accessor(data_path, "segment_embedding.npy", operation_layout),
                                 get_weights_accessor(data_path, "positional_embedding.npy", operation_layout))
@@ -151,6 +153,13 @@ class GraphVanillaTransformerExample : public Example
         config.tuner_mode  = common_params.tuner_mode;
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
+        config.placement_cost_file = common_params.placement_cost_file;
+        config.packed_weights_dir  = common_params.packed_weights_dir;
+        config.dynamic_int8_linear = common_params.dynamic_int8;
+        config.weight_only_linear  = common_params.weight_only;
+        config.weight_group_size   = common_params.weight_group_size;
+        config.approximate_gelu    = common_params.approximate_gelu;
+        config.enable_profiling    = common_params.measure;
 
         graph.finalize(common_params.target, config);
 
@@ -161,6 +170,13 @@ class GraphVanillaTransformerExample : public Example
     {
         // Run graph
         graph.run();
+
+        if(common_params.measure)
+        {
+            graph.profiler().export_csv(common_params.measure_file + ".csv");
+            graph.profiler().export_chrome_trace(common_params.measure_file + ".json");
+            graph.profiler().print_summary(std::cout);
+        }
     }
 
     private:
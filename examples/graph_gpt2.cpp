@@ -35,11 +35,70 @@ using namespace arm_compute::utils;
 using namespace arm_compute::graph::frontend;
 using namespace arm_compute::graph_utils;
 
+namespace
+{
+constexpr unsigned int d_model    = 768U;   // Dim layer output
+constexpr unsigned int d_vocab    = 50257U; // Vocabulary size
+constexpr unsigned int d_segment  = 1U;     // no segmentation in gpt2
+constexpr unsigned int d_position = 1024U;  // Pretrained positional encoding length
+constexpr unsigned int h          = 12U;    // Parallel attention (Heads)
+constexpr float        eps        = 1e-5;   // Layer normalization eplision
+constexpr unsigned int d_ff       = 3072U;  // Dim feedforward
+
+/** Next token picked greedily by the top-k projection, shared by the prefill and decode graphs */
+struct GreedyDecodeState
+{
+    unsigned int              next_token{0};
+    unsigned int              remaining{0};
+    std::vector<unsigned int> generated{};
+};
+
+/** Feeds the last picked token to a decode graph of sequence length one */
+class NextTokenAccessor final : public graph::ITensorAccessor
+{
+    public:
+    NextTokenAccessor(GreedyDecodeState &state)
+        : _state(state)
+    {}
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        *reinterpret_cast<unsigned int *>(tensor.ptr_to_element(Coordinates(0))) = _state.next_token;
+        return true;
+    }
+
+    private:
+    GreedyDecodeState &_state;
+};
+
+/** Reads the best (id, score) pair of the top-k projection, keeps the graph running while tokens remain */
+class GreedyTokenAccessor final : public graph::ITensorAccessor
+{
+    public:
+    GreedyTokenAccessor(GreedyDecodeState &state)
+        : _state(state)
+    {}
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        const unsigned int best = static_cast<unsigned int>(*reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(0, 0, 0))));
+
+        _state.next_token = best;
+        _state.generated.push_back(best);
+        _state.remaining = (_state.remaining > 0) ? _state.remaining - 1 : 0;
+        return _state.remaining > 0;
+    }
+
+    private:
+    GreedyDecodeState &_state;
+};
+} // namespace
+
 class GraphGPTExample : public Example
 {
     public:
     GraphGPTExample()
-        : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "GPT")
+        : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "GPT"), decode_graph(1, "GPT_decode"), decode_state(), kv_cache(), tokenizer()
     {}
 
     bool do_setup(int argc, char **argv) override
@@ -61,71 +120,32 @@ class GraphGPTExample : public Example
         // Print parameter values
         std::cout << common_params << std::endl;
 
-        // Get trainable parameters data path
-        std::string data_path = common_params.data_path;
-
-        constexpr unsigned int d_model    = 768U;   // Dim layer output
-        constexpr unsigned int d_vocab    = 50257U; // Vocabulary size
-        constexpr unsigned int d_segment  = 1U;     // no segmentation in gpt2
-        constexpr unsigned int d_position = 1024U;   // Pretrained positional encoding length
-        constexpr unsigned int h          = 12U;    // Parallel attention (Heads)
-        constexpr float        eps        = 1e-5;  // Layer normalization eplision
-        constexpr unsigned int d_ff       = 3072U;  // Dim feedforward
-
         // Create input tensor
         const TensorShape src_tensor = TensorShape(common_params.input_len);
 
-        // Data layout
-        const DataLayout operation_layout = DataLayout::NCHW;
-
-        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, common_params.data_type);
+        // Ids are 32-bit integers whatever the model data type
+        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, DataType::U32);
 
+        // Text preprocessor
+        std::unique_ptr<IPreprocessor> at2_preproccessor = std::make_unique<atoiPreprocessor>();
         // Set graph hints
         graph << common_params.target << common_params.fast_math_hint;
 
-        // Text preprocessor
-        std::unique_ptr<IPreprocessor> at2_preproccessor = std::make_unique<atoiPreprocessor>();
+        // GPT-2 reads byte-level BPE ids, the vocabulary and merges are loaded once
+        const bool needs_tokenizer = common_params.validation_file.empty();
+        ARM_COMPUTE_EXIT_ON_MSG(needs_tokenizer && (common_params.vocabulary.empty() || common_params.merges.empty()),
+                                "GPT-2 needs --vocabulary=<vocab.json> and --merges=<merges.txt>");
+        if(needs_tokenizer)
+        {
+            tokenizer = std::make_shared<BPETokenizer>(common_params.vocabulary, common_params.merges);
+        }
+
         // Encode Input
         // RULE: segment id must all be the same and the segment embedding parameters are all 0
-        graph << InputLayer(input_descriptor, get_token_accessor(common_params),
+        graph << InputLayer(input_descriptor, get_bpe_token_accessor(common_params, tokenizer),
                             get_segment_accessor(common_params.segment, move(at2_preproccessor)))
-                     .set_name("in1").set_target(Target::NEON)
-
-            << EmbeddingLayer(EmbeddingLayerInfo(d_model,
-                                                   d_vocab,
-                                                   d_segment,
-                                                   d_position,
-                                                   true /*Use pretrained positional encoding*/,
-                                                   ConvertPolicy::SATURATE),
-                                get_weights_accessor(data_path, "token_embedding.npy", operation_layout),
-                                // all zeroes for gpt2
-                                get_weights_accessor(data_path, "segment_embedding.npy", operation_layout),
-                                get_weights_accessor(data_path, "position_embedding.npy", operation_layout))
-                     .set_name("tkemb1").set_target(Target::NEON);
-
-        add_decoder_block(data_path, "layer_0/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_1/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_2/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_3/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_4/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_5/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_6/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_7/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_8/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_9/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_10/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-        add_decoder_block(data_path, "layer_11/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
-
-        graph << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("final_norm")
-            << LinearLayer(LinearLayerInfo(d_model, TensorShape(d_model, d_vocab),
-                                            TensorShape(d_vocab)),
-                             get_weights_accessor(data_path, "projection_weight.npy"),
-                             // just zeroes for gpt2
-                             get_weights_accessor(data_path, "projection_bias.npy")).set_target(Target::CL).set_name("vocab_projection")
+                     .set_name("in1").set_target(Target::NEON);
 
-              << OutputLayer(get_output_accessor(common_params)).set_name("out1").set_target(Target::NEON);
-        
-        // Finalize graph
         GraphConfig config;
 
         config.num_threads = common_params.threads;
@@ -133,18 +153,42 @@ class GraphGPTExample : public Example
         config.tuner_mode  = common_params.tuner_mode;
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
+        config.placement_cost_file = common_params.placement_cost_file;
+        config.packed_weights_dir  = common_params.packed_weights_dir;
+        config.dynamic_int8_linear = common_params.dynamic_int8;
+        config.weight_only_linear  = common_params.weight_only;
+        config.weight_group_size   = common_params.weight_group_size;
+        config.approximate_gelu    = common_params.approximate_gelu;
+        config.enable_profiling    = common_params.measure;
 
         config.use_transition_memory_manager = false;
 
-#ifdef MEASURE_TIME
-        // Clear previous output
-        std::ofstream ofs;
-        ofs.open("measure_output.txt", std::ofstream::out | std::ofstream::trunc);
-        ofs.close();
-#endif
+        if(common_params.generate <= 0)
+        {
+            add_model(graph, get_output_accessor(common_params));
+            graph.finalize(common_params.target, config);
+            return true;
+        }
+
+        // Prefill runs the prompt into the KV cache, then every decode step runs the single token picked last
+        kv_cache        = std::make_shared<graph::KVCache>(d_model, common_params.input_len + common_params.generate);
+        config.kv_cache = kv_cache;
 
+        // Both graphs have the same topology, the decode graph aliases the weights and reshaped weights of the prefill one
+        config.shared_consts = std::make_shared<graph::SharedConstTensors>();
+
+        add_model(graph, std::make_unique<GreedyTokenAccessor>(decode_state));
         graph.finalize(common_params.target, config);
 
+        std::unique_ptr<IPreprocessor> decode_preproccessor = std::make_unique<atoiPreprocessor>();
+        decode_graph << common_params.target << common_params.fast_math_hint;
+        decode_graph << InputLayer(TensorDescriptor(TensorShape(1U), DataType::U32),
+                                   std::make_unique<NextTokenAccessor>(decode_state),
+                                   get_segment_accessor(common_params.segment, move(decode_preproccessor)))
+                            .set_name("in1").set_target(Target::NEON);
+        add_model(decode_graph, std::make_unique<GreedyTokenAccessor>(decode_state));
+        decode_graph.finalize(common_params.target, config);
+
         return true;
     }
 
@@ -152,25 +196,116 @@ class GraphGPTExample : public Example
     {
         auto start_time = std::chrono::high_resolution_clock::now();
 
+        if(kv_cache != nullptr)
+        {
+            kv_cache->reset();
+            decode_state.generated.clear();
+            decode_state.remaining = 1;
+        }
+
         graph.run();
 
         auto   end_time  = std::chrono::high_resolution_clock::now();
         double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
         std::cout << "Run cost: " << cost_time << std::endl;
+
+        if(kv_cache != nullptr && common_params.generate > 1)
+        {
+            decode_state.remaining = common_params.generate - 1;
+
+            start_time = std::chrono::high_resolution_clock::now();
+            decode_graph.run();
+            end_time  = std::chrono::high_resolution_clock::now();
+            cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
+            std::cout << "Decode cost: " << cost_time << " (" << cost_time / (common_params.generate - 1) << " per token)" << std::endl;
+        }
+
+        if(kv_cache != nullptr)
+        {
+            std::cout << "Generated tokens:";
+            for(auto token : decode_state.generated)
+            {
+                std::cout << " " << token;
+            }
+            std::cout << std::endl;
+            if(tokenizer != nullptr)
+            {
+                std::cout << "Generated text: " << tokenizer->decode(decode_state.generated) << std::endl;
+            }
+        }
+
+        if(common_params.measure)
+        {
+            graph.profiler().export_csv(common_params.measure_file + ".csv");
+            graph.profiler().export_chrome_trace(common_params.measure_file + ".json");
+            graph.profiler().print_summary(std::cout);
+        }
     }
 
     private:
-    CommandLineParser  cmd_parser;
-    CommonGraphOptions common_opts;
-    CommonGraphParams  common_params;
-    Stream             graph;
+    CommandLineParser               cmd_parser;
+    CommonGraphOptions              common_opts;
+    CommonGraphParams               common_params;
+    Stream                          graph;
+    Stream                          decode_graph; /**< Aliases the const tensors of graph, so it is destroyed first */
+    GreedyDecodeState               decode_state;
+    std::shared_ptr<graph::KVCache> kv_cache;
+    std::shared_ptr<BPETokenizer>   tokenizer;
+
+    /** Adds the embedding, the decoder blocks and the vocabulary projection after the input layer of @p g */
+    void add_model(Stream &g, std::unique_ptr<graph::ITensorAccessor> output_accessor)
+    {
+        // Get trainable parameters data path
+        std::string data_path = common_params.data_path;
+
+        // Data layout
+        const DataLayout operation_layout = DataLayout::NCHW;
+
+        g << EmbeddingLayer(EmbeddingLayerInfo(d_model,
+                                                 d_vocab,
+                                                 d_segment,
+                                                 d_position,
+                                                 true /*Use pretrained positional encoding*/,
+                                                 ConvertPolicy::SATURATE,
+                                                 common_params.data_type),
+                              get_weights_accessor(data_path, "token_embedding.npy", operation_layout),
+                              // all zeroes for gpt2
+                              get_weights_accessor(data_path, "segment_embedding.npy", operation_layout),
+                              get_weights_accessor(data_path, "position_embedding.npy", operation_layout))
+                   .set_name("tkemb1").set_target(Target::NEON);
+
+        for(unsigned int layer = 0; layer < 12; ++layer)
+        {
+            add_decoder_block(g, data_path, "layer_" + std::to_string(layer) + "/" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
+        }
+
+        g << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("final_norm");
+
+        if(kv_cache != nullptr)
+        {
+            // Generation only needs the best token of the last row, the logits are never stored
+            g << TopKProjectionLayer(TopKProjectionLayerInfo(1U, TensorShape(d_model, d_vocab), TensorShape(d_vocab)),
+                                     get_weights_accessor(data_path, "projection_weight.npy"),
+                                     get_weights_accessor(data_path, "projection_bias.npy")).set_target(Target::NEON).set_name("vocab_projection");
+        }
+        else
+        {
+            g << LinearLayer(LinearLayerInfo(d_model, TensorShape(d_model, d_vocab),
+                                             TensorShape(d_vocab)),
+                             get_weights_accessor(data_path, "projection_weight.npy"),
+                             // just zeroes for gpt2
+                             get_weights_accessor(data_path, "projection_bias.npy")).set_target(Target::CL).set_name("vocab_projection");
+        }
+
+        g << OutputLayer(std::move(output_accessor)).set_name("out1").set_target(Target::NEON);
+    }
 
-    void add_decoder_block(std::string data_path, std::string layer_path,
+    void add_decoder_block(Stream &g, std::string data_path, std::string layer_path,
                            unsigned int d_model, unsigned int h, float eps, unsigned int d_ff)
     {
         ScaleDotProductionLayerInfo sdpa_info(d_model, h, true);
-        SubStream with_attention(graph);
-        SubStream without_attention(graph);
+        SubStream with_attention(g);
+        SubStream without_attention(g);
 
         with_attention << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_name("attention_norm").set_target(Target::NEON);
 
@@ -187,10 +322,10 @@ class GraphGPTExample : public Example
                             get_weights_accessor(data_path + layer_path, "attn_proj_weight.npy")).set_target(Target::CL).set_name("lin_attn");
 
         // add and norm
-        graph << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add, 1).set_name("add_4_norm_attention").set_target(Target::NEON)
+        g << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add, 1).set_name("add_4_norm_attention").set_target(Target::NEON);
 
-        SubStream without_ff(graph);
-        SubStream with_ff(graph);
+        SubStream without_ff(g);
+        SubStream with_ff(g);
 
         with_ff << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps)).set_target(Target::NEON).set_name("attn_add_norm");
 
@@ -204,7 +339,7 @@ class GraphGPTExample : public Example
                                get_weights_accessor(data_path + layer_path, "ff_weight_1.npy"),
                                get_weights_accessor(data_path + layer_path, "ff_bias_1.npy")).set_target(Target::CL).set_name("ff_1_linear");
 
-        graph << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add, 0)
+        g << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add, 0)
             .set_name("add_4_norm_ff").set_target(Target::NEON);
     }
 };
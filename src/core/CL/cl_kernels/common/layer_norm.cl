@@ -30,7 +30,11 @@
  * @param[in]  output_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
  * @param[in]  output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
  * @param[in]  output_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  gamma_ptr                            (Optional) Pointer to the per-channel scale. Only with -DHAS_GAMMA_BETA
+ * @param[in]  beta_ptr                             (Optional) Pointer to the per-channel offset. Only with -DHAS_GAMMA_BETA
  * @param[in]  epsilon                              Epsilon value
+ * @param[in]  gamma                                Scalar scale, used when -DHAS_GAMMA_BETA is not passed
+ * @param[in]  beta                                 Scalar offset, used when -DHAS_GAMMA_BETA is not passed
  */
  /*
 void layer_norm_fp32(const ITensor *src, ITensor *dst, const Window &window, float epsilon,
@@ -92,6 +96,10 @@ void layer_norm_fp32(const ITensor *src, ITensor *dst, const Window &window, flo
 */
 __kernel void layer_norm(TENSOR3D_DECLARATION(input),
                          TENSOR3D_DECLARATION(output),
+#if defined(HAS_GAMMA_BETA)
+                         VECTOR_DECLARATION(gamma),
+                         VECTOR_DECLARATION(beta),
+#endif // defined(HAS_GAMMA_BETA)
                          DATA_TYPE epsilon,
                          DATA_TYPE gamma,
                          DATA_TYPE beta)
@@ -150,8 +158,13 @@ __kernel void layer_norm(TENSOR3D_DECLARATION(input),
     var = var / WIDTH;
     sqrt_var_epsilon = sqrt(var + epsilon);
     VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) sqrt_var_epsilons = sqrt_var_epsilon;
+#if defined(HAS_GAMMA_BETA)
+    __global uchar *gamma_addr = gamma_ptr + gamma_offset_first_element_in_bytes;
+    __global uchar *beta_addr  = beta_ptr + beta_offset_first_element_in_bytes;
+#else  // defined(HAS_GAMMA_BETA)
     VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) gammas = gamma;
-    VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) betas = beta; 
+    VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) betas = beta;
+#endif // defined(HAS_GAMMA_BETA)
 
     x = 0;
 
@@ -159,6 +172,10 @@ __kernel void layer_norm(TENSOR3D_DECLARATION(input),
     for(; x <= (WIDTH - VEC_SIZE); x += VEC_SIZE)
     {
         VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) vals = VLOAD(VEC_SIZE)(0, (__global DATA_TYPE *)(input_addr + x * sizeof(DATA_TYPE)));
+#if defined(HAS_GAMMA_BETA)
+        VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) gammas = VLOAD(VEC_SIZE)(0, (__global DATA_TYPE *)(gamma_addr + x * gamma_stride_x));
+        VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE) betas  = VLOAD(VEC_SIZE)(0, (__global DATA_TYPE *)(beta_addr + x * beta_stride_x));
+#endif // defined(HAS_GAMMA_BETA)
         vals = vals - mean;
         vals = vals / sqrt_var_epsilons;
         vals = vals * gammas;
@@ -171,6 +188,10 @@ __kernel void layer_norm(TENSOR3D_DECLARATION(input),
     for(; x < WIDTH; ++x)
     {
         DATA_TYPE val = *((__global DATA_TYPE *)(input_addr + x * sizeof(DATA_TYPE)));
+#if defined(HAS_GAMMA_BETA)
+        DATA_TYPE gamma = *((__global DATA_TYPE *)(gamma_addr + x * gamma_stride_x));
+        DATA_TYPE beta  = *((__global DATA_TYPE *)(beta_addr + x * beta_stride_x));
+#endif // defined(HAS_GAMMA_BETA)
         val = val - mean;
         val = val / sqrt_var_epsilon;
         val = val * gamma;
@@ -310,6 +310,99 @@ struct lubrelu
     const ExactType valpha; /** Vector of alphas. */
     const ExactType vbeta;  /** Vector of betas. */
 };
+/** GELU activation object, erf based */
+template <typename T, int S>
+struct gelu
+{
+    /** SIMD vector type. */
+    using ExactType = typename wrapper::traits::neon_vector<T, S>::type;
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    /** Construct a GELU activation object.
+     *
+     * @param[in] act_info Activation layer information.
+     */
+    explicit gelu(ActivationLayerInfo act_info)
+        : vone(wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{})),
+          vhalf(wrapper::vdup_n(static_cast<T>(0.5f), ExactTagType{})),
+          vinv_sqrt_2(wrapper::vdup_n(static_cast<T>(0.70710678118f), ExactTagType{}))
+    {
+        ARM_COMPUTE_UNUSED(act_info);
+    }
+
+    /** Run activation function.
+     *
+     * @param[in] vval Vector of values.
+     */
+    void operator()(ExactType &vval)
+    {
+        vval = wrapper::vmul(vval,
+                             wrapper::vmul(vhalf, wrapper::vadd(vone, wrapper::verf(wrapper::vmul(vval, vinv_sqrt_2)))));
+    }
+
+    /** Run activation function.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        const float x = static_cast<float>(val);
+        val           = static_cast<T>(0.5f * x * (1.f + std::erf(x * 0.70710678118f)));
+    }
+
+    const ExactType vone;        /**< Vector of ones. */
+    const ExactType vhalf;       /**< Vector of halves. */
+    const ExactType vinv_sqrt_2; /**< Vector of 1 / sqrt(2). */
+};
+/** GELU activation object, tanh approximation */
+template <typename T, int S>
+struct gelu_tanh
+{
+    /** SIMD vector type. */
+    using ExactType = typename wrapper::traits::neon_vector<T, S>::type;
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    /** Construct a tanh approximated GELU activation object.
+     *
+     * @param[in] act_info Activation layer information.
+     */
+    explicit gelu_tanh(ActivationLayerInfo act_info)
+        : vone(wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{})),
+          vhalf(wrapper::vdup_n(static_cast<T>(0.5f), ExactTagType{})),
+          vsqrt_2_over_pi(wrapper::vdup_n(static_cast<T>(0.79788456080f), ExactTagType{})),
+          vcubic(wrapper::vdup_n(static_cast<T>(0.044715f), ExactTagType{}))
+    {
+        ARM_COMPUTE_UNUSED(act_info);
+    }
+
+    /** Run activation function.
+     *
+     * @param[in] vval Vector of values.
+     */
+    void operator()(ExactType &vval)
+    {
+        const ExactType x3    = wrapper::vmul(wrapper::vmul(vval, vval), vval);
+        const ExactType inner = wrapper::vmul(vsqrt_2_over_pi, wrapper::vmla(vval, vcubic, x3));
+        vval                  = wrapper::vmul(wrapper::vmul(vhalf, vval), wrapper::vadd(vone, wrapper::vtanh(inner)));
+    }
+
+    /** Run activation function.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        const float x = static_cast<float>(val);
+        val = static_cast<T>(0.5f * x * (1.f + std::tanh(0.79788456080f * (x + 0.044715f * x * x * x))));
+    }
+
+    const ExactType vone;            /**< Vector of ones. */
+    const ExactType vhalf;           /**< Vector of halves. */
+    const ExactType vsqrt_2_over_pi; /**< Vector of sqrt(2 / pi). */
+    const ExactType vcubic;          /**< Vector of the cubic coefficient. */
+};
 } // namespace detail
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_DETAIL_NEACTIVATION_FUNCTION_DETAIL_H */
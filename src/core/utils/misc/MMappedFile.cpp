@@ -76,10 +76,10 @@ MMappedFile::MMappedFile() : _filename(), _file_size(0), _map_size(0), _map_offs
 {
 }
 
-MMappedFile::MMappedFile(std::string filename, size_t size, size_t offset)
+MMappedFile::MMappedFile(std::string filename, size_t size, size_t offset, bool copy_on_write)
     : _filename(std::move(filename)), _file_size(0), _map_size(size), _map_offset(offset), _fp(nullptr), _data(nullptr)
 {
-    map(_filename, _map_size, _map_offset);
+    map(_filename, _map_size, _map_offset, copy_on_write);
 }
 
 MMappedFile::~MMappedFile()
@@ -87,7 +87,7 @@ MMappedFile::~MMappedFile()
     release();
 }
 
-bool MMappedFile::map(const std::string &filename, size_t size, size_t offset)
+bool MMappedFile::map(const std::string &filename, size_t size, size_t offset, bool copy_on_write)
 {
     // Check if file is mapped
     if (is_mapped())
@@ -96,7 +96,7 @@ bool MMappedFile::map(const std::string &filename, size_t size, size_t offset)
     }
 
     // Open file
-    _fp = fopen(filename.c_str(), "a+be");
+    _fp = fopen(filename.c_str(), copy_on_write ? "rbe" : "a+be");
     if (_fp == nullptr)
     {
         return false;
@@ -108,7 +108,7 @@ bool MMappedFile::map(const std::string &filename, size_t size, size_t offset)
     if (status)
     {
         // Get file size
-        std::tie(_file_size, status) = get_file_size(_filename);
+        std::tie(_file_size, status) = get_file_size(filename);
 
         if (status)
         {
@@ -129,8 +129,14 @@ bool MMappedFile::map(const std::string &filename, size_t size, size_t offset)
                     _map_size = _file_size - _map_offset;
                 }
 
-                // Perform mapping
-                _data = ::mmap(nullptr, _map_size, PROT_WRITE, MAP_SHARED, fd, _map_offset);
+                // Perform mapping, a private mapping only copies the pages written to
+                _data = copy_on_write ? ::mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, _map_offset)
+                                      : ::mmap(nullptr, _map_size, PROT_WRITE, MAP_SHARED, fd, _map_offset);
+                if (_data == MAP_FAILED)
+                {
+                    _data  = nullptr;
+                    status = false;
+                }
             }
         }
     }
@@ -138,6 +144,7 @@ bool MMappedFile::map(const std::string &filename, size_t size, size_t offset)
     if (!status)
     {
         fclose(_fp);
+        _fp = nullptr;
     }
 
     return status;
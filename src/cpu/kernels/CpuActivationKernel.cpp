@@ -34,8 +34,6 @@
 #include "src/cpu/kernels/activation/list.h"
 #include "src/cpu/kernels/logistic/list.h"
 
-#include "arm_compute/runtime/CL/CLTensor.h"
-
 #include <array>
 
 namespace arm_compute
@@ -376,21 +374,6 @@ void CpuActivationKernel::run_op(ITensorPack &tensors, const Window &window, con
     const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
     ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
 
-    ICLTensor *src_cl;
-    ICLTensor *dst_cl;
-    if(src->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *src_nc = const_cast<ITensor *>(src);
-        src_cl          = static_cast<ICLTensor *>(src_nc);
-        src_cl->map(CLScheduler::get().queue());
-    }
-
-    if(dst->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        dst_cl          = static_cast<ICLTensor *>(dst);
-        dst_cl->map(CLScheduler::get().queue());
-    }
-
     _run_method(src, dst, _act_info, window);
 }
 
@@ -33,8 +33,6 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/add/list.h"
 
-#include "arm_compute/runtime/CL/CLTensor.h"
-
 #include <array>
 
 #if defined(ENABLE_FP32_KERNELS)
@@ -208,34 +206,6 @@ void CpuAddKernel::run_op(ITensorPack &tensors, const Window &window, const Thre
     const ITensor *src1 = tensors.get_const_tensor(TensorType::ACL_SRC_1);
     ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
 
-    ICLTensor *src0_cl;
-    ICLTensor *src1_cl;
-    ICLTensor *dst_cl;
-    if(src0->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        std::cout << "src0 mapped" << std::endl;
-        ITensor *src0_nc = const_cast<ITensor *>(src0);
-        src0_cl          = static_cast<ICLTensor *>(src0_nc);
-        src0_cl->map(CLScheduler::get().queue());
-    }
-
-    if(src1->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-
-        std::cout << "src1 mapped" << std::endl;
-        ITensor *src1_nc = const_cast<ITensor *>(src1);
-        src1_cl          = static_cast<ICLTensor *>(src1_nc);
-        src1_cl->map(CLScheduler::get().queue());
-    }
-
-    if(dst->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-
-        std::cout << "dst mapped" << std::endl;
-        dst_cl = static_cast<ICLTensor *>(dst);
-        dst_cl->map(CLScheduler::get().queue());
-    }
-
     _run_method(src0, src1, dst, _policy, window);
 }
 
@@ -0,0 +1,117 @@
+#include "src/cpu/kernels/CpuAddLayerNormKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/CpuLayerNormKernel.h"
+#include "src/cpu/kernels/add_layer_norm/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuAddLayerNormKernel::AddLayerNormKernel> available_kernels = {
+    {"neon_fp32_add_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_add_layer_norm)},
+    {"neon_fp16_add_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_add_layer_norm)},
+};
+
+Status validate_arguments(const ITensorInfo        *src0,
+                          const ITensorInfo        *src1,
+                          const ITensorInfo        *gamma,
+                          const ITensorInfo        *beta,
+                          const ITensorInfo        *dst,
+                          const LayerNormLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src0, src1);
+
+    const auto uk = CpuAddLayerNormKernel::get_implementation(DataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // The normalization part has the same constraints as the standalone kernel
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuLayerNormKernel::validate(src0, gamma, beta, dst, info));
+
+    return Status{};
+}
+} // namespace
+
+void CpuAddLayerNormKernel::configure(const ITensorInfo *src0,
+                                      const ITensorInfo *src1,
+                                      const ITensorInfo *gamma,
+                                      const ITensorInfo *beta,
+                                      ITensorInfo       *dst,
+                                      LayerNormLayerInfo info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src0, src1, gamma, beta, dst, info));
+    ARM_COMPUTE_UNUSED(src1, gamma, beta);
+
+    const auto uk = CpuAddLayerNormKernel::get_implementation(DataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuAddLayerNormKernel").append("/").append(uk->name);
+
+    // Auto initialize if empty
+    auto_init_if_empty(*dst, *src0->clone());
+
+    // One window point per row, the ukernel walks the whole row
+    Window win = calculate_max_window(*src0, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuAddLayerNormKernel::validate(const ITensorInfo *src0,
+                                       const ITensorInfo *src1,
+                                       const ITensorInfo *gamma,
+                                       const ITensorInfo *beta,
+                                       const ITensorInfo *dst,
+                                       LayerNormLayerInfo info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src0, src1, gamma, beta, dst, info));
+    return Status{};
+}
+
+void CpuAddLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &thread_info)
+{
+    ARM_COMPUTE_UNUSED(thread_info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src0  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *src1  = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *gamma = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *beta  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src0, src1, gamma, beta, dst, _info, window);
+}
+
+const char *CpuAddLayerNormKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuAddLayerNormKernel::AddLayerNormKernel> &CpuAddLayerNormKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,88 @@
+#ifndef ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H
+#define ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H
+
+#include "src/core/common/Macros.h"
+
+#include "src/core/KernelTypes.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel to perform a residual add followed by layer normalization
+ *
+ * Computes LayerNorm(src0 + src1) along the innermost dimension in one sweep over the activations,
+ * the intermediate sum is never materialised outside of dst.
+ */
+class CpuAddLayerNormKernel : public ICpuKernel<CpuAddLayerNormKernel>
+{
+    private:
+    using AddLayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        ITensor *,
+                                                        const LayerNormLayerInfo &,
+                                                        const Window &)>::type;
+
+    public:
+    struct AddLayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        AddLayerNormKernelPtr        ukernel;
+    };
+
+    /* Default Constructor */
+    CpuAddLayerNormKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuAddLayerNormKernel);
+
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src0   First addend. Data type supported: F16/F32.
+     * @param[in]  src1   Second addend, same shape as @p src0. Data type supported: Same as @p src0.
+     * @param[in]  gamma  (Optional) Per-channel scale, shape (src0.dim0). Data type supported: Same as @p src0.
+     *                    If nullptr, @ref LayerNormLayerInfo::gamma() is used.
+     * @param[in]  beta   (Optional) Per-channel offset, shape (src0.dim0). Data type supported: Same as @p src0.
+     *                    If nullptr, @ref LayerNormLayerInfo::beta() is used.
+     * @param[out] dst    Output tensor. Data type supported: Same as @p src0.
+     * @param[in]  info   Layer normalization information. Only axis 0 is supported.
+     */
+    void configure(const ITensorInfo *src0,
+                   const ITensorInfo *src1,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *dst,
+                   LayerNormLayerInfo info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuAddLayerNormKernel
+     *
+     * Similar to CpuAddLayerNormKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src0,
+                           const ITensorInfo *src1,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *dst,
+                           LayerNormLayerInfo info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<AddLayerNormKernel> &get_available_kernels();
+
+    private:
+    LayerNormLayerInfo    _info{};
+    AddLayerNormKernelPtr _run_method{ nullptr };
+    std::string           _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H */
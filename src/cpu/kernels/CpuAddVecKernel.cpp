@@ -9,6 +9,7 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/add_vec/list.h"
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
 
 #include <array>
 
@@ -31,25 +32,29 @@ namespace
 static const std::vector<CpuAddVecKernel::AddKernel> available_kernels = {
     {"neon_fp32_add_vec", [](const CpuAddVecKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
      REGISTER_FP32_NEON(arm_compute::cpu::add_vec_fp32_neon)},
+    {"neon_fp16_add_vec", [](const CpuAddVecKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::add_vec_fp16_neon)},
     };
 
 Status
-validate_arguments(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst, ConvertPolicy policy)
+validate_arguments(const ITensorInfo &src0, const ITensorInfo *src1, const ITensorInfo &dst, ConvertPolicy policy, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(src0);
-    ARM_COMPUTE_UNUSED(src1);
     ARM_COMPUTE_UNUSED(dst);
     ARM_COMPUTE_UNUSED(policy);
-    
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_linear_activation_supported(act_info), "Activation not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src1 == nullptr && !act_info.enabled(), "Nothing to apply without a vector or an activation");
+
     return Status{};
 }
 } // namespace
 
-void CpuAddVecKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy)
+void CpuAddVecKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy,
+                                const ActivationLayerInfo &act_info, bool approximate_gelu)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src0, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src0, src1, *dst, policy, act_info));
     ARM_COMPUTE_UNUSED(src1);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src0, *src1, *dst, policy));
     
     _src0_target_dim = src0_target_dim;
     _src1_target_dim = src1_target_dim;
@@ -59,8 +64,10 @@ void CpuAddVecKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
 
-    _policy     = policy;
-    _run_method = uk->ukernel;
+    _policy           = policy;
+    _act_info         = act_info;
+    _approximate_gelu = approximate_gelu;
+    _run_method       = uk->ukernel;
     _name       = std::string("CpuAddVecKernel").append("/").append(uk->name);
 
     // Auto initialize dst if not initialized
@@ -77,13 +84,14 @@ void CpuAddVecKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1
 }
 
 Status
-CpuAddVecKernel::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy)
+CpuAddVecKernel::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy,
+                          const ActivationLayerInfo &act_info)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, dst);
     ARM_COMPUTE_UNUSED(src0_target_dim);
     ARM_COMPUTE_UNUSED(src1_target_dim);
 
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src0, *src1, *dst, policy));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src0, src1, *dst, policy, act_info));
 
     return Status{};
 }
@@ -101,7 +109,7 @@ void CpuAddVecKernel::run_op(ITensorPack &tensors, const Window &window, const T
     const ITensor *src1 = tensors.get_const_tensor(TensorType::ACL_SRC_1);
     ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
 
-    _run_method(src0, src1, dst, _src0_target_dim, _src1_target_dim, _policy, window);
+    _run_method(src0, src1, dst, _src0_target_dim, _src1_target_dim, _policy, _act_info, _approximate_gelu, window);
 }
 
 const char *CpuAddVecKernel::name() const
@@ -119,7 +127,8 @@ size_t CpuAddVecKernel::get_mws(const CPUInfo &platform, size_t thread_count) co
     ARM_COMPUTE_UNUSED(thread_count);
 
 #if defined(ENABLE_FP32_KERNELS)
-    if (this->_run_method == &add_vec_fp32_neon)
+    // The tuned sizes are for the plain addition
+    if (this->_run_method == &add_vec_fp32_neon && !_act_info.enabled())
     {
         size_t mws = ICPPKernel::default_mws;
         if (platform.get_cpu_model() == CPUModel::N1)
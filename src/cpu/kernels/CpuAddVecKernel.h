@@ -1,6 +1,8 @@
 #ifndef ARM_COMPUTE_CPU_ADD_VEC_KERNEL_H
 #define ARM_COMPUTE_CPU_ADD_VEC_KERNEL_H
 
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuKernel.h"
 
@@ -15,7 +17,7 @@ class CpuAddVecKernel : public ICpuKernel<CpuAddVecKernel>
 {
 private:
     using AddVecKernelPtr = std::add_pointer<void(
-        const ITensor *, const ITensor *, ITensor *, size_t , size_t, const ConvertPolicy &, const Window &)>::type;
+        const ITensor *, const ITensor *, ITensor *, size_t , size_t, const ConvertPolicy &, const ActivationLayerInfo &, bool, const Window &)>::type;
 
 public:
     struct AddKernel
@@ -42,12 +44,17 @@ public:
      *
      * @param[in]  src0             First input tensor info. Data types supported: U8/QASYMM8/QASYMM8_SIGNED/S16/QSYMM16/F16/S32/F32
      * @param[in]  src1             Second input tensor info, should be a vector. Data types supported: U8/QASYMM8/QASYMM8_SIGNED/S16/QSYMM16/F16/S32/F32
+     *                              Can be nullptr if @p act_info is enabled, only the activation is then applied to @p src0
      * @param[in]  src0_target_dim  Target dimension to be add for tensor src0.
      * @param[in]  src1_target_dim  Target dimension to be add for tensor src1.
      * @param[out] dst              The dst tensor info. Data types supported: U8/QASYMM8/QASYMM8_SIGNED/S16/QSYMM16/F16/S32/F32.
      * @param[in]  policy           Overflow policy.
+     * @param[in]  act_info         (Optional) Activation applied to the sums, F16/F32 only. Supported functions: RELU,
+     *                              BOUNDED_RELU, LU_BOUNDED_RELU and GELU.
+     * @param[in]  approximate_gelu (Optional) Whether GELU uses the tanh approximation.
      */
-    void configure(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy);
+    void configure(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool approximate_gelu = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to CpuAddVecKernel::configure()
@@ -55,7 +62,8 @@ public:
      * @return a status
      */
     static Status
-    validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy);
+    validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, size_t src0_target_dim, size_t src1_target_dim, ConvertPolicy policy,
+             const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -80,7 +88,9 @@ public:
 private:
     size_t          _src0_target_dim{Window::DimY};
     size_t          _src1_target_dim{Window::DimY};
-    ConvertPolicy   _policy{};
+    ConvertPolicy       _policy{};
+    ActivationLayerInfo _act_info{};
+    bool                _approximate_gelu{false};
     AddVecKernelPtr _run_method{nullptr};
     std::string     _name{};
     size_t          _split_dimension{Window::DimY};
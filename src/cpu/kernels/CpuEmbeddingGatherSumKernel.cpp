@@ -0,0 +1,141 @@
+#include "src/cpu/kernels/CpuEmbeddingGatherSumKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/embedding_gather_sum/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuEmbeddingGatherSumKernel::EmbeddingGatherSumKernel> available_kernels = {
+    {"neon_fp32_embedding_gather_sum", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_embedding_gather_sum)},
+    {"neon_fp16_embedding_gather_sum", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_embedding_gather_sum)},
+};
+
+Status validate_arguments(const ITensorInfo *tokens,
+                          const ITensorInfo *segments,
+                          const ITensorInfo *vocab,
+                          const ITensorInfo *segment_table,
+                          const ITensorInfo *position_table,
+                          const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(tokens, segments, vocab, segment_table, position_table, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(vocab);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vocab, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(vocab, segment_table, position_table);
+
+    const auto uk = CpuEmbeddingGatherSumKernel::get_implementation(DataTypeISASelectorData{vocab->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Ids are read as 32-bit unsigned integers
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tokens->element_size() != 4 || segments->element_size() != 4,
+                                    "Token and segment ids must be stored on 4 bytes");
+    ARM_COMPUTE_RETURN_ERROR_ON(segments->dimension(0) < tokens->dimension(0) || segments->dimension(1) < tokens->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tokens->num_dimensions() > 2, "Ids must be shaped (seq_len, batch)");
+
+    ARM_COMPUTE_RETURN_ERROR_ON(segment_table->dimension(0) != vocab->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(position_table->dimension(0) != vocab->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(position_table->dimension(1) < tokens->dimension(0),
+                                    "Sequence is longer than the position embedding table");
+
+    // Validate output if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(vocab, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != vocab->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != tokens->dimension(0) * tokens->dimension(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuEmbeddingGatherSumKernel::configure(const ITensorInfo *tokens,
+                                            const ITensorInfo *segments,
+                                            const ITensorInfo *vocab,
+                                            const ITensorInfo *segment_table,
+                                            const ITensorInfo *position_table,
+                                            ITensorInfo       *dst)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tokens, segments, vocab, segment_table, position_table, dst);
+
+    // Auto initialize if empty, a batch of sequences is flattened into consecutive rows
+    const TensorShape dst_shape(vocab->dimension(0), tokens->dimension(0) * tokens->dimension(1));
+    auto_init_if_empty(*dst, vocab->clone()->set_tensor_shape(dst_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(tokens, segments, vocab, segment_table, position_table, dst));
+    ARM_COMPUTE_UNUSED(segments, segment_table, position_table);
+
+    const auto uk = CpuEmbeddingGatherSumKernel::get_implementation(DataTypeISASelectorData{vocab->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuEmbeddingGatherSumKernel").append("/").append(uk->name);
+
+    // One window point per token, the ukernel walks the whole d_model row
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuEmbeddingGatherSumKernel::validate(const ITensorInfo *tokens,
+                                             const ITensorInfo *segments,
+                                             const ITensorInfo *vocab,
+                                             const ITensorInfo *segment_table,
+                                             const ITensorInfo *position_table,
+                                             const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(tokens, segments, vocab, segment_table, position_table, dst));
+    return Status{};
+}
+
+void CpuEmbeddingGatherSumKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *tokens         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *segments       = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *vocab          = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *segment_table  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *position_table = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    const ITensor *history        = tensors.get_const_tensor(TensorType::ACL_SRC_5);
+    ITensor       *dst            = tensors.get_tensor(TensorType::ACL_DST);
+
+    const uint32_t position_offset = (history != nullptr) ? static_cast<uint32_t>(history->info()->valid_region().shape.y()) : 0U;
+    ARM_COMPUTE_ERROR_ON_MSG(position_offset + tokens->info()->dimension(0) > position_table->info()->dimension(1),
+                             "Sequence is longer than the position embedding table");
+
+    _run_method(tokens, segments, vocab, segment_table, position_table, dst, position_offset, window);
+}
+
+const char *CpuEmbeddingGatherSumKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuEmbeddingGatherSumKernel::EmbeddingGatherSumKernel> &CpuEmbeddingGatherSumKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,89 @@
+#ifndef ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_KERNEL_H
+#define ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_KERNEL_H
+
+#include "src/core/common/Macros.h"
+
+#include "src/core/KernelTypes.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel to gather and sum the token, segment and position embeddings
+ *
+ * Replaces the token, segment and position lookups followed by two additions: every output row is written once,
+ * directly from the three embedding tables.
+ */
+class CpuEmbeddingGatherSumKernel : public ICpuKernel<CpuEmbeddingGatherSumKernel>
+{
+    private:
+    using EmbeddingGatherSumKernelPtr = std::add_pointer<void(const ITensor *,
+                                                              const ITensor *,
+                                                              const ITensor *,
+                                                              const ITensor *,
+                                                              const ITensor *,
+                                                              ITensor *,
+                                                              uint32_t,
+                                                              const Window &)>::type;
+
+    public:
+    struct EmbeddingGatherSumKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        EmbeddingGatherSumKernelPtr  ukernel;
+    };
+
+    /* Default Constructor */
+    CpuEmbeddingGatherSumKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuEmbeddingGatherSumKernel);
+
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  tokens         Token ids, shape (seq_len). 32-bit unsigned integers, any 4 byte data type.
+     * @param[in]  segments       Segment ids, shape (seq_len). Same storage as @p tokens.
+     * @param[in]  vocab          Vocabulary embedding table, shape (d_model, d_vocab). Data type supported: F16/F32.
+     * @param[in]  segment_table  Segment embedding table, shape (d_model, d_segment). Data type supported: Same as @p vocab.
+     * @param[in]  position_table Position embedding table, shape (d_model, d_position). Data type supported: Same as @p vocab.
+     * @param[out] dst            Output tensor, shape (d_model, seq_len). Data type supported: Same as @p vocab.
+     *
+     * @note When the pack given to run_op() holds a history tensor as ACL_SRC_5, positions start after its valid rows
+     *       so the tokens of a decode step are embedded at their absolute position.
+     */
+    void configure(const ITensorInfo *tokens,
+                   const ITensorInfo *segments,
+                   const ITensorInfo *vocab,
+                   const ITensorInfo *segment_table,
+                   const ITensorInfo *position_table,
+                   ITensorInfo       *dst);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuEmbeddingGatherSumKernel
+     *
+     * Similar to CpuEmbeddingGatherSumKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *tokens,
+                           const ITensorInfo *segments,
+                           const ITensorInfo *vocab,
+                           const ITensorInfo *segment_table,
+                           const ITensorInfo *position_table,
+                           const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<EmbeddingGatherSumKernel> &get_available_kernels();
+
+    private:
+    EmbeddingGatherSumKernelPtr _run_method{ nullptr };
+    std::string                 _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_KERNEL_H */
@@ -0,0 +1,138 @@
+#include "src/cpu/kernels/CpuFlashAttentionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/flash_attention/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuFlashAttentionKernel::FlashAttentionKernel> available_kernels = {
+    {"neon_fp32_flash_attention", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_flash_attention)},
+    {"neon_fp16_flash_attention", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_flash_attention)},
+};
+
+Status validate_arguments(const ITensorInfo                 *query,
+                          const ITensorInfo                 *key,
+                          const ITensorInfo                 *value,
+                          const ITensorInfo                 *dst,
+                          const ScaleDotProductionLayerInfo &info,
+                          const ITensorInfo                 *lengths)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(query, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON(query->dimension(0) != key->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(query->dimension(2) != key->dimension(2));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.h() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(0) % info.h() != 0, "d_model must be divisible by the number of heads");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(0) / info.h() > static_cast<size_t>(flash_attention_max_head_dim),
+                                    "Head dimension exceeds the fused attention accumulator size");
+
+    const auto uk = CpuFlashAttentionKernel::get_implementation(DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Batched sequences are packed along the rows, every sequence has the same padded length
+    if(lengths != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lengths, 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON(lengths->num_dimensions() > 1 || lengths->dimension(0) == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(1) % lengths->dimension(0) != 0 || key->dimension(1) != query->dimension(1),
+                                        "Rows must hold one padded sequence per length");
+    }
+
+    // Validate dst if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != query->dimension(0) || dst->dimension(1) != query->dimension(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuFlashAttentionKernel::configure(const ITensorInfo                 *query,
+                                        const ITensorInfo                 *key,
+                                        const ITensorInfo                 *value,
+                                        ITensorInfo                       *dst,
+                                        const ScaleDotProductionLayerInfo &info,
+                                        const ITensorInfo                 *lengths)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(query, key, value, dst, info, lengths));
+    ARM_COMPUTE_UNUSED(key, value, lengths);
+
+    const auto uk = CpuFlashAttentionKernel::get_implementation(DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuFlashAttentionKernel").append("/").append(uk->name);
+
+    // Auto initialize dst if not initialized
+    auto_init_if_empty(*dst, query->clone()->set_tensor_shape(query->tensor_shape()));
+
+    // Window is (head, query row, batch); every point produces one head of one context row
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, info.h(), 1));
+    win.set(Window::DimY, Window::Dimension(0, query->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, query->dimension(2), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuFlashAttentionKernel::validate(const ITensorInfo                 *query,
+                                         const ITensorInfo                 *key,
+                                         const ITensorInfo                 *value,
+                                         const ITensorInfo                 *dst,
+                                         const ScaleDotProductionLayerInfo &info,
+                                         const ITensorInfo                 *lengths)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(query, key, value, dst, info, lengths));
+    return Status{};
+}
+
+void CpuFlashAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *query   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *key     = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *value   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *lengths = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(query, key, value, dst, lengths, _info, window);
+}
+
+const char *CpuFlashAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuFlashAttentionKernel::FlashAttentionKernel> &CpuFlashAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
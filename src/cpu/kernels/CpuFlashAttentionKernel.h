@@ -0,0 +1,88 @@
+#ifndef ARM_COMPUTE_CPU_FLASH_ATTENTION_KERNEL_H
+#define ARM_COMPUTE_CPU_FLASH_ATTENTION_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the fused multi-head scale dot production attention kernel
+ *
+ * Computes softmax(Q * K^T / sqrt(d_head)) * V for every head without materialising the score matrix.
+ * Keys are visited in blocks and the softmax is accumulated online (running maximum and running sum),
+ * so the working set per query row is one block of scores plus one head of context.
+ * Causal and padding masks are applied by index comparison, masked keys are skipped entirely.
+ */
+class CpuFlashAttentionKernel : public ICpuKernel<CpuFlashAttentionKernel>
+{
+private:
+    using FlashAttentionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          ITensor *,
+                                                          const ITensor *,
+                                                          const ScaleDotProductionLayerInfo &,
+                                                          const Window &)>::type;
+
+public:
+    struct FlashAttentionKernel
+    {
+        const char                   *name;
+        const DataTypeISASelectorPtr  is_selected;
+        FlashAttentionKernelPtr       ukernel;
+    };
+
+    /* Default Constructor */
+    CpuFlashAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuFlashAttentionKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  query   Attention query tensor info, shape (d_model, seq_len). Data types supported: F32.
+     * @param[in]  key     Attention key tensor info, shape (d_model, seq_len). Data types supported: Same as @p query.
+     * @param[in]  value   Attention value tensor info, shape (d_model, seq_len). Data types supported: Same as @p query.
+     * @param[out] dst     Destination tensor info, shape (d_model, seq_len). Data types supported: Same as @p query.
+     * @param[in]  info    Scale dot production layer information.
+     * @param[in]  lengths (Optional) Valid length of each sequence when the rows hold a batch of padded sequences,
+     *                     shape (batch). Data types supported: U32.
+     */
+    void configure(const ITensorInfo                 *query,
+                   const ITensorInfo                 *key,
+                   const ITensorInfo                 *value,
+                   ITensorInfo                       *dst,
+                   const ScaleDotProductionLayerInfo &info,
+                   const ITensorInfo                 *lengths = nullptr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuFlashAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                 *query,
+                           const ITensorInfo                 *key,
+                           const ITensorInfo                 *value,
+                           const ITensorInfo                 *dst,
+                           const ScaleDotProductionLayerInfo &info,
+                           const ITensorInfo                 *lengths = nullptr);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<FlashAttentionKernel> &get_available_kernels();
+
+private:
+    ScaleDotProductionLayerInfo _info{};
+    FlashAttentionKernelPtr     _run_method{nullptr};
+    std::string                 _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_FLASH_ATTENTION_KERNEL_H */
@@ -1,15 +1,14 @@
 #include "src/cpu/kernels/CpuLayerNormKernel.h"
 
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Validate.h"
 
-#include "src/common/utils/Validate.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
-
-#include "src/core/NEON/wrapper/wrapper.h"
-
-#include "arm_compute/runtime/CL/CLTensor.h"
+#include "src/cpu/kernels/layer_norm/list.h"
 
 namespace arm_compute
 {
@@ -20,121 +19,107 @@ namespace kernels
 
 namespace
 {
-
-void layer_norm_fp32(const ITensor *src, ITensor *dst, const Window &window, float epsilon,
-                     float gamma,
-                     float beta,
-                     int   layer_axis)
+static const std::vector<CpuLayerNormKernel::LayerNormKernel> available_kernels = {
+    {"neon_fp32_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_layer_norm)},
+    {"neon_fp16_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_layer_norm)},
+};
+
+Status validate_arguments(const ITensorInfo        *input,
+                          const ITensorInfo        *gamma,
+                          const ITensorInfo        *beta,
+                          const ITensorInfo        *output,
+                          const LayerNormLayerInfo &info)
 {
-    const int  window_step_axis  = 1;
-    const auto window_start_axis = static_cast<int>(window[layer_axis].start());
-    const auto window_end_axis   = static_cast<int>(window[layer_axis].end());
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.axis() != 0, "Layer normalization is only supported along the innermost dimension");
 
-    Window win = window; //.collapse_if_possible(window, Window::DimZ)
-    win.set(layer_axis, Window::Dimension(0, 1, 1));
+    const auto uk = CpuLayerNormKernel::get_implementation(DataTypeISASelectorData{input->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
-    Iterator input(src, win);
-    Iterator output(dst, win);
-
-    execute_window_loop(
-        win,
-        [&](const Coordinates &)
+    for(const ITensorInfo *param : {gamma, beta})
+    {
+        if(param != nullptr)
         {
-            const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
-            const auto output_ptr = reinterpret_cast<float *>(output.ptr());
-            float      mean       = 0;
-            float      var        = 0;
-            float      res;
-
-            const int axis_len = window_end_axis - window_step_axis;
-            /* Calculate mean */
-            int axis = window_start_axis;
-            for(; axis <= axis_len; axis += window_step_axis)
-            {
-                mean += *(input_ptr + axis);
-            }
-            mean = mean / (axis_len + 1);
-
-            /* Calculate variance */
-            axis = window_start_axis;
-            for(; axis <= axis_len; axis += window_step_axis)
-            {
-                var += (*(input_ptr + axis) - mean) * (*(input_ptr + axis) - mean);
-            }
-            var = var / (axis_len + 1);
-
-            /* Calculate layer normalization */
-            axis = window_start_axis;
-            for(; axis <= axis_len; axis += window_step_axis)
-            {
-                res                                           = ((*(input_ptr + axis) - mean) / sqrt(var + epsilon)) * gamma + beta;
-                *reinterpret_cast<float *>(output_ptr + axis) = res;
-            }
-
-            ARM_COMPUTE_UNUSED(input_ptr);
-            ARM_COMPUTE_UNUSED(output_ptr);
-        },
-        input, output);
-}
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, param);
+            ARM_COMPUTE_RETURN_ERROR_ON(param->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(param->dimension(0) != input->dimension(0));
+        }
+    }
 
+    // Validate output if already configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+
+    return Status{};
+}
 } // namespace
 
 void CpuLayerNormKernel::configure(const ITensorInfo *input,
+                                   const ITensorInfo *gamma,
+                                   const ITensorInfo *beta,
                                    ITensorInfo       *output,
                                    LayerNormLayerInfo info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate(input, output, info));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input, gamma, beta, output, info));
+    ARM_COMPUTE_UNUSED(gamma, beta);
+
+    const auto uk = CpuLayerNormKernel::get_implementation(DataTypeISASelectorData{input->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
 
-    _info = info;
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLayerNormKernel").append("/").append(uk->name);
 
-    TensorShape out_shape = input->tensor_shape();
     // Auto initialize if empty
-    set_shape_if_empty(*output, out_shape);
-    set_data_type_if_unknown(*output, input->data_type());
+    auto_init_if_empty(*output, *input->clone());
 
+    // One window point per row, the ukernel walks the whole row
     Window win = calculate_max_window(*input, Steps());
-    ICPPKernel::configure(win);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
 }
 
 Status CpuLayerNormKernel::validate(const ITensorInfo *input,
+                                    const ITensorInfo *gamma,
+                                    const ITensorInfo *beta,
                                     const ITensorInfo *output,
                                     LayerNormLayerInfo info)
 {
-    ARM_COMPUTE_UNUSED(input);
-    ARM_COMPUTE_UNUSED(output);
-    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, gamma, beta, output, info));
     return Status{};
 }
 
 void CpuLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &thread_info)
 {
     ARM_COMPUTE_UNUSED(thread_info);
-    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
-    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
-
-    ICLTensor *src_cl;
-    ICLTensor *dst_cl;
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
 
-    if(src->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *src_nc = const_cast<ITensor *>(src);
-        src_cl          = static_cast<ICLTensor *>(src_nc);
-        src_cl->map(CLScheduler::get().queue());
-    }
+    const ITensor *src   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *gamma = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *beta  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
 
-    if(dst->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        dst_cl = static_cast<ICLTensor *>(dst);
-        dst_cl->map(CLScheduler::get().queue());
-    }
-
-    layer_norm_fp32(src, dst, window, _info.epsilon(), _info.gamma(), _info.beta(), _info.axis());
+    _run_method(src, gamma, beta, dst, _info, window);
 }
 
 const char *CpuLayerNormKernel::name() const
 {
-    return "NELayerNormLayerKernel";
+    return _name.c_str();
+}
+
+const std::vector<CpuLayerNormKernel::LayerNormKernel> &CpuLayerNormKernel::get_available_kernels()
+{
+    return available_kernels;
 }
 
 } // namespace kernels
@@ -12,40 +12,66 @@ namespace cpu
 {
 namespace kernels
 {
-/** Interface for the kernel to perform layer normalization */
+/** Interface for the kernel to perform layer normalization
+ *
+ * Normalizes every row along the innermost dimension. Mean and variance are computed in one Welford pass,
+ * gamma and beta are either per-channel tensors or the scalars held by @ref LayerNormLayerInfo.
+ */
 class CpuLayerNormKernel : public ICpuKernel<CpuLayerNormKernel>
 {
     private:
-    using LayerNormKernelPtr =
-        std::add_pointer<void(const ITensor *, ITensor *, const LayerNormLayerInfo &, const Window &)>::type;
+    using LayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     const LayerNormLayerInfo &,
+                                                     const Window &)>::type;
 
     public:
+    struct LayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormKernelPtr           ukernel;
+    };
+
     /* Default Constructor */
     CpuLayerNormKernel() = default;
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLayerNormKernel);
 
     /** Initialise the kernel's inputs and output
      *
-     * @param[in]  input1 An input tensor. Data type supported: f32.
-     * @param[out] output Output tensor. Data type supported: F32.
-     * @param[out] op     Logical operation to perform
+     * @param[in]  input  An input tensor. Data type supported: F16/F32.
+     * @param[in]  gamma  (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     *                    If nullptr, @ref LayerNormLayerInfo::gamma() is used.
+     * @param[in]  beta   (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
+     *                    If nullptr, @ref LayerNormLayerInfo::beta() is used.
+     * @param[out] output Output tensor. Data type supported: Same as @p input.
+     * @param[in]  info   Layer normalization information. Only axis 0 is supported.
      */
-    void configure(const ITensorInfo *input, ITensorInfo *output, LayerNormLayerInfo info);
+    void configure(const ITensorInfo *input,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *output,
+                   LayerNormLayerInfo info);
     /** Static function to check if given info will lead to a valid configuration of @ref CpuLayerNormKernel
      *
-     * @param[in] input An input tensor. Data type supported: F32.
-     * @param[in] output Output tensor. Data type supported: F32..
-     * @param[in] op     Logical operation to perform
+     * Similar to CpuLayerNormKernel::configure()
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *input, const ITensorInfo *output, LayerNormLayerInfo info);
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           LayerNormLayerInfo info);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
 
+    static const std::vector<LayerNormKernel> &get_available_kernels();
+
     private:
     LayerNormLayerInfo _info{};
     LayerNormKernelPtr _run_method{ nullptr };
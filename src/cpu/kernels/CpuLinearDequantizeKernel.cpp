@@ -0,0 +1,133 @@
+#include "src/cpu/kernels/CpuLinearDequantizeKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
+#include "src/cpu/kernels/linear_dequantize/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLinearDequantizeKernel::LinearDequantizeKernel> available_kernels = {
+    {"neon_fp32_linear_dequantize", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_linear_dequantize)},
+};
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *row_scales,
+                          const ITensorInfo         *channel_scales,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, row_scales, channel_scales, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(channel_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(row_scales->tensor_shape() != TensorShape(src->tensor_shape()).set(0, 1),
+                                    "One scale per row expected");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(channel_scales->tensor_shape().total_size() != src->dimension(0),
+                                    "One scale per output channel expected");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_linear_activation_supported(act_info), "Activation not supported");
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != src->dimension(0));
+    }
+
+    const auto uk = CpuLinearDequantizeKernel::get_implementation(DataTypeISASelectorData{DataType::F32, CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Validate dst if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuLinearDequantizeKernel::configure(const ITensorInfo         *src,
+                                          const ITensorInfo         *row_scales,
+                                          const ITensorInfo         *channel_scales,
+                                          const ITensorInfo         *bias,
+                                          ITensorInfo               *dst,
+                                          const ActivationLayerInfo &act_info,
+                                          bool                       approximate_gelu)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, row_scales, channel_scales, dst);
+
+    // Auto initialize dst if not initialized
+    auto_init_if_empty(*dst, TensorInfo(src->tensor_shape(), 1, DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, row_scales, channel_scales, bias, dst, act_info));
+    ARM_COMPUTE_UNUSED(row_scales, channel_scales, bias);
+
+    const auto uk = CpuLinearDequantizeKernel::get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _act_info         = act_info;
+    _approximate_gelu = approximate_gelu;
+    _run_method       = uk->ukernel;
+    _name             = std::string("CpuLinearDequantizeKernel").append("/").append(uk->name);
+
+    // Every window point dequantizes a whole row
+    Window win;
+    win.use_tensor_dimensions(src->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuLinearDequantizeKernel::validate(const ITensorInfo         *src,
+                                           const ITensorInfo         *row_scales,
+                                           const ITensorInfo         *channel_scales,
+                                           const ITensorInfo         *bias,
+                                           const ITensorInfo         *dst,
+                                           const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, row_scales, channel_scales, bias, dst, act_info));
+    return Status{};
+}
+
+void CpuLinearDequantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src            = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *row_scales     = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *channel_scales = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *bias           = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst            = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, row_scales, channel_scales, bias, dst, _act_info, _approximate_gelu, window);
+}
+
+const char *CpuLinearDequantizeKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuLinearDequantizeKernel::LinearDequantizeKernel> &CpuLinearDequantizeKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,84 @@
+#ifndef ARM_COMPUTE_CPU_LINEAR_DEQUANTIZE_KERNEL_H
+#define ARM_COMPUTE_CPU_LINEAR_DEQUANTIZE_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the output stage of a dynamically quantized linear layer
+ *
+ * Turns the S32 accumulators of an int8 GEMM back to floats with the scales of the input rows and of the output
+ * channels, and adds the bias in the same pass.
+ */
+class CpuLinearDequantizeKernel : public ICpuKernel<CpuLinearDequantizeKernel>
+{
+private:
+    using LinearDequantizeKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, const ITensor *, ITensor *, const ActivationLayerInfo &, bool, const Window &)>::type;
+
+public:
+    struct LinearDequantizeKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LinearDequantizeKernelPtr    ukernel;
+    };
+
+    /* Default Constructor */
+    CpuLinearDequantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLinearDequantizeKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src              Accumulators, shape (out_features, rows). Data types supported: S32.
+     * @param[in]  row_scales       Scale of every input row, shape of @p src with a dimension X of 1. Data types supported: F32.
+     * @param[in]  channel_scales   Scale of every output channel, out_features contiguous elements. Data types supported: F32.
+     * @param[in]  bias             Bias, shape (out_features). Can be nullptr. Data types supported: F32.
+     * @param[out] dst              Destination tensor info, same shape as @p src. Data types supported: F32.
+     * @param[in]  act_info         (Optional) Activation applied after the bias. Supported functions: RELU, BOUNDED_RELU,
+     *                              LU_BOUNDED_RELU and GELU.
+     * @param[in]  approximate_gelu (Optional) Whether GELU uses the tanh approximation.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *row_scales,
+                   const ITensorInfo         *channel_scales,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                   bool                       approximate_gelu = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLinearDequantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *row_scales,
+                           const ITensorInfo         *channel_scales,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<LinearDequantizeKernel> &get_available_kernels();
+
+private:
+    ActivationLayerInfo       _act_info{};
+    bool                      _approximate_gelu{false};
+    LinearDequantizeKernelPtr _run_method{nullptr};
+    std::string               _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_LINEAR_DEQUANTIZE_KERNEL_H */
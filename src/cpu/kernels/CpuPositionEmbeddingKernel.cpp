@@ -12,6 +12,7 @@
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <cmath>
+#include <cstring>
 
 namespace arm_compute
 {
@@ -22,8 +23,7 @@ namespace kernels
 
 namespace
 {
-/**  Vectorize pretrained position embedding*/
-template <typename T>
+/** Vectorize pretrained position embedding, rows are copied as they are stored so one routine serves every data type */
 void run_position_embedding(const Window &window, const ITensor *src, const ITensor *vector, ITensor *dst)
 {
     ARM_COMPUTE_UNUSED(src);
@@ -34,24 +34,20 @@ void run_position_embedding(const Window &window, const ITensor *src, const ITen
     const unsigned int window_start_x   = static_cast<unsigned int>(window.x().start());
     const unsigned int window_end_x     = static_cast<unsigned int>(window.x().end());
 
-    const unsigned int vector_depth     = vector->info()->tensor_shape().x();
-
-    unsigned int offset_vector,offset_dst;
+    const size_t row_bytes = vector->info()->tensor_shape().x() * vector->info()->element_size();
 
     Iterator dst_iter(dst,win);
     Iterator vector_iter(vector,win);
 
-    const auto dst_ptr      = reinterpret_cast<float *>(dst_iter.ptr());
-    const auto vector_ptr   = reinterpret_cast<float *>(vector_iter.ptr());
+    const auto dst_ptr      = dst_iter.ptr();
+    const auto vector_ptr   = vector_iter.ptr();
 
     execute_window_loop(win,
         [&](const Coordinates &)
         {
             for(unsigned int x = window_start_x; x < window_end_x; x++)
             {
-                offset_dst     = x * vector_depth;
-                offset_vector  = x * vector_depth;
-                std::memcpy(dst_ptr + offset_dst, vector_ptr + offset_vector, (vector_depth) * sizeof(*vector_ptr));            
+                std::memcpy(dst_ptr + x * row_bytes, vector_ptr + x * row_bytes, row_bytes);
             }
             
         },dst_iter,vector_iter);
@@ -75,9 +71,13 @@ void CpuPositionEmbeddingKernel::configure(const ITensorInfo *src, const ITensor
 
 Status CpuPositionEmbeddingKernel::validate(const ITensorInfo *src, const ITensorInfo *pos, const ITensorInfo *dst)
 {
-    ARM_COMPUTE_UNUSED(pos);
     ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(pos, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(pos, 1, DataType::F16, DataType::F32);
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(pos, dst);
+    }
 
     return Status{};
 }
@@ -90,7 +90,7 @@ void CpuPositionEmbeddingKernel::run_op(ITensorPack &tensors, const Window &wind
     const ITensor *pos   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
     auto dst = tensors.get_tensor(TensorType::ACL_DST);
 
-    run_position_embedding<float>(window, src, pos, dst);
+    run_position_embedding(window, src, pos, dst);
 }
 
 const char * CpuPositionEmbeddingKernel::name() const
@@ -0,0 +1,110 @@
+#include "src/cpu/kernels/CpuQuantizeRowsKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/quantize_rows/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuQuantizeRowsKernel::QuantizeRowsKernel> available_kernels = {
+    {"neon_fp32_quantize_rows", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_quantize_rows)},
+};
+
+TensorShape scales_shape(const ITensorInfo &src)
+{
+    return TensorShape(src.tensor_shape()).set(0, 1);
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+
+    const auto uk = CpuQuantizeRowsKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Validate outputs if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+    if(scales->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->tensor_shape() != scales_shape(*src), "One scale per row expected");
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuQuantizeRowsKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, scales);
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*dst, TensorInfo(src->tensor_shape(), 1, DataType::S8));
+    auto_init_if_empty(*scales, TensorInfo(scales_shape(*src), 1, DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, scales));
+
+    const auto uk = CpuQuantizeRowsKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuQuantizeRowsKernel").append("/").append(uk->name);
+
+    // Every window point quantizes a whole row
+    Window win;
+    win.use_tensor_dimensions(src->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuQuantizeRowsKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, scales));
+    return Status{};
+}
+
+void CpuQuantizeRowsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *scales = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, dst, scales, window);
+}
+
+const char *CpuQuantizeRowsKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuQuantizeRowsKernel::QuantizeRowsKernel> &CpuQuantizeRowsKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,66 @@
+#ifndef ARM_COMPUTE_CPU_QUANTIZE_ROWS_KERNEL_H
+#define ARM_COMPUTE_CPU_QUANTIZE_ROWS_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel quantizing every row of a tensor to 8 bits with its own scale
+ *
+ * Quantization is symmetric: q = round(x / scale) with scale = max|x| / 127 and a zero point of 0. Used on the
+ * activations of a dynamically quantized linear layer at every run and on its weights, one row per output channel,
+ * at prepare time.
+ */
+class CpuQuantizeRowsKernel : public ICpuKernel<CpuQuantizeRowsKernel>
+{
+private:
+    using QuantizeRowsKernelPtr = std::add_pointer<void(const ITensor *, ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    struct QuantizeRowsKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        QuantizeRowsKernelPtr        ukernel;
+    };
+
+    /* Default Constructor */
+    CpuQuantizeRowsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuQuantizeRowsKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src    Source tensor info. Data types supported: F32.
+     * @param[out] dst    Quantized tensor info, same shape as @p src. Data types supported: S8.
+     * @param[out] scales Scale of every row, shape of @p src with a dimension X of 1. Data types supported: F32.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuQuantizeRowsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<QuantizeRowsKernel> &get_available_kernels();
+
+private:
+    QuantizeRowsKernelPtr _run_method{nullptr};
+    std::string           _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_QUANTIZE_ROWS_KERNEL_H */
@@ -0,0 +1,100 @@
+#include "src/cpu/kernels/CpuScaleMaskSoftmaxKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/scale_mask_softmax/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuScaleMaskSoftmaxKernel::ScaleMaskSoftmaxKernel> available_kernels = {
+    {"neon_fp32_scale_mask_softmax", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_scale_mask_softmax)},
+    {"neon_fp16_scale_mask_softmax", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_scale_mask_softmax)},
+};
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, float scale)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(scale <= 0.f);
+
+    // Validate dst if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuScaleMaskSoftmaxKernel::configure(const ITensorInfo *src, ITensorInfo *dst, float scale, bool is_causal)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, scale));
+
+    const auto uk = CpuScaleMaskSoftmaxKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _scale      = scale;
+    _is_causal  = is_causal;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuScaleMaskSoftmaxKernel").append("/").append(uk->name);
+
+    // Auto initialize dst if not initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(src->tensor_shape()));
+
+    // Every row is processed as a whole, the kernel only iterates over Y and above
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuScaleMaskSoftmaxKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, float scale, bool is_causal)
+{
+    ARM_COMPUTE_UNUSED(is_causal);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, scale));
+    return Status{};
+}
+
+void CpuScaleMaskSoftmaxKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _scale, _is_causal, window);
+}
+
+const char *CpuScaleMaskSoftmaxKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuScaleMaskSoftmaxKernel::ScaleMaskSoftmaxKernel> &CpuScaleMaskSoftmaxKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
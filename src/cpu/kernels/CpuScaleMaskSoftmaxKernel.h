@@ -0,0 +1,66 @@
+#ifndef ARM_COMPUTE_CPU_SCALE_MASK_SOFTMAX_KERNEL_H
+#define ARM_COMPUTE_CPU_SCALE_MASK_SOFTMAX_KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel to scale, mask and softmax attention scores in a single pass
+ *
+ * The causal and padding masks are applied by comparing key and query indices, no additive mask tensor is used.
+ */
+class CpuScaleMaskSoftmaxKernel : public ICpuKernel<CpuScaleMaskSoftmaxKernel>
+{
+private:
+    using ScaleMaskSoftmaxKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, float, bool, const Window &)>::type;
+
+public:
+    struct ScaleMaskSoftmaxKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ScaleMaskSoftmaxKernelPtr    ukernel;
+    };
+
+    /* Default Constructor */
+    CpuScaleMaskSoftmaxKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuScaleMaskSoftmaxKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src       Attention scores tensor info, shape (num_keys, num_queries, heads). Data types supported: F32.
+     * @param[out] dst       Destination tensor info. Data types supported: Same as @p src.
+     * @param[in]  scale     Scale applied to the scores before the softmax.
+     * @param[in]  is_causal Whether query i may only attend keys up to i.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, float scale, bool is_causal);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuScaleMaskSoftmaxKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, float scale, bool is_causal);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<ScaleMaskSoftmaxKernel> &get_available_kernels();
+
+private:
+    float                     _scale{1.f};
+    bool                      _is_causal{false};
+    ScaleMaskSoftmaxKernelPtr _run_method{nullptr};
+    std::string               _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_SCALE_MASK_SOFTMAX_KERNEL_H */
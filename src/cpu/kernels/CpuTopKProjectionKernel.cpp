@@ -0,0 +1,139 @@
+#include "src/cpu/kernels/CpuTopKProjectionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/topk_projection/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuTopKProjectionKernel::TopKProjectionKernel> available_kernels = {
+    {"neon_fp32_topk_projection", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_topk_projection)},
+    {"neon_fp16_topk_projection", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_topk_projection)},
+};
+
+Status validate_arguments(const ITensorInfo             *src,
+                          const ITensorInfo             *weights,
+                          const ITensorInfo             *bias,
+                          const ITensorInfo             *dst,
+                          const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != weights->dimension(0),
+                                    "The number of input features must match the weights");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.k() == 0 || info.k() > static_cast<unsigned int>(topk_projection_max_k));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.k() > weights->dimension(1));
+    for(auto row : info.rows())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(row >= src->dimension(1), "Projected row is out of the input");
+    }
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != weights->dimension(1));
+    }
+
+    const auto uk = CpuTopKProjectionKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Validate dst if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != 2 || dst->dimension(1) != info.k());
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(2) != CpuTopKProjectionKernel::num_blocks(weights->dimension(1)));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != info.num_rows());
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuTopKProjectionKernel::configure(const ITensorInfo             *src,
+                                        const ITensorInfo             *weights,
+                                        const ITensorInfo             *bias,
+                                        ITensorInfo                   *dst,
+                                        const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+
+    // Auto initialize dst if not initialized
+    const unsigned int blocks = num_blocks(weights->dimension(1));
+    auto_init_if_empty(*dst, TensorInfo(TensorShape(2U, info.k(), blocks, info.num_rows()), 1, DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, bias, dst, info));
+    ARM_COMPUTE_UNUSED(bias);
+
+    const auto uk = CpuTopKProjectionKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuTopKProjectionKernel").append("/").append(uk->name);
+
+    // Window is (vocabulary block, projected row)
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, blocks, 1));
+    win.set(Window::DimY, Window::Dimension(0, info.num_rows(), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuTopKProjectionKernel::validate(const ITensorInfo             *src,
+                                         const ITensorInfo             *weights,
+                                         const ITensorInfo             *bias,
+                                         const ITensorInfo             *dst,
+                                         const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, bias, dst, info));
+    return Status{};
+}
+
+unsigned int CpuTopKProjectionKernel::num_blocks(unsigned int d_vocab)
+{
+    return (d_vocab + topk_projection_block_size - 1) / topk_projection_block_size;
+}
+
+void CpuTopKProjectionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *bias    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, weights, bias, dst, _info, window);
+}
+
+const char *CpuTopKProjectionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuTopKProjectionKernel::TopKProjectionKernel> &CpuTopKProjectionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
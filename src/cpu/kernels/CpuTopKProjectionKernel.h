@@ -0,0 +1,88 @@
+#ifndef ARM_COMPUTE_CPU_TOPK_PROJECTION_KERNEL_H
+#define ARM_COMPUTE_CPU_TOPK_PROJECTION_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the vocabulary projection kernel with a streaming top-k
+ *
+ * Projects only the selected input rows onto the vocabulary and keeps the best k (id, score) pairs of every block of
+ * vocabulary entries, so the logits are never written to memory.
+ */
+class CpuTopKProjectionKernel : public ICpuKernel<CpuTopKProjectionKernel>
+{
+private:
+    using TopKProjectionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          ITensor *,
+                                                          const TopKProjectionLayerInfo &,
+                                                          const Window &)>::type;
+
+public:
+    struct TopKProjectionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        TopKProjectionKernelPtr      ukernel;
+    };
+
+    /* Default Constructor */
+    CpuTopKProjectionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopKProjectionKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src     Input tensor info, shape (d_model, seq_len). Data types supported: F32.
+     * @param[in]  weights Weights tensor info, shape (d_model, d_vocab). Data types supported: Same as @p src.
+     * @param[in]  bias    Bias tensor info, shape (d_vocab). Can be nullptr. Data types supported: Same as @p src.
+     * @param[out] dst     Per-block candidates, shape (2, k, num_blocks, num_rows) holding (id, score) pairs. Data types supported: F32.
+     * @param[in]  info    Top-k projection layer information.
+     */
+    void configure(const ITensorInfo             *src,
+                   const ITensorInfo             *weights,
+                   const ITensorInfo             *bias,
+                   ITensorInfo                   *dst,
+                   const TopKProjectionLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuTopKProjectionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *src,
+                           const ITensorInfo             *weights,
+                           const ITensorInfo             *bias,
+                           const ITensorInfo             *dst,
+                           const TopKProjectionLayerInfo &info);
+    /** Number of vocabulary blocks scored independently
+     *
+     * @param[in] d_vocab Vocabulary size
+     *
+     * @return The number of blocks
+     */
+    static unsigned int num_blocks(unsigned int d_vocab);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<TopKProjectionKernel> &get_available_kernels();
+
+private:
+    TopKProjectionLayerInfo _info{};
+    TopKProjectionKernelPtr _run_method{nullptr};
+    std::string             _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_TOPK_PROJECTION_KERNEL_H */
@@ -3,6 +3,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
 
 #include "src/core/CPP/Validate.h"
 #include "src/core/common/Registrars.h"
@@ -24,6 +25,9 @@ static const std::vector<CpuVectorizeKernel::VectorizeKernel> available_kernels
     { "neon_vectorize_int_2_float32", [](const VectorizeKernelDataTypeISASelectorData &data)
       { return data.dt == DataType::F32; },
       REGISTER_FP32_NEON(arm_compute::cpu::neon_vectorize_int_2_float32) },
+    { "neon_vectorize_int_2_float16", [](const VectorizeKernelDataTypeISASelectorData &data)
+      { return data.dt == DataType::F16 && data.isa.fp16; },
+      REGISTER_FP16_NEON(arm_compute::cpu::neon_vectorize_int_2_float16) },
 
 };
 } // namespace
@@ -34,7 +38,7 @@ void CpuVectorizeKernel::configure(const ITensorInfo *src, const ITensorInfo *ve
     ARM_COMPUTE_ERROR_ON_NULLPTR(vector);
 
     const auto uk = CpuVectorizeKernel::get_implementation(
-        VectorizeKernelDataTypeISASelectorData{ dst->data_type(), CPUInfo::get().get_isa() });
+        VectorizeKernelDataTypeISASelectorData{ vector->data_type(), CPUInfo::get().get_isa() });
 
     // Configure output tensor info.
     const TensorShape dst_shape(vector->tensor_shape().x(), src->tensor_shape().x());
@@ -57,9 +61,10 @@ void CpuVectorizeKernel::configure(const ITensorInfo *src, const ITensorInfo *ve
 
 Status CpuVectorizeKernel::validate(const ITensorInfo *src, const ITensorInfo *vector, ITensorInfo *dst)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(vector);
-    ARM_COMPUTE_UNUSED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, vector, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(vector);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->element_size() != sizeof(uint32_t), "Ids must be stored on 4 bytes");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vector, 1, DataType::F16, DataType::F32);
     return Status{};
 }
 
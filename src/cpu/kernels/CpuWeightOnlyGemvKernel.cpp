@@ -0,0 +1,148 @@
+#include "src/cpu/kernels/CpuWeightOnlyGemvKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
+#include "src/cpu/kernels/weight_only_gemv/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuWeightOnlyGemvKernel::WeightOnlyGemvKernel> available_kernels = {
+    {"neon_fp32_weight_only_gemv", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_weight_only_gemv)},
+};
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *packed,
+                          const ITensorInfo         *scales,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          WeightOnlyQuantization     quantization,
+                          unsigned int               group_size,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, packed, scales, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(quantization == WeightOnlyQuantization::NONE, "No packed format requested");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_size == 0 || group_size % 16 != 0, "Group size must be a multiple of 16");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % group_size != 0,
+                                    "The number of input features must be a multiple of the group size");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_linear_activation_supported(act_info), "Activation not supported");
+
+    const bool is_int4 = quantization == WeightOnlyQuantization::INT4;
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(packed, 1, is_int4 ? DataType::U8 : DataType::S8);
+    ARM_COMPUTE_RETURN_ERROR_ON(packed->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(packed->dimension(0) * (is_int4 ? 2 : 1) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(scales->dimension(0) != src->dimension(0) / group_size);
+    ARM_COMPUTE_RETURN_ERROR_ON(scales->dimension(1) != packed->dimension(1));
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != packed->dimension(1));
+    }
+
+    const auto uk = CpuWeightOnlyGemvKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Validate dst if already configured
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != packed->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->tensor_shape().total_size_upper(1) != src->tensor_shape().total_size_upper(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuWeightOnlyGemvKernel::configure(const ITensorInfo         *src,
+                                        const ITensorInfo         *packed,
+                                        const ITensorInfo         *scales,
+                                        const ITensorInfo         *bias,
+                                        ITensorInfo               *dst,
+                                        WeightOnlyQuantization     quantization,
+                                        unsigned int               group_size,
+                                        const ActivationLayerInfo &act_info,
+                                        bool                       approximate_gelu)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, packed, scales, dst);
+
+    // Auto initialize dst if not initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(TensorShape(src->tensor_shape()).set(0, packed->dimension(1))));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, packed, scales, bias, dst, quantization, group_size, act_info));
+    ARM_COMPUTE_UNUSED(scales, bias);
+
+    const auto uk = CpuWeightOnlyGemvKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _quantization     = quantization;
+    _group_size       = group_size;
+    _act_info         = act_info;
+    _approximate_gelu = approximate_gelu;
+    _run_method       = uk->ukernel;
+    _name             = std::string("CpuWeightOnlyGemvKernel").append("/").append(uk->name);
+
+    // Every window point is one output channel of one row, rows are collapsed
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, static_cast<int>(packed->dimension(1)), 1));
+    win.set(Window::DimY, Window::Dimension(0, static_cast<int>(src->tensor_shape().total_size_upper(1)), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuWeightOnlyGemvKernel::validate(const ITensorInfo         *src,
+                                         const ITensorInfo         *packed,
+                                         const ITensorInfo         *scales,
+                                         const ITensorInfo         *bias,
+                                         const ITensorInfo         *dst,
+                                         WeightOnlyQuantization     quantization,
+                                         unsigned int               group_size,
+                                         const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, packed, scales, bias, dst, quantization, group_size, act_info));
+    return Status{};
+}
+
+void CpuWeightOnlyGemvKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *scales = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *bias   = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, packed, scales, bias, dst, _quantization, _group_size, _act_info, _approximate_gelu, window);
+}
+
+const char *CpuWeightOnlyGemvKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuWeightOnlyGemvKernel::WeightOnlyGemvKernel> &CpuWeightOnlyGemvKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,100 @@
+#ifndef ARM_COMPUTE_CPU_WEIGHT_ONLY_GEMV_KERNEL_H
+#define ARM_COMPUTE_CPU_WEIGHT_ONLY_GEMV_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the product of input rows with weight-only quantized weights
+ *
+ * Reads the weights packed by @ref CpuWeightOnlyPackKernel and dequantizes them in registers, so the weights are
+ * streamed from memory at 8 or 4 bits each. Meant for single-row inputs, where the product is bound by the weights.
+ */
+class CpuWeightOnlyGemvKernel : public ICpuKernel<CpuWeightOnlyGemvKernel>
+{
+private:
+    using WeightOnlyGemvKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          ITensor *,
+                                                          WeightOnlyQuantization,
+                                                          unsigned int,
+                                                          const ActivationLayerInfo &,
+                                                          bool,
+                                                          const Window &)>::type;
+
+public:
+    struct WeightOnlyGemvKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        WeightOnlyGemvKernelPtr      ukernel;
+    };
+
+    /* Default Constructor */
+    CpuWeightOnlyGemvKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWeightOnlyGemvKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src              Input rows, shape (in_features, rows). Data types supported: F32.
+     * @param[in]  packed           Packed weights, see @ref CpuWeightOnlyPackKernel. Data types supported: S8 for INT8, U8 for INT4.
+     * @param[in]  scales           Scale of every group, shape (in_features / group_size, out_features). Data types supported: F32.
+     * @param[in]  bias             Bias, shape (out_features). Can be nullptr. Data types supported: F32.
+     * @param[out] dst              Destination tensor info, shape (out_features, rows). Data types supported: F32.
+     * @param[in]  quantization     Packed format, INT8 or INT4.
+     * @param[in]  group_size       Number of consecutive input features sharing a scale, a multiple of 16 dividing in_features.
+     * @param[in]  act_info         (Optional) Activation applied after the bias. Supported functions: RELU, BOUNDED_RELU,
+     *                              LU_BOUNDED_RELU and GELU.
+     * @param[in]  approximate_gelu (Optional) Whether GELU uses the tanh approximation.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *packed,
+                   const ITensorInfo         *scales,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   WeightOnlyQuantization     quantization,
+                   unsigned int               group_size,
+                   const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                   bool                       approximate_gelu = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWeightOnlyGemvKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *packed,
+                           const ITensorInfo         *scales,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           WeightOnlyQuantization     quantization,
+                           unsigned int               group_size,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<WeightOnlyGemvKernel> &get_available_kernels();
+
+private:
+    WeightOnlyQuantization  _quantization{WeightOnlyQuantization::NONE};
+    unsigned int            _group_size{0};
+    ActivationLayerInfo     _act_info{};
+    bool                    _approximate_gelu{false};
+    WeightOnlyGemvKernelPtr _run_method{nullptr};
+    std::string             _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_WEIGHT_ONLY_GEMV_KERNEL_H */
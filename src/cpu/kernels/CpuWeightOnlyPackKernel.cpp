@@ -0,0 +1,137 @@
+#include "src/cpu/kernels/CpuWeightOnlyPackKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/weight_only_pack/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuWeightOnlyPackKernel::WeightOnlyPackKernel> available_kernels = {
+    {"neon_fp32_weight_only_pack", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_weight_only_pack)},
+};
+
+TensorInfo packed_info(const ITensorInfo &weights, WeightOnlyQuantization quantization)
+{
+    const bool is_int4 = quantization == WeightOnlyQuantization::INT4;
+    return TensorInfo(TensorShape(weights.dimension(0) / (is_int4 ? 2 : 1), weights.dimension(1)), 1,
+                      is_int4 ? DataType::U8 : DataType::S8);
+}
+
+TensorInfo scales_info(const ITensorInfo &weights, unsigned int group_size)
+{
+    return TensorInfo(TensorShape(weights.dimension(0) / group_size, weights.dimension(1)), 1, DataType::F32);
+}
+
+Status validate_arguments(const ITensorInfo     *weights,
+                          const ITensorInfo     *packed,
+                          const ITensorInfo     *scales,
+                          WeightOnlyQuantization quantization,
+                          unsigned int           group_size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights, packed, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(quantization == WeightOnlyQuantization::NONE, "No packed format requested");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_size == 0 || group_size % 16 != 0, "Group size must be a multiple of 16");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(0) % group_size != 0,
+                                    "The number of input features must be a multiple of the group size");
+
+    const auto uk = CpuWeightOnlyPackKernel::get_implementation(DataTypeISASelectorData{weights->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Validate outputs if already configured
+    if(packed->total_size() != 0)
+    {
+        const TensorInfo expected = packed_info(*weights, quantization);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(packed, &expected);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(packed, &expected);
+    }
+    if(scales->total_size() != 0)
+    {
+        const TensorInfo expected = scales_info(*weights, group_size);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scales, &expected);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(scales, &expected);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuWeightOnlyPackKernel::configure(const ITensorInfo     *weights,
+                                        ITensorInfo           *packed,
+                                        ITensorInfo           *scales,
+                                        WeightOnlyQuantization quantization,
+                                        unsigned int           group_size)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed, scales);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(weights, packed, scales, quantization, group_size));
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*packed, packed_info(*weights, quantization));
+    auto_init_if_empty(*scales, scales_info(*weights, group_size));
+
+    const auto uk = CpuWeightOnlyPackKernel::get_implementation(DataTypeISASelectorData{weights->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _quantization = quantization;
+    _group_size   = group_size;
+    _run_method   = uk->ukernel;
+    _name         = std::string("CpuWeightOnlyPackKernel").append("/").append(uk->name);
+
+    // Every window point packs a whole output channel
+    Window win;
+    win.use_tensor_dimensions(weights->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuWeightOnlyPackKernel::validate(const ITensorInfo     *weights,
+                                         const ITensorInfo     *packed,
+                                         const ITensorInfo     *scales,
+                                         WeightOnlyQuantization quantization,
+                                         unsigned int           group_size)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(weights, packed, scales, quantization, group_size));
+    return Status{};
+}
+
+void CpuWeightOnlyPackKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *packed  = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *scales  = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(weights, packed, scales, _quantization, _group_size, window);
+}
+
+const char *CpuWeightOnlyPackKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuWeightOnlyPackKernel::WeightOnlyPackKernel> &CpuWeightOnlyPackKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
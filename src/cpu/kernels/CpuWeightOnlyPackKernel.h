@@ -0,0 +1,79 @@
+#ifndef ARM_COMPUTE_CPU_WEIGHT_ONLY_PACK_KERNEL_H
+#define ARM_COMPUTE_CPU_WEIGHT_ONLY_PACK_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel packing linear weights to a weight-only quantized format
+ *
+ * Every output channel is split in groups of input features, each group is quantized symmetrically to 8 or 4 bits
+ * with its own scale. The packed weights are read by @ref CpuWeightOnlyGemvKernel.
+ */
+class CpuWeightOnlyPackKernel : public ICpuKernel<CpuWeightOnlyPackKernel>
+{
+private:
+    using WeightOnlyPackKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, WeightOnlyQuantization, unsigned int, const Window &)>::type;
+
+public:
+    struct WeightOnlyPackKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        WeightOnlyPackKernelPtr      ukernel;
+    };
+
+    /* Default Constructor */
+    CpuWeightOnlyPackKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWeightOnlyPackKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  weights      Weights tensor info, shape (in_features, out_features). Data types supported: F32.
+     * @param[out] packed       Packed weights, shape (in_features, out_features) for INT8 and (in_features / 2, out_features)
+     *                          for INT4. Data types supported: S8 for INT8, U8 for INT4.
+     * @param[out] scales       Scale of every group, shape (in_features / group_size, out_features). Data types supported: F32.
+     * @param[in]  quantization Packed format, INT8 or INT4.
+     * @param[in]  group_size   Number of consecutive input features sharing a scale, a multiple of 16 dividing in_features.
+     */
+    void configure(const ITensorInfo     *weights,
+                   ITensorInfo           *packed,
+                   ITensorInfo           *scales,
+                   WeightOnlyQuantization quantization,
+                   unsigned int           group_size);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWeightOnlyPackKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *weights,
+                           const ITensorInfo     *packed,
+                           const ITensorInfo     *scales,
+                           WeightOnlyQuantization quantization,
+                           unsigned int           group_size);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<WeightOnlyPackKernel> &get_available_kernels();
+
+private:
+    WeightOnlyQuantization  _quantization{WeightOnlyQuantization::NONE};
+    unsigned int            _group_size{0};
+    WeightOnlyPackKernelPtr _run_method{nullptr};
+    std::string             _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_WEIGHT_ONLY_PACK_KERNEL_H */
@@ -0,0 +1,20 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/add_layer_norm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_add_layer_norm(const ITensor            *src0,
+                              const ITensor            *src1,
+                              const ITensor            *gamma,
+                              const ITensor            *beta,
+                              ITensor                  *dst,
+                              const LayerNormLayerInfo &info,
+                              const Window             &window)
+{
+    return add_layer_norm_neon<float16_t>(src0, src1, gamma, beta, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -0,0 +1,18 @@
+#include "src/cpu/kernels/add_layer_norm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_add_layer_norm(const ITensor            *src0,
+                              const ITensor            *src1,
+                              const ITensor            *gamma,
+                              const ITensor            *beta,
+                              ITensor                  *dst,
+                              const LayerNormLayerInfo &info,
+                              const Window             &window)
+{
+    return add_layer_norm_neon<float>(src0, src1, gamma, beta, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
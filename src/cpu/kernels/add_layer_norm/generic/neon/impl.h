@@ -0,0 +1,70 @@
+#ifndef SRC_CPU_KERNELS_ADD_LAYER_NORM_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_ADD_LAYER_NORM_GENERIC_NEON_IMPL_H
+
+#include "src/cpu/kernels/layer_norm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Residual add followed by layer normalization along the innermost dimension
+ *
+ * Each window point is one row. The sum src0 + src1 is written to dst while its mean and variance are
+ * accumulated in the same Welford pass, the row is then normalized in place while it is still in cache.
+ * Neither the sum nor the inputs are read from memory twice.
+ */
+template <typename T>
+void add_layer_norm_neon(const ITensor            *src0,
+                         const ITensor            *src1,
+                         const ITensor            *gamma,
+                         const ITensor            *beta,
+                         ITensor                  *dst,
+                         const LayerNormLayerInfo &info,
+                         const Window             &window)
+{
+    const int len       = static_cast<int>(src0->info()->dimension(0));
+    const T  *gamma_ptr = layer_norm::param_ptr<T>(gamma);
+    const T  *beta_ptr  = layer_norm::param_ptr<T>(beta);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input0(src0, win);
+    Iterator input1(src1, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in0_row = reinterpret_cast<const T *>(input0.ptr());
+            const auto in1_row = reinterpret_cast<const T *>(input1.ptr());
+            const auto out_row = reinterpret_cast<T *>(output.ptr());
+
+            float mean = 0.f;
+            float var  = 0.f;
+            layer_norm::welford(
+                len,
+                [&](int x)
+                {
+                    const float32x4x2_t a = layer_norm::load8(in0_row + x);
+                    const float32x4x2_t b = layer_norm::load8(in1_row + x);
+                    const float32x4x2_t sum{{wrapper::vadd(a.val[0], b.val[0]), wrapper::vadd(a.val[1], b.val[1])}};
+                    layer_norm::store8(out_row + x, sum);
+                    return sum;
+                },
+                [&](int x)
+                {
+                    out_row[x] = static_cast<T>(static_cast<float>(in0_row[x]) + static_cast<float>(in1_row[x]));
+                    return static_cast<float>(out_row[x]);
+                },
+                mean, var);
+
+            const float rstd = 1.f / std::sqrt(var + info.epsilon());
+            layer_norm::normalize(out_row, out_row, len, mean, rstd, gamma_ptr, beta_ptr, info.gamma(), info.beta());
+        },
+        input0, input1, output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_ADD_LAYER_NORM_GENERIC_NEON_IMPL_H
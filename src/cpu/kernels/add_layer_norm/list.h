@@ -0,0 +1,23 @@
+#ifndef SRC_CPU_KERNELS_ADD_LAYER_NORM_LIST_H
+#define SRC_CPU_KERNELS_ADD_LAYER_NORM_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_ADD_LAYER_NORM_KERNEL(func_name)                                                     \
+    void func_name(const ITensor *src0, const ITensor *src1, const ITensor *gamma, const ITensor *beta, \
+                   ITensor *dst, const LayerNormLayerInfo &info, const Window &window)
+
+DECLARE_ADD_LAYER_NORM_KERNEL(neon_fp32_add_layer_norm);
+DECLARE_ADD_LAYER_NORM_KERNEL(neon_fp16_add_layer_norm);
+
+#undef DECLARE_ADD_LAYER_NORM_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_ADD_LAYER_NORM_LIST_H
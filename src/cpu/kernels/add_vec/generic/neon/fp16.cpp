@@ -0,0 +1,17 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/CpuTypes.h"
+#include "src/cpu/kernels/add_vec/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void add_vec_fp16_neon(
+    const ITensor *src0, const ITensor *src1, ITensor *dst, size_t src0_target_dim, size_t src1_target_dim, const ConvertPolicy &policy, const ActivationLayerInfo &act_info, bool approximate_gelu, const Window &window)
+{
+    add_vec_or_activation_neon<float16_t, 8>(src0, src1, dst, src0_target_dim, src1_target_dim, policy, act_info, approximate_gelu, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* (__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -5,9 +5,9 @@ namespace arm_compute
 namespace cpu
 {
 void add_vec_fp32_neon(
-    const ITensor *src0, const ITensor *src1, ITensor *dst, size_t src0_target_dim, size_t src1_target_dim, const ConvertPolicy &policy, const Window &window)
+    const ITensor *src0, const ITensor *src1, ITensor *dst, size_t src0_target_dim, size_t src1_target_dim, const ConvertPolicy &policy, const ActivationLayerInfo &act_info, bool approximate_gelu, const Window &window)
 {
-    return add_vec_same_neon<float>(src0, src1, dst, src0_target_dim, src1_target_dim, policy, window);
+    add_vec_or_activation_neon<float, 4>(src0, src1, dst, src0_target_dim, src1_target_dim, policy, act_info, approximate_gelu, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -8,14 +8,16 @@
 
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/helpers/Utils.h"
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
-template <typename ScalarType>
+/** Adds a vector along a dimension of @p src0, the activation functor @p act is applied to the sums before they are stored */
+template <typename ScalarType, typename Act>
 void add_vec_same_neon(
-    const ITensor *src0, const ITensor *src1, ITensor *dst, size_t src0_target_dim, size_t src1_target_dim, const ConvertPolicy &policy, const Window &window)
+    const ITensor *src0, const ITensor *src1, ITensor *dst, size_t src0_target_dim, size_t src1_target_dim, const ConvertPolicy &policy, Act act, const Window &window)
 {
 
     // Create input windows
@@ -54,23 +56,89 @@ void add_vec_same_neon(
             {
                 const auto val1 = wrapper::vloadq(input1_ptr + x);
                 const auto val2 = wrapper::vloadq(input2_ptr + x);
-                const auto res =
+                auto       res =
                     (policy == ConvertPolicy::SATURATE) ? wrapper::vqadd(val1, val2) : wrapper::vadd(val1, val2);
+                act(res);
                 wrapper::vstore(output_ptr + x, res);
-                
             }
             // Compute left-over elements
             for (; x < window_end_target0; ++x)
             {
                 const auto val1 = *(input1_ptr + x);
                 const auto val2 = *(input2_ptr + x);
-                *(output_ptr + x) =
-                    (policy == ConvertPolicy::SATURATE) ? wrapper::add_sat(val1, val2) : val1 + val2;
+                ScalarType res =
+                    (policy == ConvertPolicy::SATURATE) ? wrapper::add_sat(val1, val2) : static_cast<ScalarType>(val1 + val2);
+                act(res);
+                *(output_ptr + x) = res;
             }
         },
         input1, input2, output);
 }
 
+/** Applies the activation functor @p act to @p src0, the output stage of a linear layer without a bias */
+template <typename ScalarType, typename Act>
+void activation_same_neon(const ITensor *src0, ITensor *dst, size_t src0_target_dim, Act act, const Window &window)
+{
+    Window win = window;
+    win.set(src0_target_dim, Window::Dimension(0, 1, 1));
+
+    constexpr int window_step_target0  = 16 / sizeof(ScalarType);
+    const auto    window_start_target0 = static_cast<int>(window[src0_target_dim].start());
+    const auto    window_end_target0   = static_cast<int>(window[src0_target_dim].end());
+
+    Iterator input(src0, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto input_ptr  = reinterpret_cast<const ScalarType *>(input.ptr());
+            const auto output_ptr = reinterpret_cast<ScalarType *>(output.ptr());
+
+            int x = window_start_target0;
+            for (; x <= (window_end_target0 - window_step_target0); x += window_step_target0)
+            {
+                auto res = wrapper::vloadq(input_ptr + x);
+                act(res);
+                wrapper::vstore(output_ptr + x, res);
+            }
+            for (; x < window_end_target0; ++x)
+            {
+                ScalarType res = *(input_ptr + x);
+                act(res);
+                *(output_ptr + x) = res;
+            }
+        },
+        input, output);
+}
+
+/** Adds the vector @p src1 with @ref add_vec_same_neon, or only applies the activation if @p src1 is nullptr */
+template <typename ScalarType, int S>
+void add_vec_or_activation_neon(const ITensor             *src0,
+                                const ITensor             *src1,
+                                ITensor                   *dst,
+                                size_t                     src0_target_dim,
+                                size_t                     src1_target_dim,
+                                const ConvertPolicy       &policy,
+                                const ActivationLayerInfo &act_info,
+                                bool                       approximate_gelu,
+                                const Window              &window)
+{
+    dispatch_linear_activation<ScalarType, S>(act_info, approximate_gelu,
+                                              [&](auto act)
+                                              {
+                                                  if (src1 == nullptr)
+                                                  {
+                                                      activation_same_neon<ScalarType>(src0, dst, src0_target_dim, act, window);
+                                                  }
+                                                  else
+                                                  {
+                                                      add_vec_same_neon<ScalarType>(src0, src1, dst, src0_target_dim,
+                                                                                    src1_target_dim, policy, act, window);
+                                                  }
+                                              });
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif // SRC_CORE_NEON_KERNELS_ADD_IMPL_H
@@ -0,0 +1,21 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/embedding_gather_sum/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_embedding_gather_sum(const ITensor *tokens,
+                                    const ITensor *segments,
+                                    const ITensor *vocab,
+                                    const ITensor *segment_table,
+                                    const ITensor *position_table,
+                                    ITensor       *dst,
+                                    uint32_t       position_offset,
+                                    const Window  &window)
+{
+    return embedding_gather_sum_neon<float16_t>(tokens, segments, vocab, segment_table, position_table, dst, position_offset, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
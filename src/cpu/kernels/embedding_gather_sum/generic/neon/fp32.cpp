@@ -0,0 +1,19 @@
+#include "src/cpu/kernels/embedding_gather_sum/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_embedding_gather_sum(const ITensor *tokens,
+                                    const ITensor *segments,
+                                    const ITensor *vocab,
+                                    const ITensor *segment_table,
+                                    const ITensor *position_table,
+                                    ITensor       *dst,
+                                    uint32_t       position_offset,
+                                    const Window  &window)
+{
+    return embedding_gather_sum_neon<float>(tokens, segments, vocab, segment_table, position_table, dst, position_offset, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,109 @@
+#ifndef SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace embedding_gather_sum
+{
+/** Pointer to row @p row of a 2D embedding table */
+template <typename T>
+inline const T *table_row(const ITensor *table, uint32_t row)
+{
+    const ITensorInfo *info = table->info();
+    ARM_COMPUTE_ERROR_ON(row >= info->dimension(1));
+    return reinterpret_cast<const T *>(table->buffer() + info->offset_first_element_in_bytes() +
+                                       row * info->strides_in_bytes()[1]);
+}
+
+/** Token/segment ids are stored as 32-bit unsigned integers whatever the declared data type */
+inline const uint32_t *ids_ptr(const ITensor *ids)
+{
+    return reinterpret_cast<const uint32_t *>(ids->buffer() + ids->info()->offset_first_element_in_bytes());
+}
+
+/** Number of flattened ids up to the end of the valid region: every valid sequence but the last one is full */
+inline size_t valid_ids(const ITensorInfo *ids)
+{
+    const ValidRegion &valid = ids->valid_region();
+    const size_t       rows  = std::min(ids->dimension(1), valid.shape.y());
+    return (rows == 0) ? 0 : (rows - 1) * ids->dimension(0) + std::min(ids->dimension(0), valid.shape.x());
+}
+} // namespace embedding_gather_sum
+
+/** Gather and sum the token, segment and position embeddings
+ *
+ * Each window point along Y is one token: the vocabulary row of its token id, the segment row of its
+ * segment id and the position row of its index plus @p position_offset are added and written straight to the
+ * output row. Ids shaped (seq_len, batch) are flattened sequence after sequence, positions restart with every
+ * sequence. Tokens past the valid region of @p tokens are left untouched.
+ */
+template <typename T>
+void embedding_gather_sum_neon(const ITensor *tokens,
+                               const ITensor *segments,
+                               const ITensor *vocab,
+                               const ITensor *segment_table,
+                               const ITensor *position_table,
+                               ITensor       *dst,
+                               uint32_t       position_offset,
+                               const Window  &window)
+{
+    constexpr int window_step_x = 16 / sizeof(T);
+    const int     len           = static_cast<int>(dst->info()->dimension(0));
+    const int     seq_len       = static_cast<int>(tokens->info()->dimension(0));
+    const int     n_tokens      = static_cast<int>(embedding_gather_sum::valid_ids(tokens->info()));
+
+    const uint32_t *token_ids      = embedding_gather_sum::ids_ptr(tokens);
+    const uint32_t *segment_ids    = embedding_gather_sum::ids_ptr(segments);
+    const size_t    token_stride   = tokens->info()->strides_in_bytes()[1] / sizeof(uint32_t);
+    const size_t    segment_stride = segments->info()->strides_in_bytes()[1] / sizeof(uint32_t);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const int t = id.y();
+            if(t >= n_tokens)
+            {
+                return;
+            }
+
+            const int  pos      = t % seq_len;
+            const int  sequence = t / seq_len;
+            const T   *v_row    = embedding_gather_sum::table_row<T>(vocab, token_ids[sequence * token_stride + pos]);
+            const T   *s_row    = embedding_gather_sum::table_row<T>(segment_table, segment_ids[sequence * segment_stride + pos]);
+            const T   *p_row    = embedding_gather_sum::table_row<T>(position_table, position_offset + static_cast<uint32_t>(pos));
+            const auto out_row  = reinterpret_cast<T *>(output.ptr());
+
+            int x = 0;
+            for(; x <= (len - window_step_x); x += window_step_x)
+            {
+                const auto vs = wrapper::vadd(wrapper::vloadq(v_row + x), wrapper::vloadq(s_row + x));
+                wrapper::vstore(out_row + x, wrapper::vadd(vs, wrapper::vloadq(p_row + x)));
+            }
+            for(; x < len; ++x)
+            {
+                out_row[x] = v_row[x] + s_row[x] + p_row[x];
+            }
+        },
+        output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_GENERIC_NEON_IMPL_H
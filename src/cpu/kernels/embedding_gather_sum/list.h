@@ -0,0 +1,24 @@
+#ifndef SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_LIST_H
+#define SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_EMBEDDING_GATHER_SUM_KERNEL(func_name)                                                \
+    void func_name(const ITensor *tokens, const ITensor *segments, const ITensor *vocab,              \
+                   const ITensor *segment_table, const ITensor *position_table, ITensor *dst, \
+                   uint32_t position_offset, const Window &window)
+
+DECLARE_EMBEDDING_GATHER_SUM_KERNEL(neon_fp32_embedding_gather_sum);
+DECLARE_EMBEDDING_GATHER_SUM_KERNEL(neon_fp16_embedding_gather_sum);
+
+#undef DECLARE_EMBEDDING_GATHER_SUM_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_EMBEDDING_GATHER_SUM_LIST_H
@@ -0,0 +1,20 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/flash_attention/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_flash_attention(const ITensor                     *query,
+                               const ITensor                     *key,
+                               const ITensor                     *value,
+                               ITensor                           *dst,
+                               const ITensor                     *lengths,
+                               const ScaleDotProductionLayerInfo &info,
+                               const Window                      &window)
+{
+    return flash_attention_neon<float16_t>(query, key, value, dst, lengths, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
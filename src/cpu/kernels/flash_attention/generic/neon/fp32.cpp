@@ -0,0 +1,18 @@
+#include "src/cpu/kernels/flash_attention/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_flash_attention(const ITensor                     *query,
+                               const ITensor                     *key,
+                               const ITensor                     *value,
+                               ITensor                           *dst,
+                               const ITensor                     *lengths,
+                               const ScaleDotProductionLayerInfo &info,
+                               const Window                      &window)
+{
+    return flash_attention_neon<float>(query, key, value, dst, lengths, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
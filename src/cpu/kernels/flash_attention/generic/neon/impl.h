@@ -0,0 +1,312 @@
+#ifndef SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of keys scored per online softmax step */
+constexpr int flash_attention_block_size = 64;
+/** Largest head dimension the per-thread accumulator is sized for */
+constexpr int flash_attention_max_head_dim = 256;
+
+namespace flash_attention
+{
+/** Horizontal sum of a float32x4_t */
+inline float reduce_add(const float32x4_t &v)
+{
+#if defined(__aarch64__)
+    return wrapper::vaddv(v);
+#else  // defined(__aarch64__)
+    float32x2_t tmp = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    tmp             = vpadd_f32(tmp, tmp);
+    return vget_lane_f32(tmp, 0);
+#endif // defined(__aarch64__)
+}
+
+/** Dot product of two contiguous rows of @p len elements */
+inline float dot(const float *a, const float *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for(; x <= (len - 8); x += 8)
+    {
+        acc0 = wrapper::vmla(acc0, wrapper::vloadq(a + x), wrapper::vloadq(b + x));
+        acc1 = wrapper::vmla(acc1, wrapper::vloadq(a + x + 4), wrapper::vloadq(b + x + 4));
+    }
+    for(; x <= (len - 4); x += 4)
+    {
+        acc0 = wrapper::vmla(acc0, wrapper::vloadq(a + x), wrapper::vloadq(b + x));
+    }
+
+    float res = reduce_add(wrapper::vadd(acc0, acc1));
+    for(; x < len; ++x)
+    {
+        res += a[x] * b[x];
+    }
+    return res;
+}
+
+/** acc = acc * factor */
+inline void rescale(float *acc, float factor, int len)
+{
+    const float32x4_t vfactor = vdupq_n_f32(factor);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        wrapper::vstore(acc + x, wrapper::vmul(wrapper::vloadq(acc + x), vfactor));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] *= factor;
+    }
+}
+
+/** acc = acc + p * row */
+inline void accumulate(float *acc, float p, const float *row, int len)
+{
+    const float32x4_t vp = vdupq_n_f32(p);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        wrapper::vstore(acc + x, wrapper::vmla(wrapper::vloadq(acc + x), wrapper::vloadq(row + x), vp));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] += p * row[x];
+    }
+}
+
+/** scores = exp(scores - max), returns the sum of the exponentiated scores */
+inline float exp_and_sum(float *scores, float max, int len)
+{
+    const float32x4_t vmax = vdupq_n_f32(max);
+    float32x4_t       vsum = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        const float32x4_t e = wrapper::vexpq(wrapper::vsub(wrapper::vloadq(scores + x), vmax));
+        wrapper::vstore(scores + x, e);
+        vsum = wrapper::vadd(vsum, e);
+    }
+
+    float sum = reduce_add(vsum);
+    for(; x < len; ++x)
+    {
+        scores[x] = std::exp(scores[x] - max);
+        sum += scores[x];
+    }
+    return sum;
+}
+
+/** dst = acc * factor */
+inline void store(float *dst, const float *acc, float factor, int len)
+{
+    const float32x4_t vfactor = vdupq_n_f32(factor);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        wrapper::vstore(dst + x, wrapper::vmul(wrapper::vloadq(acc + x), vfactor));
+    }
+    for(; x < len; ++x)
+    {
+        dst[x] = acc[x] * factor;
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+/** Dot product of two contiguous F16 rows, widened and accumulated in F32 */
+inline float dot(const float16_t *a, const float16_t *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for(; x <= (len - 8); x += 8)
+    {
+        const float16x8_t va = wrapper::vloadq(a + x);
+        const float16x8_t vb = wrapper::vloadq(b + x);
+        acc0 = wrapper::vmla(acc0, vcvt_f32_f16(vget_low_f16(va)), vcvt_f32_f16(vget_low_f16(vb)));
+        acc1 = wrapper::vmla(acc1, vcvt_f32_f16(vget_high_f16(va)), vcvt_f32_f16(vget_high_f16(vb)));
+    }
+
+    float res = reduce_add(wrapper::vadd(acc0, acc1));
+    for(; x < len; ++x)
+    {
+        res += static_cast<float>(a[x]) * static_cast<float>(b[x]);
+    }
+    return res;
+}
+
+/** acc = acc + p * row, with an F16 row */
+inline void accumulate(float *acc, float p, const float16_t *row, int len)
+{
+    const float32x4_t vp = vdupq_n_f32(p);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        wrapper::vstore(acc + x, wrapper::vmla(wrapper::vloadq(acc + x), vcvt_f32_f16(vld1_f16(row + x)), vp));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] += p * static_cast<float>(row[x]);
+    }
+}
+
+/** dst = acc * factor, narrowed to F16 */
+inline void store(float16_t *dst, const float *acc, float factor, int len)
+{
+    const float32x4_t vfactor = vdupq_n_f32(factor);
+
+    int x = 0;
+    for(; x <= (len - 4); x += 4)
+    {
+        vst1_f16(dst + x, vcvt_f16_f32(wrapper::vmul(wrapper::vloadq(acc + x), vfactor)));
+    }
+    for(; x < len; ++x)
+    {
+        dst[x] = static_cast<float16_t>(acc[x] * factor);
+    }
+}
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+} // namespace flash_attention
+
+/** Fused multi-head attention
+ *
+ * The execution window is (head, query row, batch). For each window point the context row of one head is
+ * computed by streaming over the keys in blocks of @ref flash_attention_block_size, so no score matrix is
+ * ever written to memory.
+ *
+ * Masking is resolved by index comparison: keys past the key valid region are padding, and with causal
+ * masking query row i only visits keys up to i + (valid_keys - valid_queries), so the queries always line up with
+ * the last keys, as they do when the keys are a cache holding the history. Masked keys are never scored.
+ *
+ * With @p lengths, the rows hold one padded sequence after the other and every sequence only attends over its own
+ * rows, up to its valid length. Padded query rows attend nothing and produce a zero context.
+ *
+ * Scores, softmax statistics and the context accumulator are kept in F32 whatever T is.
+ */
+template <typename T>
+void flash_attention_neon(const ITensor                     *query,
+                          const ITensor                     *key,
+                          const ITensor                     *value,
+                          ITensor                           *dst,
+                          const ITensor                     *lengths,
+                          const ScaleDotProductionLayerInfo &info,
+                          const Window                      &window)
+{
+    const int   num_seqs = (lengths != nullptr) ? static_cast<int>(lengths->info()->dimension(0)) : 1;
+    const int   head_dim = static_cast<int>(query->info()->dimension(0) / info.h());
+    const int   kv_len   = static_cast<int>(key->info()->dimension(1)) / num_seqs;
+    const int   kv_valid = std::min(kv_len, static_cast<int>(key->info()->valid_region().shape.y()));
+    const int   q_len    = static_cast<int>(query->info()->dimension(1)) / num_seqs;
+    const int   q_valid  = std::min(q_len, static_cast<int>(query->info()->valid_region().shape.y()));
+    const float scale    = 1.f / std::sqrt(static_cast<float>(head_dim));
+
+    const bool      is_causal   = info.is_masked();
+    const uint32_t *seq_lengths = (lengths != nullptr) ? reinterpret_cast<const uint32_t *>(lengths->buffer() +
+                                                                                            lengths->info()->offset_first_element_in_bytes())
+                                                       : nullptr;
+
+    const Strides &q_strides = query->info()->strides_in_bytes();
+    const Strides &k_strides = key->info()->strides_in_bytes();
+    const Strides &v_strides = value->info()->strides_in_bytes();
+    const Strides &d_strides = dst->info()->strides_in_bytes();
+
+    const uint8_t *q_base = query->buffer() + query->info()->offset_first_element_in_bytes();
+    const uint8_t *k_base = key->buffer() + key->info()->offset_first_element_in_bytes();
+    const uint8_t *v_base = value->buffer() + value->info()->offset_first_element_in_bytes();
+    uint8_t       *d_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    // Per-thread scratch, lives on the stack so a run never allocates
+    float acc[flash_attention_max_head_dim];
+    float scores[flash_attention_block_size];
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            const int    head     = id.x();
+                            const int    row      = id.y();
+                            const int    batch    = id.z();
+                            const size_t head_off = head * head_dim * sizeof(T);
+
+                            const int    seq      = row / q_len;
+                            const int    pos      = row - seq * q_len;
+
+                            const auto q_row = reinterpret_cast<const T *>(q_base + batch * q_strides[2] + row * q_strides[1] + head_off);
+                            const auto k_ptr = k_base + batch * k_strides[2] + seq * kv_len * k_strides[1] + head_off;
+                            const auto v_ptr = v_base + batch * v_strides[2] + seq * kv_len * v_strides[1] + head_off;
+                            const auto d_row = reinterpret_cast<T *>(d_base + batch * d_strides[2] + row * d_strides[1] + head_off);
+
+                            // Valid queries and keys of the sequence this row belongs to
+                            const int seq_q_valid  = (seq_lengths != nullptr) ? std::min(q_len, static_cast<int>(seq_lengths[seq])) : q_valid;
+                            const int seq_kv_valid = (seq_lengths != nullptr) ? std::min(kv_len, static_cast<int>(seq_lengths[seq])) : kv_valid;
+
+                            int row_kv_len = is_causal ? std::max(0, std::min(seq_kv_valid, pos + seq_kv_valid - seq_q_valid + 1)) : seq_kv_valid;
+                            if(seq_lengths != nullptr && pos >= seq_q_valid)
+                            {
+                                row_kv_len = 0;
+                            }
+
+                            float running_max = -std::numeric_limits<float>::infinity();
+                            float running_sum = 0.f;
+                            std::fill_n(acc, head_dim, 0.f);
+
+                            for(int kb = 0; kb < row_kv_len; kb += flash_attention_block_size)
+                            {
+                                const int block_len = std::min(flash_attention_block_size, row_kv_len - kb);
+
+                                // Scaled scores for this block of keys
+                                float block_max = -std::numeric_limits<float>::infinity();
+                                for(int j = 0; j < block_len; ++j)
+                                {
+                                    const auto k_row = reinterpret_cast<const T *>(k_ptr + (kb + j) * k_strides[1]);
+                                    scores[j]        = flash_attention::dot(q_row, k_row, head_dim) * scale;
+                                    block_max        = std::max(block_max, scores[j]);
+                                }
+
+                                // Online softmax: rebase the running statistics on the new maximum
+                                const float new_max = std::max(running_max, block_max);
+                                if(new_max != running_max)
+                                {
+                                    const float correction = std::exp(running_max - new_max);
+                                    running_sum *= correction;
+                                    flash_attention::rescale(acc, correction, head_dim);
+                                    running_max = new_max;
+                                }
+
+                                running_sum += flash_attention::exp_and_sum(scores, running_max, block_len);
+
+                                for(int j = 0; j < block_len; ++j)
+                                {
+                                    const auto v_row = reinterpret_cast<const T *>(v_ptr + (kb + j) * v_strides[1]);
+                                    flash_attention::accumulate(acc, scores[j], v_row, head_dim);
+                                }
+                            }
+
+                            // A fully masked row has no keys to attend and produces a zero context
+                            flash_attention::store(d_row, acc, (running_sum > 0.f) ? 1.f / running_sum : 0.f, head_dim);
+                        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
@@ -0,0 +1,19 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/layer_norm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_layer_norm(const ITensor            *src,
+                          const ITensor            *gamma,
+                          const ITensor            *beta,
+                          ITensor                  *dst,
+                          const LayerNormLayerInfo &info,
+                          const Window             &window)
+{
+    return layer_norm_neon<float16_t>(src, gamma, beta, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
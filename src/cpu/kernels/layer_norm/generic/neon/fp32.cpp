@@ -0,0 +1,17 @@
+#include "src/cpu/kernels/layer_norm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_layer_norm(const ITensor            *src,
+                          const ITensor            *gamma,
+                          const ITensor            *beta,
+                          ITensor                  *dst,
+                          const LayerNormLayerInfo &info,
+                          const Window             &window)
+{
+    return layer_norm_neon<float>(src, gamma, beta, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
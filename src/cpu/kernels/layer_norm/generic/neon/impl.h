@@ -0,0 +1,212 @@
+#ifndef SRC_CPU_KERNELS_LAYER_NORM_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_LAYER_NORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace layer_norm
+{
+/** Horizontal sum of a float32x4_t */
+inline float reduce_add(const float32x4_t &v)
+{
+#if defined(__aarch64__)
+    return wrapper::vaddv(v);
+#else  // defined(__aarch64__)
+    float32x2_t tmp = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    tmp             = vpadd_f32(tmp, tmp);
+    return vget_lane_f32(tmp, 0);
+#endif // defined(__aarch64__)
+}
+
+/** Load 8 elements widened to F32 */
+inline float32x4x2_t load8(const float *ptr)
+{
+    return {{wrapper::vloadq(ptr), wrapper::vloadq(ptr + 4)}};
+}
+
+/** Store 8 F32 elements */
+inline void store8(float *ptr, const float32x4x2_t &v)
+{
+    wrapper::vstore(ptr, v.val[0]);
+    wrapper::vstore(ptr + 4, v.val[1]);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+/** Load 8 F16 elements widened to F32 */
+inline float32x4x2_t load8(const float16_t *ptr)
+{
+    const float16x8_t v = wrapper::vloadq(ptr);
+    return {{vcvt_f32_f16(vget_low_f16(v)), vcvt_f32_f16(vget_high_f16(v))}};
+}
+
+/** Store 8 F32 elements narrowed to F16 */
+inline void store8(float16_t *ptr, const float32x4x2_t &v)
+{
+    const float16x8_t res = vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1]));
+    wrapper::vstore(ptr, res);
+}
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+/** Mean and variance of a row in a single Welford pass
+ *
+ * Eight lanes each run their own Welford recurrence over a strided subset of the row, the lane statistics
+ * are merged with the parallel variance formula and the tail is folded in element by element.
+ * Statistics are always accumulated in F32.
+ *
+ * @p load_vec(x) returns elements [x, x + 8) of the row and @p load_scalar(x) element x, so callers can
+ * produce the row on the fly (e.g. a residual sum) while it is being reduced.
+ */
+template <typename LoadVec, typename LoadScalar>
+inline void welford(int len, const LoadVec &load_vec, const LoadScalar &load_scalar, float &mean, float &var)
+{
+    float32x4_t mean0 = vdupq_n_f32(0.f);
+    float32x4_t mean1 = vdupq_n_f32(0.f);
+    float32x4_t m2_0  = vdupq_n_f32(0.f);
+    float32x4_t m2_1  = vdupq_n_f32(0.f);
+
+    int x      = 0;
+    int n_lane = 0;
+    for(; x <= (len - 8); x += 8)
+    {
+        ++n_lane;
+        const float32x4_t   inv_n = vdupq_n_f32(1.f / n_lane);
+        const float32x4x2_t v     = load_vec(x);
+
+        const float32x4_t d0 = wrapper::vsub(v.val[0], mean0);
+        const float32x4_t d1 = wrapper::vsub(v.val[1], mean1);
+        mean0                = wrapper::vmla(mean0, d0, inv_n);
+        mean1                = wrapper::vmla(mean1, d1, inv_n);
+        m2_0                 = wrapper::vmla(m2_0, d0, wrapper::vsub(v.val[0], mean0));
+        m2_1                 = wrapper::vmla(m2_1, d1, wrapper::vsub(v.val[1], mean1));
+    }
+
+    // Merge the lanes, all of them have seen n_lane elements
+    int   count = 8 * n_lane;
+    float m2    = 0.f;
+    mean        = 0.f;
+    if(n_lane > 0)
+    {
+        mean                    = reduce_add(wrapper::vadd(mean0, mean1)) / 8.f;
+        const float32x4_t vmean = vdupq_n_f32(mean);
+        const float32x4_t dm0   = wrapper::vsub(mean0, vmean);
+        const float32x4_t dm1   = wrapper::vsub(mean1, vmean);
+        const float32x4_t dm_sq = wrapper::vmla(wrapper::vmul(dm0, dm0), dm1, dm1);
+        m2 = reduce_add(wrapper::vadd(m2_0, m2_1)) + n_lane * reduce_add(dm_sq);
+    }
+
+    for(; x < len; ++x)
+    {
+        ++count;
+        const float val   = load_scalar(x);
+        const float delta = val - mean;
+        mean += delta / count;
+        m2 += delta * (val - mean);
+    }
+
+    var = m2 / len;
+}
+
+/** out_row = (in_row - mean) * rstd * gamma + beta, @p in_row and @p out_row may alias
+ *
+ * @p gamma_ptr and @p beta_ptr are per-channel vectors, the scalars @p gamma and @p beta are used when they are nullptr.
+ */
+template <typename T>
+inline void normalize(const T *in_row,
+                      T       *out_row,
+                      int      len,
+                      float    mean,
+                      float    rstd,
+                      const T *gamma_ptr,
+                      const T *beta_ptr,
+                      float    gamma,
+                      float    beta)
+{
+    const float32x4_t vmean  = vdupq_n_f32(mean);
+    const float32x4_t vrstd  = vdupq_n_f32(rstd);
+    const float32x4_t vgamma = vdupq_n_f32(gamma);
+    const float32x4_t vbeta  = vdupq_n_f32(beta);
+
+    int x = 0;
+    for(; x <= (len - 8); x += 8)
+    {
+        const float32x4x2_t v = load8(in_row + x);
+        const float32x4x2_t g = (gamma_ptr != nullptr) ? load8(gamma_ptr + x) : float32x4x2_t{{vgamma, vgamma}};
+        const float32x4x2_t b = (beta_ptr != nullptr) ? load8(beta_ptr + x) : float32x4x2_t{{vbeta, vbeta}};
+
+        float32x4x2_t res;
+        res.val[0] = wrapper::vmla(b.val[0], wrapper::vmul(wrapper::vsub(v.val[0], vmean), vrstd), g.val[0]);
+        res.val[1] = wrapper::vmla(b.val[1], wrapper::vmul(wrapper::vsub(v.val[1], vmean), vrstd), g.val[1]);
+        store8(out_row + x, res);
+    }
+    for(; x < len; ++x)
+    {
+        const float g = (gamma_ptr != nullptr) ? static_cast<float>(gamma_ptr[x]) : gamma;
+        const float b = (beta_ptr != nullptr) ? static_cast<float>(beta_ptr[x]) : beta;
+        out_row[x]    = static_cast<T>((static_cast<float>(in_row[x]) - mean) * rstd * g + b);
+    }
+}
+
+/** Pointer to the first element of an optional per-channel parameter, nullptr if absent */
+template <typename T>
+inline const T *param_ptr(const ITensor *param)
+{
+    return (param != nullptr) ? reinterpret_cast<const T *>(param->buffer() + param->info()->offset_first_element_in_bytes()) : nullptr;
+}
+} // namespace layer_norm
+
+/** Layer normalization along the innermost dimension
+ *
+ * Each window point is one row: mean and variance come from a single Welford pass, then
+ * dst = (src - mean) * rsqrt(var + epsilon) * gamma + beta is written in a second, fully vectorised pass.
+ * @p gamma and @p beta are per-channel vectors of the row length; when they are nullptr the scalar values
+ * carried by @p info are broadcast instead.
+ */
+template <typename T>
+void layer_norm_neon(const ITensor            *src,
+                     const ITensor            *gamma,
+                     const ITensor            *beta,
+                     ITensor                  *dst,
+                     const LayerNormLayerInfo &info,
+                     const Window             &window)
+{
+    const int len       = static_cast<int>(src->info()->dimension(0));
+    const T  *gamma_ptr = layer_norm::param_ptr<T>(gamma);
+    const T  *beta_ptr  = layer_norm::param_ptr<T>(beta);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in_row  = reinterpret_cast<const T *>(input.ptr());
+            const auto out_row = reinterpret_cast<T *>(output.ptr());
+
+            float mean = 0.f;
+            float var  = 0.f;
+            layer_norm::welford(
+                len, [&](int x) { return layer_norm::load8(in_row + x); },
+                [&](int x) { return static_cast<float>(in_row[x]); }, mean, var);
+
+            const float rstd = 1.f / std::sqrt(var + info.epsilon());
+            layer_norm::normalize(in_row, out_row, len, mean, rstd, gamma_ptr, beta_ptr, info.gamma(), info.beta());
+        },
+        input, output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_LAYER_NORM_GENERIC_NEON_IMPL_H
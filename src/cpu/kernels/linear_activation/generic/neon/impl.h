@@ -0,0 +1,71 @@
+#ifndef SRC_CPU_KERNELS_LINEAR_ACTIVATION_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_LINEAR_ACTIVATION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/NEON/kernels/detail/NEActivationFunctionDetail.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Whether @p act_info can be applied in the output stage of a linear layer */
+inline bool is_linear_activation_supported(const ActivationLayerInfo &act_info)
+{
+    if(!act_info.enabled())
+    {
+        return true;
+    }
+    switch(act_info.activation())
+    {
+        case ActivationFunction::IDENTITY:
+        case ActivationFunction::RELU:
+        case ActivationFunction::BOUNDED_RELU:
+        case ActivationFunction::LU_BOUNDED_RELU:
+        case ActivationFunction::GELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Calls @p fn with the activation functor of @p act_info
+ *
+ * The output stages are templated on the functor, so the activation is inlined in their loops. @p fn is called with
+ * @ref detail::dummy when no activation is set.
+ *
+ * @param[in] act_info         Activation to apply, one of @ref is_linear_activation_supported
+ * @param[in] approximate_gelu Whether GELU uses the tanh approximation
+ * @param[in] fn               Callable taking the functor by value
+ */
+template <typename T, int S, typename F>
+void dispatch_linear_activation(const ActivationLayerInfo &act_info, bool approximate_gelu, F &&fn)
+{
+    if(!act_info.enabled())
+    {
+        return fn(detail::dummy<T, S>(act_info));
+    }
+    switch(act_info.activation())
+    {
+        case ActivationFunction::IDENTITY:
+            return fn(detail::dummy<T, S>(act_info));
+        case ActivationFunction::RELU:
+            return fn(detail::relu<T, S>(act_info));
+        case ActivationFunction::BOUNDED_RELU:
+            return fn(detail::brelu<T, S>(act_info));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return fn(detail::lubrelu<T, S>(act_info));
+        case ActivationFunction::GELU:
+            if(approximate_gelu)
+            {
+                return fn(detail::gelu_tanh<T, S>(act_info));
+            }
+            return fn(detail::gelu<T, S>(act_info));
+        default:
+            ARM_COMPUTE_ERROR("Activation not supported in the output stage of a linear layer");
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_LINEAR_ACTIVATION_GENERIC_NEON_IMPL_H
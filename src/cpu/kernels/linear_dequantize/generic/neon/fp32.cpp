@@ -0,0 +1,20 @@
+#include "src/cpu/kernels/linear_dequantize/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_linear_dequantize(const ITensor             *src,
+                                 const ITensor             *row_scales,
+                                 const ITensor             *channel_scales,
+                                 const ITensor             *bias,
+                                 ITensor                   *dst,
+                                 const ActivationLayerInfo &act_info,
+                                 bool                       approximate_gelu,
+                                 const Window              &window)
+{
+    dispatch_linear_activation<float, 4>(act_info, approximate_gelu, [&](auto act)
+                                         { linear_dequantize_neon(src, row_scales, channel_scales, bias, dst, act, window); });
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,69 @@
+#ifndef SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Output stage of a linear layer run as an int8 GEMM
+ *
+ * The window iterates over the rows, dimension X is handled here. Every S32 accumulator is scaled by the scale of its
+ * input row and of its output channel, then the bias is added and the activation functor @p act applied:
+ * dst = act(acc * row_scale * channel_scale + bias). @p channel_scales and @p bias hold one contiguous element per
+ * output channel, @p bias can be nullptr.
+ */
+template <typename Act>
+void linear_dequantize_neon(const ITensor *src,
+                            const ITensor *row_scales,
+                            const ITensor *channel_scales,
+                            const ITensor *bias,
+                            ITensor       *dst,
+                            Act            act,
+                            const Window  &window)
+{
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    const auto c_ptr = reinterpret_cast<const float *>(channel_scales->buffer() + channel_scales->info()->offset_first_element_in_bytes());
+    const auto b_ptr = (bias != nullptr) ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Iterator in(src, window);
+    Iterator row_scale(row_scales, window);
+    Iterator out(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto  acc   = reinterpret_cast<const int32_t *>(in.ptr());
+            const auto  y     = reinterpret_cast<float *>(out.ptr());
+            const float scale = *reinterpret_cast<const float *>(row_scale.ptr());
+
+            int x = 0;
+            for(; x <= (len - 4); x += 4)
+            {
+                const float32x4_t vscale = vmulq_n_f32(vld1q_f32(c_ptr + x), scale);
+                const float32x4_t vbias  = (b_ptr != nullptr) ? vld1q_f32(b_ptr + x) : vdupq_n_f32(0.f);
+                float32x4_t       res    = vmlaq_f32(vbias, vcvtq_f32_s32(vld1q_s32(acc + x)), vscale);
+                act(res);
+                vst1q_f32(y + x, res);
+            }
+            for(; x < len; ++x)
+            {
+                float res = static_cast<float>(acc[x]) * scale * c_ptr[x] + ((b_ptr != nullptr) ? b_ptr[x] : 0.f);
+                act(res);
+                y[x] = res;
+            }
+        },
+        in, row_scale, out);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_GENERIC_NEON_IMPL_H
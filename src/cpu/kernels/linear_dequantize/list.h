@@ -0,0 +1,21 @@
+#ifndef SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_LIST_H
+#define SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_LIST_H
+
+#include "src/cpu/kernels/linear_dequantize/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_LINEAR_DEQUANTIZE_KERNEL(func_name)                                                        \
+    void func_name(const ITensor *src, const ITensor *row_scales, const ITensor *channel_scales, \
+                   const ITensor *bias, ITensor *dst, const ActivationLayerInfo &act_info, bool approximate_gelu, \
+                   const Window &window)
+
+DECLARE_LINEAR_DEQUANTIZE_KERNEL(neon_fp32_linear_dequantize);
+
+#undef DECLARE_LINEAR_DEQUANTIZE_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_LINEAR_DEQUANTIZE_LIST_H
@@ -0,0 +1,12 @@
+#include "src/cpu/kernels/quantize_rows/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_quantize_rows(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    return quantize_rows_neon(src, dst, scales, window);
+}
+} // namespace cpu
+} // namespace arm_compute
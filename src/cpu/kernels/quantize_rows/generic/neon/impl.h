@@ -0,0 +1,94 @@
+#ifndef SRC_CPU_KERNELS_QUANTIZE_ROWS_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_QUANTIZE_ROWS_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace quantize_rows
+{
+/** Rounds to the nearest integer, ties to even */
+inline int32x4_t round_to_s32(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vcvtnq_s32_f32(v);
+#else  //__aarch64__
+    return vcvtq_s32_f32(vroundq_rte_f32(v));
+#endif //__aarch64__
+}
+
+/** Largest magnitude of a contiguous row of @p len elements */
+inline float max_abs(const float *x, int len)
+{
+    float32x4_t vmax = vdupq_n_f32(0.f);
+
+    int i = 0;
+    for(; i <= (len - 4); i += 4)
+    {
+        vmax = vmaxq_f32(vmax, vabsq_f32(vld1q_f32(x + i)));
+    }
+    float32x2_t tmp = vpmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+    tmp             = vpmax_f32(tmp, tmp);
+    float res       = vget_lane_f32(tmp, 0);
+    for(; i < len; ++i)
+    {
+        res = std::max(res, std::abs(x[i]));
+    }
+    return res;
+}
+} // namespace quantize_rows
+
+/** Symmetric per-row quantization to 8 bits
+ *
+ * The window iterates over the rows, dimension X is handled here. Every row x is written as round(x / scale) with
+ * scale = max|x| / 127, so the quantized values lie in [-127, 127] and the zero point is 0. The scale of every row
+ * is written to @p scales, shaped as @p src with a single element along X. A row of zeros gets a scale of 0.
+ */
+inline void quantize_rows_neon(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    Iterator in(src, window);
+    Iterator out(dst, window);
+    Iterator scale(scales, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto x = reinterpret_cast<const float *>(in.ptr());
+            const auto q = reinterpret_cast<int8_t *>(out.ptr());
+
+            const float amax      = quantize_rows::max_abs(x, len);
+            const float inv_scale = (amax > 0.f) ? 127.f / amax : 0.f;
+            *reinterpret_cast<float *>(scale.ptr()) = amax / 127.f;
+
+            const float32x4_t vinv_scale = vdupq_n_f32(inv_scale);
+
+            int i = 0;
+            for(; i <= (len - 8); i += 8)
+            {
+                const int32x4_t lo = quantize_rows::round_to_s32(vmulq_f32(vld1q_f32(x + i), vinv_scale));
+                const int32x4_t hi = quantize_rows::round_to_s32(vmulq_f32(vld1q_f32(x + i + 4), vinv_scale));
+                vst1_s8(q + i, vqmovn_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+            }
+            for(; i < len; ++i)
+            {
+                q[i] = static_cast<int8_t>(std::nearbyint(x[i] * inv_scale));
+            }
+        },
+        in, out, scale);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_QUANTIZE_ROWS_GENERIC_NEON_IMPL_H
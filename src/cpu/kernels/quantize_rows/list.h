@@ -0,0 +1,19 @@
+#ifndef SRC_CPU_KERNELS_QUANTIZE_ROWS_LIST_H
+#define SRC_CPU_KERNELS_QUANTIZE_ROWS_LIST_H
+
+#include "src/cpu/kernels/quantize_rows/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_QUANTIZE_ROWS_KERNEL(func_name) \
+    void func_name(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+
+DECLARE_QUANTIZE_ROWS_KERNEL(neon_fp32_quantize_rows);
+
+#undef DECLARE_QUANTIZE_ROWS_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_QUANTIZE_ROWS_LIST_H
@@ -0,0 +1,14 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/scale_mask_softmax/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_scale_mask_softmax(const ITensor *src, ITensor *dst, float scale, bool is_causal, const Window &window)
+{
+    return scale_mask_softmax_neon<float16_t>(src, dst, scale, is_causal, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
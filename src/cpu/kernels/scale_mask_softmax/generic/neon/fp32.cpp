@@ -0,0 +1,12 @@
+#include "src/cpu/kernels/scale_mask_softmax/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_scale_mask_softmax(const ITensor *src, ITensor *dst, float scale, bool is_causal, const Window &window)
+{
+    return scale_mask_softmax_neon<float>(src, dst, scale, is_causal, window);
+}
+} // namespace cpu
+} // namespace arm_compute
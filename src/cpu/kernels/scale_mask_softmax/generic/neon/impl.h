@@ -0,0 +1,135 @@
+#ifndef SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace scale_mask_softmax
+{
+/** Load 4 elements widened to F32 */
+inline float32x4_t load4(const float *ptr)
+{
+    return wrapper::vloadq(ptr);
+}
+
+/** Store 4 F32 elements */
+inline void store4(float *ptr, const float32x4_t &v)
+{
+    wrapper::vstore(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+/** Load 4 F16 elements widened to F32 */
+inline float32x4_t load4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+/** Store 4 F32 elements narrowed to F16 */
+inline void store4(float16_t *ptr, const float32x4_t &v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+} // namespace scale_mask_softmax
+
+/** Row-wise softmax(scale * x) over the attention scores with the mask resolved by index comparison
+ *
+ * Rows run along X (keys) and are indexed by Y (queries). Only the first valid keys take part in the
+ * softmax: the key valid region width bounds the padding, and for causal masking query row i additionally
+ * sees keys up to i + (num_keys - num_queries). Masked positions are written as zero.
+ * The maximum, the exponentials and their sum are computed in F32 whatever T is.
+ */
+template <typename T>
+void scale_mask_softmax_neon(const ITensor *src, ITensor *dst, float scale, bool is_causal, const Window &window)
+{
+    const int row_len       = static_cast<int>(src->info()->dimension(0));
+    const int num_rows      = static_cast<int>(src->info()->dimension(1));
+    const int kv_valid      = std::min(row_len, static_cast<int>(src->info()->valid_region().shape.x()));
+    const int causal_offset = row_len - num_rows;
+
+    const float32x4_t vscale = vdupq_n_f32(scale);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto in_ptr  = reinterpret_cast<const T *>(input.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(output.ptr());
+
+            const int valid = is_causal ? std::max(0, std::min(kv_valid, id.y() + causal_offset + 1)) : kv_valid;
+
+            // Maximum over the unmasked keys
+            float       max  = -std::numeric_limits<float>::infinity();
+            float32x4_t vmax = vdupq_n_f32(max);
+            int         x    = 0;
+            for(; x <= (valid - 4); x += 4)
+            {
+                vmax = wrapper::vmax(vmax, scale_mask_softmax::load4(in_ptr + x));
+            }
+            float32x2_t carry_max = wrapper::vpmax(wrapper::vgethigh(vmax), wrapper::vgetlow(vmax));
+            carry_max             = wrapper::vpmax(carry_max, carry_max);
+            max                   = wrapper::vgetlane(carry_max, 0);
+            for(; x < valid; ++x)
+            {
+                max = std::max(max, static_cast<float>(in_ptr[x]));
+            }
+
+            // exp(scale * (x - max)) and its sum
+            const float32x4_t vmax_dup = vdupq_n_f32(max);
+            float32x4_t       vsum     = vdupq_n_f32(0.f);
+            x                          = 0;
+            for(; x <= (valid - 4); x += 4)
+            {
+                const float32x4_t e = wrapper::vexpq(wrapper::vmul(wrapper::vsub(scale_mask_softmax::load4(in_ptr + x), vmax_dup), vscale));
+                scale_mask_softmax::store4(out_ptr + x, e);
+                vsum = wrapper::vadd(vsum, e);
+            }
+            float32x2_t carry_sum = wrapper::vpadd(wrapper::vgethigh(vsum), wrapper::vgetlow(vsum));
+            carry_sum             = wrapper::vpadd(carry_sum, carry_sum);
+            float sum             = wrapper::vgetlane(carry_sum, 0);
+            for(; x < valid; ++x)
+            {
+                const float e = std::exp((static_cast<float>(in_ptr[x]) - max) * scale);
+                out_ptr[x]    = static_cast<T>(e);
+                sum += e;
+            }
+
+            // Normalize and clear the masked tail
+            const float       inv_sum  = (valid > 0) ? 1.f / sum : 0.f;
+            const float32x4_t vinv_sum = vdupq_n_f32(inv_sum);
+            x                          = 0;
+            for(; x <= (valid - 4); x += 4)
+            {
+                scale_mask_softmax::store4(out_ptr + x, wrapper::vmul(scale_mask_softmax::load4(out_ptr + x), vinv_sum));
+            }
+            for(; x < valid; ++x)
+            {
+                out_ptr[x] = static_cast<T>(static_cast<float>(out_ptr[x]) * inv_sum);
+            }
+            std::fill(out_ptr + valid, out_ptr + row_len, static_cast<T>(0));
+        },
+        input, output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_GENERIC_NEON_IMPL_H
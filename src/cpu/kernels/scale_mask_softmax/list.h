@@ -0,0 +1,20 @@
+#ifndef SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_LIST_H
+#define SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_LIST_H
+
+#include "src/cpu/kernels/scale_mask_softmax/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_SCALE_MASK_SOFTMAX_KERNEL(func_name) \
+    void func_name(const ITensor *src, ITensor *dst, float scale, bool is_causal, const Window &window)
+
+DECLARE_SCALE_MASK_SOFTMAX_KERNEL(neon_fp32_scale_mask_softmax);
+DECLARE_SCALE_MASK_SOFTMAX_KERNEL(neon_fp16_scale_mask_softmax);
+
+#undef DECLARE_SCALE_MASK_SOFTMAX_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_SCALE_MASK_SOFTMAX_LIST_H
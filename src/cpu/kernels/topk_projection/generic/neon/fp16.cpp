@@ -0,0 +1,19 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/topk_projection/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_topk_projection(const ITensor                 *src,
+                               const ITensor                 *weights,
+                               const ITensor                 *bias,
+                               ITensor                       *dst,
+                               const TopKProjectionLayerInfo &info,
+                               const Window                  &window)
+{
+    return topk_projection_neon<float16_t>(src, weights, bias, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -0,0 +1,17 @@
+#include "src/cpu/kernels/topk_projection/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_topk_projection(const ITensor                 *src,
+                               const ITensor                 *weights,
+                               const ITensor                 *bias,
+                               ITensor                       *dst,
+                               const TopKProjectionLayerInfo &info,
+                               const Window                  &window)
+{
+    return topk_projection_neon<float>(src, weights, bias, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,177 @@
+#ifndef SRC_CPU_KERNELS_TOPK_PROJECTION_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_TOPK_PROJECTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of vocabulary entries scored per window step */
+constexpr int topk_projection_block_size = 512;
+/** Largest k the per-thread candidate list is sized for */
+constexpr int topk_projection_max_k = 64;
+
+namespace topk_projection
+{
+/** Dot product of two contiguous rows of @p len elements */
+inline float dot(const float *a, const float *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    float32x4_t acc2 = vdupq_n_f32(0.f);
+    float32x4_t acc3 = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for(; x <= (len - 16); x += 16)
+    {
+        acc0 = wrapper::vmla(acc0, wrapper::vloadq(a + x), wrapper::vloadq(b + x));
+        acc1 = wrapper::vmla(acc1, wrapper::vloadq(a + x + 4), wrapper::vloadq(b + x + 4));
+        acc2 = wrapper::vmla(acc2, wrapper::vloadq(a + x + 8), wrapper::vloadq(b + x + 8));
+        acc3 = wrapper::vmla(acc3, wrapper::vloadq(a + x + 12), wrapper::vloadq(b + x + 12));
+    }
+    for(; x <= (len - 4); x += 4)
+    {
+        acc0 = wrapper::vmla(acc0, wrapper::vloadq(a + x), wrapper::vloadq(b + x));
+    }
+
+    const float32x4_t acc = wrapper::vadd(wrapper::vadd(acc0, acc1), wrapper::vadd(acc2, acc3));
+#if defined(__aarch64__)
+    float res = wrapper::vaddv(acc);
+#else  // defined(__aarch64__)
+    float32x2_t tmp = vadd_f32(vget_high_f32(acc), vget_low_f32(acc));
+    tmp             = vpadd_f32(tmp, tmp);
+    float res       = vget_lane_f32(tmp, 0);
+#endif // defined(__aarch64__)
+    for(; x < len; ++x)
+    {
+        res += a[x] * b[x];
+    }
+    return res;
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+/** Dot product of two contiguous F16 rows, widened and accumulated in F32 */
+inline float dot(const float16_t *a, const float16_t *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for(; x <= (len - 8); x += 8)
+    {
+        const float16x8_t va = wrapper::vloadq(a + x);
+        const float16x8_t vb = wrapper::vloadq(b + x);
+        acc0 = wrapper::vmla(acc0, vcvt_f32_f16(vget_low_f16(va)), vcvt_f32_f16(vget_low_f16(vb)));
+        acc1 = wrapper::vmla(acc1, vcvt_f32_f16(vget_high_f16(va)), vcvt_f32_f16(vget_high_f16(vb)));
+    }
+
+    const float32x4_t acc = wrapper::vadd(acc0, acc1);
+#if defined(__aarch64__)
+    float res = wrapper::vaddv(acc);
+#else  // defined(__aarch64__)
+    float32x2_t tmp = vadd_f32(vget_high_f32(acc), vget_low_f32(acc));
+    tmp             = vpadd_f32(tmp, tmp);
+    float res       = vget_lane_f32(tmp, 0);
+#endif // defined(__aarch64__)
+    for(; x < len; ++x)
+    {
+        res += static_cast<float>(a[x]) * static_cast<float>(b[x]);
+    }
+    return res;
+}
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+/** Candidate list kept sorted from the best to the worst score */
+struct Candidates
+{
+    float    score[topk_projection_max_k];
+    uint32_t id[topk_projection_max_k];
+    int      count{0};
+
+    /** Inserts a candidate if it beats the worst one kept, @p k is the list capacity */
+    void push(uint32_t candidate_id, float candidate_score, int k)
+    {
+        if(count == k && candidate_score <= score[count - 1])
+        {
+            return;
+        }
+        int pos = (count < k) ? count++ : count - 1;
+        for(; pos > 0 && score[pos - 1] < candidate_score; --pos)
+        {
+            score[pos] = score[pos - 1];
+            id[pos]    = id[pos - 1];
+        }
+        score[pos] = candidate_score;
+        id[pos]    = candidate_id;
+    }
+};
+} // namespace topk_projection
+
+/** Vocabulary projection with a streaming top-k
+ *
+ * The execution window is (vocabulary block, projected row). Each window point scores the vocabulary entries of one
+ * block of @ref topk_projection_block_size against one input row and writes the best k (id, score) pairs of the
+ * block to @p dst, shaped (2, k, num_blocks, num_rows). Logits are never stored, the blocks are merged afterwards.
+ * Unused pairs of a short block get a score of -inf. Scores are accumulated and written in F32 whatever T is.
+ */
+template <typename T>
+void topk_projection_neon(const ITensor                 *src,
+                          const ITensor                 *weights,
+                          const ITensor                 *bias,
+                          ITensor                       *dst,
+                          const TopKProjectionLayerInfo &info,
+                          const Window                  &window)
+{
+    const int d_model  = static_cast<int>(src->info()->dimension(0));
+    const int d_vocab  = static_cast<int>(weights->info()->dimension(1));
+    const int k        = static_cast<int>(info.k());
+    const int src_rows = static_cast<int>(std::min(src->info()->dimension(1), src->info()->valid_region().shape.y()));
+
+    const Strides &s_strides = src->info()->strides_in_bytes();
+    const Strides &w_strides = weights->info()->strides_in_bytes();
+
+    const uint8_t *s_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const uint8_t *w_base = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+    const T *b_ptr = (bias != nullptr) ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            const int block = id.x();
+                            const int r     = id.y();
+                            const int row   = info.rows().empty() ? src_rows - 1 : static_cast<int>(info.rows()[r]);
+                            ARM_COMPUTE_ERROR_ON(row < 0 || row >= static_cast<int>(src->info()->dimension(1)));
+
+                            const auto x_row = reinterpret_cast<const T *>(s_base + row * s_strides[1]);
+                            const int  begin = block * topk_projection_block_size;
+                            const int  end   = std::min(begin + topk_projection_block_size, d_vocab);
+
+                            topk_projection::Candidates best;
+                            for(int v = begin; v < end; ++v)
+                            {
+                                const auto w_row = reinterpret_cast<const T *>(w_base + v * w_strides[1]);
+                                const float score = topk_projection::dot(x_row, w_row, d_model) + ((b_ptr != nullptr) ? static_cast<float>(b_ptr[v]) : 0.f);
+                                best.push(static_cast<uint32_t>(v), score, k);
+                            }
+
+                            for(int i = 0; i < k; ++i)
+                            {
+                                const bool valid = i < best.count;
+                                *reinterpret_cast<float *>(dst->ptr_to_element(Coordinates(0, i, block, r))) = valid ? static_cast<float>(best.id[i]) : 0.f;
+                                *reinterpret_cast<float *>(dst->ptr_to_element(Coordinates(1, i, block, r))) =
+                                    valid ? best.score[i] : -std::numeric_limits<float>::infinity();
+                            }
+                        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_TOPK_PROJECTION_GENERIC_NEON_IMPL_H
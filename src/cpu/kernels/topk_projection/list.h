@@ -0,0 +1,21 @@
+#ifndef SRC_CPU_KERNELS_TOPK_PROJECTION_LIST_H
+#define SRC_CPU_KERNELS_TOPK_PROJECTION_LIST_H
+
+#include "src/cpu/kernels/topk_projection/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_TOPK_PROJECTION_KERNEL(func_name)                                                   \
+    void func_name(const ITensor *src, const ITensor *weights, const ITensor *bias, ITensor *dst, \
+                   const TopKProjectionLayerInfo &info, const Window &window)
+
+DECLARE_TOPK_PROJECTION_KERNEL(neon_fp32_topk_projection);
+DECLARE_TOPK_PROJECTION_KERNEL(neon_fp16_topk_projection);
+
+#undef DECLARE_TOPK_PROJECTION_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_TOPK_PROJECTION_LIST_H
@@ -0,0 +1,14 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/vectorize/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_vectorize_int_2_float16(const ITensor *src, const ITensor *vector, ITensor *dst, const Window &window)
+{
+    return vectorize_neon<float16_t>(src, vector, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
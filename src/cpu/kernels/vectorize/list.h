@@ -10,6 +10,7 @@ namespace cpu
 
 #ifdef __aarch64__
 DECLARE_VECTORIZE_KERNEL(neon_vectorize_int_2_float32);
+DECLARE_VECTORIZE_KERNEL(neon_vectorize_int_2_float16);
 #endif // __aarch64__
 
 #undef DECLARE_ACTIVATION_KERNEL
@@ -0,0 +1,29 @@
+#include "src/cpu/kernels/weight_only_gemv/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_weight_only_gemv(const ITensor             *src,
+                                const ITensor             *weights,
+                                const ITensor             *scales,
+                                const ITensor             *bias,
+                                ITensor                   *dst,
+                                WeightOnlyQuantization     quantization,
+                                unsigned int               group_size,
+                                const ActivationLayerInfo &act_info,
+                                bool                       approximate_gelu,
+                                const Window              &window)
+{
+    dispatch_linear_activation<float, 4>(act_info, approximate_gelu,
+                                         [&](auto act)
+                                         {
+                                             if(quantization == WeightOnlyQuantization::INT4)
+                                             {
+                                                 return weight_only_gemv_neon<true>(src, weights, scales, bias, dst, group_size, act, window);
+                                             }
+                                             return weight_only_gemv_neon<false>(src, weights, scales, bias, dst, group_size, act, window);
+                                         });
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,122 @@
+#ifndef SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace weight_only_gemv
+{
+/** Loads 16 signed 8-bit weights */
+inline int8x16_t load_s8x16(const int8_t *w)
+{
+    return vld1q_s8(w);
+}
+
+/** Loads 16 signed 4-bit weights from 8 bytes, element 2i in the low nibble of byte i and element 2i + 1 in the high one */
+inline int8x16_t load_s4x16(const uint8_t *w)
+{
+    const int8x8_t   packed = vreinterpret_s8_u8(vld1_u8(w));
+    const int8x8_t   lo     = vshr_n_s8(vshl_n_s8(packed, 4), 4);
+    const int8x8_t   hi     = vshr_n_s8(packed, 4);
+    const int8x8x2_t zipped = vzip_s8(lo, hi);
+    return vcombine_s8(zipped.val[0], zipped.val[1]);
+}
+
+/** Accumulates the products of 16 F32 inputs with 16 weights widened to F32 */
+inline void mla_x16(float32x4_t &acc0, float32x4_t &acc1, const float *x, int8x16_t w)
+{
+    const int16x8_t lo = vmovl_s8(vget_low_s8(w));
+    const int16x8_t hi = vmovl_s8(vget_high_s8(w));
+    acc0 = vmlaq_f32(acc0, vld1q_f32(x), vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))));
+    acc1 = vmlaq_f32(acc1, vld1q_f32(x + 4), vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))));
+    acc0 = vmlaq_f32(acc0, vld1q_f32(x + 8), vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))));
+    acc1 = vmlaq_f32(acc1, vld1q_f32(x + 12), vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi))));
+}
+} // namespace weight_only_gemv
+
+/** Product of F32 input rows with weight-only quantized weights
+ *
+ * The window is (output channel, input row). Packed weights are read once per output channel and dequantized in
+ * registers: the products of a group are accumulated in F32, then scaled by the scale of the group. The bias, if
+ * any, is added to the result and the activation functor @p act applied. @p group_size is a multiple of 16 dividing
+ * the number of input features.
+ */
+template <bool is_int4, typename Act>
+void weight_only_gemv_neon(const ITensor *src,
+                           const ITensor *weights,
+                           const ITensor *scales,
+                           const ITensor *bias,
+                           ITensor       *dst,
+                           unsigned int   group_size,
+                           Act            act,
+                           const Window  &window)
+{
+    const int len    = static_cast<int>(src->info()->dimension(0));
+    const int group  = static_cast<int>(group_size);
+    const int groups = len / group;
+
+    const Strides &s_strides = src->info()->strides_in_bytes();
+    const Strides &w_strides = weights->info()->strides_in_bytes();
+    const Strides &c_strides = scales->info()->strides_in_bytes();
+    const Strides &d_strides = dst->info()->strides_in_bytes();
+
+    const uint8_t *s_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const uint8_t *w_base = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+    const uint8_t *c_base = scales->buffer() + scales->info()->offset_first_element_in_bytes();
+    uint8_t       *d_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const float   *b_ptr  = (bias != nullptr) ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int n   = id.x();
+            const int row = id.y();
+
+            const auto x     = reinterpret_cast<const float *>(s_base + row * s_strides[1]);
+            const auto w_row = w_base + n * w_strides[1];
+            const auto s_row = reinterpret_cast<const float *>(c_base + n * c_strides[1]);
+
+            float32x4_t acc = vdupq_n_f32(0.f);
+            for(int g = 0; g < groups; ++g)
+            {
+                float32x4_t acc0 = vdupq_n_f32(0.f);
+                float32x4_t acc1 = vdupq_n_f32(0.f);
+                for(int k = g * group; k < (g + 1) * group; k += 16)
+                {
+                    const int8x16_t w = is_int4 ? weight_only_gemv::load_s4x16(w_row + k / 2)
+                                                : weight_only_gemv::load_s8x16(reinterpret_cast<const int8_t *>(w_row) + k);
+                    weight_only_gemv::mla_x16(acc0, acc1, x + k, w);
+                }
+                acc = vmlaq_n_f32(acc, vaddq_f32(acc0, acc1), s_row[g]);
+            }
+
+#if defined(__aarch64__)
+            float res = vaddvq_f32(acc);
+#else  // defined(__aarch64__)
+            float32x2_t tmp = vadd_f32(vget_high_f32(acc), vget_low_f32(acc));
+            tmp             = vpadd_f32(tmp, tmp);
+            float res       = vget_lane_f32(tmp, 0);
+#endif // defined(__aarch64__)
+            if(b_ptr != nullptr)
+            {
+                res += b_ptr[n];
+            }
+            act(res);
+            *reinterpret_cast<float *>(d_base + row * d_strides[1] + n * sizeof(float)) = res;
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_GENERIC_NEON_IMPL_H
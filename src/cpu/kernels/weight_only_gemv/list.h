@@ -0,0 +1,21 @@
+#ifndef SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_LIST_H
+#define SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_LIST_H
+
+#include "src/cpu/kernels/weight_only_gemv/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_WEIGHT_ONLY_GEMV_KERNEL(func_name)                                                          \
+    void func_name(const ITensor *src, const ITensor *weights, const ITensor *scales, const ITensor *bias, \
+                   ITensor *dst, WeightOnlyQuantization quantization, unsigned int group_size,                     \
+                   const ActivationLayerInfo &act_info, bool approximate_gelu, const Window &window)
+
+DECLARE_WEIGHT_ONLY_GEMV_KERNEL(neon_fp32_weight_only_gemv);
+
+#undef DECLARE_WEIGHT_ONLY_GEMV_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_WEIGHT_ONLY_GEMV_LIST_H
@@ -0,0 +1,21 @@
+#include "src/cpu/kernels/weight_only_pack/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_weight_only_pack(const ITensor          *weights,
+                                ITensor                *packed,
+                                ITensor                *scales,
+                                WeightOnlyQuantization  quantization,
+                                unsigned int            group_size,
+                                const Window           &window)
+{
+    if(quantization == WeightOnlyQuantization::INT4)
+    {
+        return weight_only_pack_neon<true>(weights, packed, scales, group_size, window);
+    }
+    return weight_only_pack_neon<false>(weights, packed, scales, group_size, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,76 @@
+#ifndef SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Packs F32 weights to signed 8 or 4 bits with one scale per group of input features
+ *
+ * The window iterates over the output channels, dimension X is handled here. Every group of @p group_size weights w
+ * is written as round(w / scale) with scale = max|w| / qmax, qmax being 127 for 8 bits and 7 for 4 bits. 4-bit
+ * weights are packed two per byte, element 2i in the low nibble and element 2i + 1 in the high one. Runs once when
+ * the layer is prepared, so it is kept scalar.
+ */
+template <bool is_int4>
+void weight_only_pack_neon(const ITensor *weights, ITensor *packed, ITensor *scales, unsigned int group_size, const Window &window)
+{
+    constexpr float qmax   = is_int4 ? 7.f : 127.f;
+    const int       len    = static_cast<int>(weights->info()->dimension(0));
+    const int       group  = static_cast<int>(group_size);
+    const int       groups = len / group;
+
+    Iterator in(weights, window);
+    Iterator out(packed, window);
+    Iterator scale(scales, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto w = reinterpret_cast<const float *>(in.ptr());
+            const auto q = out.ptr();
+            const auto s = reinterpret_cast<float *>(scale.ptr());
+
+            for(int g = 0; g < groups; ++g)
+            {
+                const float *w_group = w + g * group;
+
+                float amax = 0.f;
+                for(int k = 0; k < group; ++k)
+                {
+                    amax = std::max(amax, std::abs(w_group[k]));
+                }
+                const float inv_scale = (amax > 0.f) ? qmax / amax : 0.f;
+                s[g]                  = amax / qmax;
+
+                for(int k = 0; k < group; ++k)
+                {
+                    const int value = static_cast<int>(std::nearbyint(w_group[k] * inv_scale));
+                    const int idx   = g * group + k;
+                    if(is_int4)
+                    {
+                        const uint8_t nibble = static_cast<uint8_t>(value & 0xF);
+                        q[idx / 2]           = (idx % 2 == 0) ? nibble : static_cast<uint8_t>(q[idx / 2] | (nibble << 4));
+                    }
+                    else
+                    {
+                        reinterpret_cast<int8_t *>(q)[idx] = static_cast<int8_t>(value);
+                    }
+                }
+            }
+        },
+        in, out, scale);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_GENERIC_NEON_IMPL_H
@@ -0,0 +1,22 @@
+#ifndef SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_LIST_H
+#define SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_LIST_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/kernels/weight_only_pack/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_WEIGHT_ONLY_PACK_KERNEL(func_name)                                           \
+    void func_name(const ITensor *weights, ITensor *packed, ITensor *scales,               \
+                   WeightOnlyQuantization quantization, unsigned int group_size, const Window &window)
+
+DECLARE_WEIGHT_ONLY_PACK_KERNEL(neon_fp32_weight_only_pack);
+
+#undef DECLARE_WEIGHT_ONLY_PACK_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_WEIGHT_ONLY_PACK_LIST_H
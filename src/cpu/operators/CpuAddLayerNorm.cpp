@@ -0,0 +1,46 @@
+#include "src/cpu/operators/CpuAddLayerNorm.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
+#include "src/cpu/kernels/CpuAddLayerNormKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuAddLayerNorm::configure(const ITensorInfo        *src0,
+                                const ITensorInfo        *src1,
+                                const ITensorInfo        *gamma,
+                                const ITensorInfo        *beta,
+                                ITensorInfo              *dst,
+                                const LayerNormLayerInfo &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(src0, src1, gamma, beta, dst);
+
+    _add_layer_norm_kernel = std::make_unique<kernels::CpuAddLayerNormKernel>();
+    _add_layer_norm_kernel->configure(src0, src1, gamma, beta, dst, info);
+}
+
+Status
+CpuAddLayerNorm::validate(const ITensorInfo        *src0,
+                          const ITensorInfo        *src1,
+                          const ITensorInfo        *gamma,
+                          const ITensorInfo        *beta,
+                          const ITensorInfo        *dst,
+                          const LayerNormLayerInfo &info)
+{
+    return kernels::CpuAddLayerNormKernel::validate(src0, src1, gamma, beta, dst, info);
+}
+
+void CpuAddLayerNorm::run(ITensorPack &tensors)
+{
+    NEScheduler::get().schedule_op(_add_layer_norm_kernel.get(), Window::DimY,
+                                   _add_layer_norm_kernel->window(), tensors);
+}
+
+} // namespace cpu
+} // namespace arm_compute
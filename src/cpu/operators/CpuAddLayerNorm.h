@@ -0,0 +1,57 @@
+#ifndef ARM_COMPUTE_CPU_ADD_LAYER_NORM_H
+#define ARM_COMPUTE_CPU_ADD_LAYER_NORM_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuAddLayerNormKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+/** Basic function to run @ref kernels::CpuAddLayerNormKernel
+ * @note Performs dst = LayerNorm(src0 + src1) along the innermost dimension
+*/
+class CpuAddLayerNorm : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src0       First addend. Data type supported: F16/F32.
+     * @param[in]  src1       Second addend, same shape as @p src0. Data type supported: Same as @p src0.
+     * @param[in]  gamma      (Optional) Per-channel scale, shape (src0.dim0). Data type supported: Same as @p src0.
+     * @param[in]  beta       (Optional) Per-channel offset, shape (src0.dim0). Data type supported: Same as @p src0.
+     * @param[out] dst        Output tensor. Data type supported: Same as @p src0.
+     * @param[in]  info       (Optional)LayerNorm layer operation information
+     */
+    void configure(const ITensorInfo        *src0,
+                   const ITensorInfo        *src1,
+                   const ITensorInfo        *gamma,
+                   const ITensorInfo        *beta,
+                   ITensorInfo              *dst,
+                   const LayerNormLayerInfo &info = LayerNormLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuAddLayerNormKernel
+     *
+     * Similar to @ref CpuAddLayerNorm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *src0,
+                           const ITensorInfo        *src1,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *dst,
+                           const LayerNormLayerInfo &info = LayerNormLayerInfo());
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<kernels::CpuAddLayerNormKernel> _add_layer_norm_kernel{nullptr};
+};
+
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_ADD_LAYER_NORM_H */
@@ -0,0 +1,64 @@
+#include "src/cpu/operators/CpuEmbeddingGatherSum.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuEmbeddingGatherSum::configure(const ITensorInfo        *tokens,
+                                      const ITensorInfo        *segments,
+                                      const ITensorInfo        *vocab,
+                                      const ITensorInfo        *segment_table,
+                                      const ITensorInfo        *position_table,
+                                      ITensorInfo              *dst,
+                                      const EmbeddingLayerInfo &emb_info)
+{
+    ARM_COMPUTE_LOG_PARAMS(tokens, segments, vocab, segment_table, position_table, dst, emb_info);
+    ARM_COMPUTE_UNUSED(emb_info);
+
+    _gather_sum_kernel = std::make_unique<kernels::CpuEmbeddingGatherSumKernel>();
+    _gather_sum_kernel->configure(tokens, segments, vocab, segment_table, position_table, dst);
+}
+
+Status
+CpuEmbeddingGatherSum::validate(const ITensorInfo        *tokens,
+                                const ITensorInfo        *segments,
+                                const ITensorInfo        *vocab,
+                                const ITensorInfo        *segment_table,
+                                const ITensorInfo        *position_table,
+                                const ITensorInfo        *dst,
+                                const EmbeddingLayerInfo &emb_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(vocab->dimension(0) != emb_info.d_model());
+    return kernels::CpuEmbeddingGatherSumKernel::validate(tokens, segments, vocab, segment_table, position_table, dst);
+}
+
+void CpuEmbeddingGatherSum::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Runtime reshape valid tensor region if the ids have been padded during preprocess. With a batch of
+    // sequences, every valid sequence but the last one is full
+    const ITensor     *tokens       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    ITensor           *dst          = tensors.get_tensor(TensorType::ACL_DST);
+    const ValidRegion &tokens_valid = tokens->info()->valid_region();
+    const size_t       sequences    = std::min(tokens->info()->dimension(1), tokens_valid.shape.y());
+    const size_t       valid_rows   = (sequences == 0) ? 0 : (sequences - 1) * tokens->info()->dimension(0) + tokens_valid.shape.x();
+    if(dst->info()->valid_region().shape.y() != valid_rows)
+    {
+        dst->info()->set_valid_region(dst->info()->valid_region().set(1, 0, valid_rows));
+    }
+
+    NEScheduler::get().schedule_op(_gather_sum_kernel.get(), Window::DimY, _gather_sum_kernel->window(), tensors);
+}
+
+} // namespace cpu
+} // namespace arm_compute
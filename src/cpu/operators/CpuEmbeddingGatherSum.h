@@ -0,0 +1,60 @@
+#ifndef ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_H
+#define ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuEmbeddingGatherSumKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+/** Basic function to run @ref kernels::CpuEmbeddingGatherSumKernel
+ * @note Performs dst[t] = vocab[tokens[t]] + segment_table[segments[t]] + position_table[t]
+*/
+class CpuEmbeddingGatherSum : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  tokens         Token ids, shape (seq_len). 32-bit unsigned integers, any 4 byte data type.
+     * @param[in]  segments       Segment ids, shape (seq_len). Same storage as @p tokens.
+     * @param[in]  vocab          Vocabulary embedding table, shape (d_model, d_vocab). Data type supported: F16/F32.
+     * @param[in]  segment_table  Segment embedding table, shape (d_model, d_segment). Data type supported: Same as @p vocab.
+     * @param[in]  position_table Position embedding table, shape (d_model, d_position). Data type supported: Same as @p vocab.
+     * @param[out] dst            Destination tensor info, shape (d_model, seq_len). Data type supported: Same as @p vocab.
+     * @param[in]  emb_info       Embedding layer parameters.
+     */
+    void configure(const ITensorInfo        *tokens,
+                   const ITensorInfo        *segments,
+                   const ITensorInfo        *vocab,
+                   const ITensorInfo        *segment_table,
+                   const ITensorInfo        *position_table,
+                   ITensorInfo              *dst,
+                   const EmbeddingLayerInfo &emb_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuEmbeddingGatherSum::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *tokens,
+                           const ITensorInfo        *segments,
+                           const ITensorInfo        *vocab,
+                           const ITensorInfo        *segment_table,
+                           const ITensorInfo        *position_table,
+                           const ITensorInfo        *dst,
+                           const EmbeddingLayerInfo &emb_info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<kernels::CpuEmbeddingGatherSumKernel> _gather_sum_kernel{nullptr};
+};
+
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_EMBEDDING_GATHER_SUM_H */
@@ -8,36 +8,37 @@
 #include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuLayerNormKernel.h"
 
-
 namespace arm_compute
 {
 namespace cpu
 {
-void CpuLayerNorm::configure(const ITensorInfo *input,
-                          ITensorInfo       *output,
-                          const LayerNormLayerInfo &info)
+void CpuLayerNorm::configure(const ITensorInfo        *input,
+                             const ITensorInfo        *gamma,
+                             const ITensorInfo        *beta,
+                             ITensorInfo              *output,
+                             const LayerNormLayerInfo &info)
 {
+    ARM_COMPUTE_LOG_PARAMS(input, gamma, beta, output);
+
     _layer_norm_kernel = std::make_unique<kernels::CpuLayerNormKernel>();
-    _layer_norm_kernel ->configure(input,output,info);
+    _layer_norm_kernel->configure(input, gamma, beta, output, info);
 }
 
 Status
-CpuLayerNorm::validate(const ITensorInfo *input,
-                    ITensorInfo       *output,
-                    const LayerNormLayerInfo &info)
+CpuLayerNorm::validate(const ITensorInfo        *input,
+                       const ITensorInfo        *gamma,
+                       const ITensorInfo        *beta,
+                       const ITensorInfo        *output,
+                       const LayerNormLayerInfo &info)
 {
-    ARM_COMPUTE_UNUSED(input);
-    ARM_COMPUTE_UNUSED(output);
-    ARM_COMPUTE_UNUSED(info);
-    return Status{};
+    return kernels::CpuLayerNormKernel::validate(input, gamma, beta, output, info);
 }
 
 void CpuLayerNorm::run(ITensorPack &tensors)
 {
     NEScheduler::get().schedule_op(_layer_norm_kernel.get(), Window::DimY,
-                                            _layer_norm_kernel->window(), tensors);
+                                   _layer_norm_kernel->window(), tensors);
 }
 
-
 } // namespace cpu
 } // namespace arm_compute
@@ -11,30 +11,36 @@ namespace arm_compute
 namespace cpu
 {
 
-/** Basic function to run @ref kernels::CpuLayerNormKernel 
- * @note Performs LayerNorm function [alpha * A * B + beta * C]
+/** Basic function to run @ref kernels::CpuLayerNormKernel
+ * @note Performs dst = (src - mean) / sqrt(var + epsilon) * gamma + beta along the innermost dimension
 */
 class CpuLayerNorm : public ICpuOperator
 {
 public:
     /** Initialise the kernel's inputs and output
      *
-     * @param[in]  input      Input tensor. Data type supported: f32.
-     * @param[out] output     Output tensor. Data type supported: F32.
+     * @param[in]  input      Input tensor. Data type supported: F16/F32.
+     * @param[in]  gamma      (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     * @param[in]  beta       (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
+     * @param[out] output     Output tensor. Data type supported: Same as @p input.
      * @param[in]  info       (Optional)LayerNorm layer operation information
      */
-    void configure(const ITensorInfo *input,
-                   ITensorInfo       *output,
-                   const LayerNormLayerInfo& info = LayerNormLayerInfo());
+    void configure(const ITensorInfo        *input,
+                   const ITensorInfo        *gamma,
+                   const ITensorInfo        *beta,
+                   ITensorInfo              *output,
+                   const LayerNormLayerInfo &info = LayerNormLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref CpuLayerNormKernel
      *
-     * Similar to @ref CpuGemm::configure()
+     * Similar to @ref CpuLayerNorm::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input,
-                           ITensorInfo       *output,
-                           const LayerNormLayerInfo& info = LayerNormLayerInfo());
+    static Status validate(const ITensorInfo        *input,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *output,
+                           const LayerNormLayerInfo &info = LayerNormLayerInfo());
 
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
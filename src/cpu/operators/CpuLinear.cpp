@@ -1,22 +1,89 @@
 #include "src/cpu/operators/CpuLinear.h"
 
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/IOperator.h"
 #include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
 #include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuLinearKernel.h"
+#include "src/cpu/kernels/linear_activation/generic/neon/impl.h"
 
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
-#include "arm_compute/runtime/CL/CLTensor.h"
+#include <sstream>
+
+using namespace arm_compute::experimental;
 
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+cpu::AsmGemmInfo init_assembly_metadata(const ITensorInfo *b, const LinearLayerInfo &linear_info)
+{
+    cpu::AsmGemmInfo asm_info;
+    asm_info.method                      = cpu::AsmConvMethod::Im2Col;
+    asm_info.reshape_b_only_on_first_run = b->are_values_constant();
+    // Weights are stored as (in_features, out_features), transpose them while packing
+    asm_info.transpose_b = true;
+    // F32 weights are packed as BF16 and multiplied by the BF16 dot product kernels
+    asm_info.fast_mode = linear_info.fast_math();
+
+    return asm_info;
+}
+
+/** Shape of the S32 accumulators of the int8 GEMM, one row of out_features per input row */
+TensorShape accumulators_shape(const ITensorInfo *a, const ITensorInfo *b)
+{
+    return TensorShape(a->tensor_shape()).set(0, b->dimension(1));
+}
+
+/** Whether an int8 assembly GEMM can multiply the dynamically quantized input and weights */
+Status validate_dynamic_int8(const ITensorInfo *a, const ITensorInfo *b, float alpha)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(a->data_type() != DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!b->are_values_constant(), "Only constant weights are quantized ahead of time");
+    ARM_COMPUTE_RETURN_ERROR_ON(alpha != 1.f);
+
+    const TensorInfo quantized_a(a->tensor_shape(), 1, DataType::S8);
+    const TensorInfo quantized_b(b->tensor_shape(), 1, DataType::S8);
+    const TensorInfo accumulators(accumulators_shape(a, b), 1, DataType::S32);
+    return cpu::CpuGemmAssemblyDispatch::validate(&quantized_a, &quantized_b, nullptr, &accumulators,
+                                                  init_assembly_metadata(b, LinearLayerInfo()));
+}
+
+/** Whether the weights can be packed weight-only quantized and multiplied by the GEMV kernel */
+Status validate_weight_only(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, float alpha,
+                            const LinearLayerInfo &linear_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(a->data_type() != DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!b->are_values_constant(), "Only constant weights are packed ahead of time");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(1) >= 2, "Only single-row inputs run the GEMV kernel");
+    ARM_COMPUTE_RETURN_ERROR_ON(alpha != 1.f);
+
+    TensorInfo packed_b{};
+    TensorInfo b_scales{};
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuWeightOnlyPackKernel::validate(
+        b, &packed_b, &b_scales, linear_info.weight_only_quantization(), linear_info.weight_group_size()));
+
+    const bool       is_int4 = linear_info.weight_only_quantization() == WeightOnlyQuantization::INT4;
+    const TensorInfo expected_packed(TensorShape(b->dimension(0) / (is_int4 ? 2 : 1), b->dimension(1)), 1,
+                                     is_int4 ? DataType::U8 : DataType::S8);
+    const TensorInfo expected_scales(TensorShape(b->dimension(0) / linear_info.weight_group_size(), b->dimension(1)), 1,
+                                     DataType::F32);
+    const TensorInfo dst(accumulators_shape(a, b), 1, DataType::F32);
+    return cpu::kernels::CpuWeightOnlyGemvKernel::validate(a, &expected_packed, &expected_scales, c, &dst,
+                                                           linear_info.weight_only_quantization(),
+                                                           linear_info.weight_group_size(), linear_info.activation_info());
+}
+} // namespace
+
 void CpuLinear::configure(const ITensorInfo *a,
                           const ITensorInfo *b,
                           const ITensorInfo *c,
@@ -24,20 +91,105 @@ void CpuLinear::configure(const ITensorInfo *a,
                           float              alpha,
                           float beta, const LinearLayerInfo &linear_info)
 {
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuLinear::validate(a, b, c, d, alpha, beta, linear_info));
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, linear_info);
-    ARM_COMPUTE_UNUSED(linear_info);
     ARM_COMPUTE_UNUSED(beta);
 
-    const bool is_c_bias     = c != nullptr;
-    const bool run_optimised = false;
+    const cpu::AsmGemmInfo    asm_info  = init_assembly_metadata(b, linear_info);
+    const bool                is_c_bias = c != nullptr;
+    const ActivationLayerInfo act_info  = linear_info.activation_info();
+    const bool             run_optimised =
+        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias) ? c : nullptr, d, asm_info)) &&
+        alpha == 1.f; // Optimized GeMM doesn't support alpha coefficient.
 
+    _is_prepared                      = false;
     _run_vector_matrix_multiplication = a->dimension(1) < 2;
     _run_bias_addition                = is_c_bias;
     _reshape_b_only_on_first_run      = b->are_values_constant();
+    _run_weight_only                  = linear_info.weight_only_quantization() != WeightOnlyQuantization::NONE &&
+                       bool(validate_weight_only(a, b, c, alpha, linear_info));
+    _run_dynamic_int8                 = !_run_weight_only && linear_info.dynamic_int8() &&
+                        bool(validate_dynamic_int8(a, b, alpha));
+    _run_activation                   = false;
 
-    if(run_optimised)
+    if(_run_weight_only)
     {
+        // Weights are packed once, the GEMV kernel dequantizes them in registers and adds the bias
         _run_interleave_transpose = false;
+        _pack_b_kernel            = std::make_unique<cpu::kernels::CpuWeightOnlyPackKernel>();
+        _pack_b_kernel->configure(b, &_packed_b, &_b_group_scales, linear_info.weight_only_quantization(),
+                                  linear_info.weight_group_size());
+        _weight_only_gemv_kernel = std::make_unique<cpu::kernels::CpuWeightOnlyGemvKernel>();
+        _weight_only_gemv_kernel->configure(a, &_packed_b, &_b_group_scales, c, d,
+                                            linear_info.weight_only_quantization(), linear_info.weight_group_size(),
+                                            act_info, linear_info.approximate_gelu());
+
+        _aux_mem[PackedRHS] = MemoryInfo(offset_int_vec(PackedRHS), MemoryLifetime::Persistent, _packed_b.total_size());
+        _aux_mem[RHSGroupScales] =
+            MemoryInfo(offset_int_vec(RHSGroupScales), MemoryLifetime::Persistent, _b_group_scales.total_size());
+    }
+    else if(_run_dynamic_int8)
+    {
+        // Weights are quantized per output channel once, the input per row at every run
+        _quantize_b_kernel = std::make_unique<cpu::kernels::CpuQuantizeRowsKernel>();
+        _quantize_b_kernel->configure(b, &_quantized_b, &_b_scales);
+        _quantize_a_kernel = std::make_unique<cpu::kernels::CpuQuantizeRowsKernel>();
+        _quantize_a_kernel->configure(a, &_quantized_a, &_a_scales);
+
+        _accumulators = TensorInfo(accumulators_shape(a, b), 1, DataType::S32);
+        _asm_glue     = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
+        _asm_glue->configure(&_quantized_a, &_quantized_b, nullptr, &_accumulators, init_assembly_metadata(b, LinearLayerInfo()));
+        ARM_COMPUTE_ERROR_ON(!_asm_glue->is_configured());
+
+        const auto asm_mem_req = _asm_glue->workspace();
+        for(unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = asm_mem_req[slot];
+        }
+
+        // Scales, bias and activation are applied to the accumulators in a single pass
+        _run_interleave_transpose = false;
+        _dequantize_kernel        = std::make_unique<cpu::kernels::CpuLinearDequantizeKernel>();
+        _dequantize_kernel->configure(&_accumulators, &_a_scales, &_b_scales, c, d, act_info,
+                                      linear_info.approximate_gelu());
+
+        // Quantized weights are only read while they are packed, their scales are read at every run
+        _aux_mem[QuantizedLHS] = MemoryInfo(offset_int_vec(QuantizedLHS), MemoryLifetime::Temporary, _quantized_a.total_size());
+        _aux_mem[LHSScales]    = MemoryInfo(offset_int_vec(LHSScales), MemoryLifetime::Temporary, _a_scales.total_size());
+        _aux_mem[QuantizedRHS] = MemoryInfo(offset_int_vec(QuantizedRHS), MemoryLifetime::Prepare, _quantized_b.total_size());
+        _aux_mem[RHSScales]    = MemoryInfo(offset_int_vec(RHSScales), MemoryLifetime::Persistent, _b_scales.total_size());
+        _aux_mem[Accumulators] = MemoryInfo(offset_int_vec(Accumulators), MemoryLifetime::Temporary, _accumulators.total_size());
+    }
+    else if(run_optimised)
+    {
+        // Bias and activation are applied by the assembly kernel output stage if it supports the activation,
+        // otherwise both are applied in place by a single pass over the output
+        const bool asm_activation = !act_info.enabled() || cpu::CpuGemmAssemblyDispatch::is_activation_supported(act_info);
+        cpu::AsmGemmInfo gemm_asm_info = asm_info;
+        if(asm_activation)
+        {
+            gemm_asm_info.activation_info = act_info;
+        }
+
+        _run_interleave_transpose = false;
+        _asm_glue                 = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
+        _asm_glue->configure(a, b, (is_c_bias && asm_activation) ? c : nullptr, d, gemm_asm_info);
+        ARM_COMPUTE_ERROR_ON(!_asm_glue->is_configured());
+
+        const auto asm_mem_req = _asm_glue->workspace();
+        for(unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = asm_mem_req[slot];
+        }
+
+        if(!asm_activation && is_c_bias)
+        {
+            _add_bias = std::make_unique<cpu::kernels::CpuAddVecKernel>();
+            _add_bias->configure(d, c, d, Window::DimX, Window::DimX, ConvertPolicy::SATURATE, act_info,
+                                 linear_info.approximate_gelu());
+        }
+        _run_activation = !asm_activation && !is_c_bias;
     }
     else /* Normal matrix multiplication*/
     {
@@ -45,11 +197,22 @@ void CpuLinear::configure(const ITensorInfo *a,
 
         // Pick output tensor in case bias addition should be performed
         ITensorInfo *gemm_output_to_use = (_run_bias_addition) ? &_tmp_d : d;
-        // Pick b tensor in case pretranspose should be performed
-        const ITensorInfo *b_to_use = b;
 
         _mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
 
+        // Weights are stored as (in_features, out_features), so rhs is always pretransposed
+        _pretranspose_b_func = std::make_unique<CpuTranspose>();
+        _pretranspose_b_func->configure(b, &_pretransposed_b);
+        MemoryLifetime pretranspose_lifetime = MemoryLifetime::Temporary;
+        if(_reshape_b_only_on_first_run)
+        {
+            // Pretransposed rhs is only kept beyond prepare() if it is the final transformation of rhs
+            pretranspose_lifetime = _run_interleave_transpose ? MemoryLifetime::Prepare : MemoryLifetime::Persistent;
+        }
+        _aux_mem[PreTransposedRHS] =
+            MemoryInfo(offset_int_vec(PreTransposedRHS), pretranspose_lifetime, _pretransposed_b.total_size());
+        const ITensorInfo *b_to_use = &_pretransposed_b;
+
         if(_run_vector_matrix_multiplication)
         {
             // Configure the matrix multiply kernel
@@ -57,23 +220,17 @@ void CpuLinear::configure(const ITensorInfo *a,
         }
         else
         {
-            _pretranspose_b_func = std::make_unique<CpuTranspose>();
-            _pretranspose_b_func->configure(b_to_use, &_pretransposed_b);
-            _aux_mem[PreTransposedRHS] =
-                experimental::MemoryInfo(offset_int_vec(PreTransposedRHS), experimental::MemoryLifetime::Persistent, _pretransposed_b.total_size());
-            b_to_use = &_pretransposed_b;
-
             // Configure interleave kernel
             _interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
             _interleave_kernel->configure(a, &_tmp_a);
             _aux_mem[InterleavedLHS] =
-                experimental::MemoryInfo(offset_int_vec(InterleavedLHS), experimental::MemoryLifetime::Persistent, _tmp_a.total_size());
+                MemoryInfo(offset_int_vec(InterleavedLHS), MemoryLifetime::Temporary, _tmp_a.total_size());
 
             // Configure rhs transpose1xw kernel
             _transpose1xW_b_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
             _transpose1xW_b_kernel->configure(b_to_use, &_tmp_b);
-            _aux_mem[Transposed1xWRHS] =
-                experimental::MemoryInfo(offset_int_vec(Transposed1xWRHS), experimental::MemoryLifetime::Persistent, _tmp_b.total_size());
+            const auto lifetime = _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
+            _aux_mem[Transposed1xWRHS] = MemoryInfo(offset_int_vec(Transposed1xWRHS), lifetime, _tmp_b.total_size());
 
             // Use a and b here instead of _tmp_a and _tmp_b because CpuGemmMatrixMultiplyKernel requires the original m,n,k in case of interleaved a and transposed1xw b
             const int m = a->dimension(1);
@@ -87,11 +244,49 @@ void CpuLinear::configure(const ITensorInfo *a,
 
         if(_run_bias_addition)
         {
+            // The activation is applied with the bias
             _add_bias = std::make_unique<cpu::kernels::CpuAddVecKernel>();
-            _add_bias->configure(gemm_output_to_use, c, d, Window::DimX, Window::DimX, ConvertPolicy::SATURATE);
+            _add_bias->configure(gemm_output_to_use, c, d, Window::DimX, Window::DimX, ConvertPolicy::SATURATE,
+                                 act_info, linear_info.approximate_gelu());
             _aux_mem[TempResult] =
-                experimental::MemoryInfo(offset_int_vec(TempResult), experimental::MemoryLifetime::Persistent, _tmp_d.total_size());
+                MemoryInfo(offset_int_vec(TempResult), MemoryLifetime::Temporary, _tmp_d.total_size());
         }
+        _run_activation = act_info.enabled() && !is_c_bias;
+    }
+
+    if(_run_activation)
+    {
+        // Without a bias the output stage only applies the activation, in place
+        _activation_kernel = std::make_unique<cpu::kernels::CpuAddVecKernel>();
+        _activation_kernel->configure(d, nullptr, d, Window::DimX, Window::DimX, ConvertPolicy::SATURATE, act_info,
+                                      linear_info.approximate_gelu());
+    }
+
+    _packed_weights_key.clear();
+    if(_reshape_b_only_on_first_run)
+    {
+        std::stringstream key;
+        // The reshaped weights do not depend on the number of rows of a beyond the kernel it selects, which the assembly
+        // layout names, so functions of the same weights with different sequence lengths can share them
+        key << "linear/" << string_from_data_type(b->data_type()) << "/" << b->dimension(0) << "x" << b->dimension(1) << "/";
+        if(_run_weight_only)
+        {
+            key << (linear_info.weight_only_quantization() == WeightOnlyQuantization::INT4 ? "weight_only_int4" : "weight_only_int8")
+                << "/g" << linear_info.weight_group_size();
+        }
+        else if(_run_dynamic_int8)
+        {
+            key << "asm_s8/" << _asm_glue->packed_b_layout();
+        }
+        else if(_asm_glue)
+        {
+            key << "asm/" << _asm_glue->packed_b_layout();
+        }
+        else
+        {
+            key << (_run_interleave_transpose ? "transpose1xw" : "transpose");
+        }
+        _packed_weights_key = key.str();
     }
 }
 
@@ -103,57 +298,102 @@ CpuLinear::validate(const ITensorInfo *a,
                     float              alpha,
                     float beta, const LinearLayerInfo &linear_info)
 {
-    ARM_COMPUTE_UNUSED(a);
-    ARM_COMPUTE_UNUSED(b);
-    ARM_COMPUTE_UNUSED(c);
-    ARM_COMPUTE_UNUSED(d);
     ARM_COMPUTE_UNUSED(alpha);
     ARM_COMPUTE_UNUSED(beta);
-    ARM_COMPUTE_UNUSED(linear_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(0),
+                                    "The number of input features of A must match the weights");
+    if(c != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, c);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(c->dimension(0) != b->dimension(1),
+                                        "The bias must have one element per output feature");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_linear_activation_supported(linear_info.activation_info()),
+                                    "Activation not supported in the output stage");
+    if(d->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, d);
+        ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(0) != b->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(1) != a->dimension(1));
+    }
     return Status{};
 }
 
 void CpuLinear::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    prepare(tensors);
+
     auto a = tensors.get_const_tensor(ACL_SRC_0);
     auto b = tensors.get_const_tensor(ACL_SRC_1);
     auto c = tensors.get_const_tensor(ACL_SRC_2);
     auto d = tensors.get_tensor(ACL_DST);
 
-    ICLTensor *a_cl;
-    ICLTensor *b_cl;
-    ICLTensor *c_cl;
-    ICLTensor *d_cl;
-    if(a->info()->tensor_target_type() == TensorTargetType::CL)
+    if(_run_weight_only)
     {
-        ITensor *a_nc = const_cast<ITensor *>(a);
-        a_cl          = static_cast<ICLTensor *>(a_nc);
-        a_cl->map(CLScheduler::get().queue());
+        CpuAuxTensorHandler packed_b(offset_int_vec(PackedRHS), _packed_b, tensors);
+        CpuAuxTensorHandler b_scales(offset_int_vec(RHSGroupScales), _b_group_scales, tensors);
+
+        ITensorPack gemv_pack{ { ACL_SRC_0, a }, { ACL_SRC_1, packed_b.get() }, { ACL_SRC_2, b_scales.get() },
+                               { ACL_SRC_3, c }, { ACL_DST, d } };
+        NEScheduler::get().schedule_op(_weight_only_gemv_kernel.get(), Window::DimX, _weight_only_gemv_kernel->window(),
+                                       gemv_pack);
+        return;
     }
 
-    if(b->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *b_nc = const_cast<ITensor *>(b);
-        b_cl          = static_cast<ICLTensor *>(b_nc);
-        b_cl->map(CLScheduler::get().queue());
-    }
-    
-    if(c->info()->tensor_target_type() == TensorTargetType::CL)
+    if(_run_dynamic_int8)
     {
-        ITensor *c_nc = const_cast<ITensor *>(c);
-        c_cl          = static_cast<ICLTensor *>(c_nc);
-        c_cl->map(CLScheduler::get().queue());
+        CpuAuxTensorHandler quantized_a(offset_int_vec(QuantizedLHS), _quantized_a, tensors, true);
+        CpuAuxTensorHandler a_scales(offset_int_vec(LHSScales), _a_scales, tensors, true);
+        CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedRHS), _quantized_b, tensors, false,
+                                        true /*bypass_alloc*/, true /*bypass_import: the packed copy is read*/);
+        CpuAuxTensorHandler b_scales(offset_int_vec(RHSScales), _b_scales, tensors);
+        CpuAuxTensorHandler accumulators(offset_int_vec(Accumulators), _accumulators, tensors, true);
+
+        ITensorPack quantize_pack{ { ACL_SRC, a }, { ACL_DST_0, quantized_a.get() }, { ACL_DST_1, a_scales.get() } };
+        NEScheduler::get().schedule_op(_quantize_a_kernel.get(), Window::DimY, _quantize_a_kernel->window(), quantize_pack);
+
+        ITensorPack asm_pack = tensors;
+        asm_pack.add_const_tensor(ACL_SRC_0, quantized_a.get());
+        asm_pack.add_const_tensor(ACL_SRC_1, quantized_b.get());
+        asm_pack.add_const_tensor(ACL_SRC_2, nullptr);
+        asm_pack.add_tensor(ACL_DST, accumulators.get());
+        _asm_glue->run(asm_pack);
+
+        ITensorPack dequantize_pack{ { ACL_SRC_0, accumulators.get() }, { ACL_SRC_1, a_scales.get() },
+                                     { ACL_SRC_2, b_scales.get() },     { ACL_SRC_3, c },
+                                     { ACL_DST, d } };
+        NEScheduler::get().schedule_op(_dequantize_kernel.get(), Window::DimY, _dequantize_kernel->window(), dequantize_pack);
+        return;
     }
 
-    if(d->info()->tensor_target_type() == TensorTargetType::CL)
+    if(_asm_glue && _asm_glue->is_configured())
     {
-        d_cl = static_cast<ICLTensor *>(d);
-        d_cl->map(CLScheduler::get().queue());
+        // Pass c to asm dispatch only if it's the bias tensor and the output stage is not run separately
+        ITensorPack asm_pack = tensors;
+        asm_pack.add_const_tensor(ACL_SRC_2, (_run_bias_addition && _add_bias == nullptr) ? c : nullptr);
+        _asm_glue->run(asm_pack);
+
+        if(_add_bias)
+        {
+            // Bias and activation in place
+            ITensorPack pack{ { ACL_SRC_0, d }, { ACL_SRC_1, c }, { ACL_DST, d } };
+            NEScheduler::get().schedule_op(_add_bias.get(), Window::DimX, _add_bias->window(), pack);
+        }
+        if(_run_activation)
+        {
+            ITensorPack pack{ { ACL_SRC_0, d }, { ACL_DST, d } };
+            NEScheduler::get().schedule_op(_activation_kernel.get(), Window::DimX, _activation_kernel->window(), pack);
+        }
+        return;
     }
 
     CpuAuxTensorHandler interleaved_a(offset_int_vec(InterleavedLHS), _tmp_a, tensors, true);
-    CpuAuxTensorHandler pretransposed_b(offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors, true);
+    CpuAuxTensorHandler pretransposed_b(offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors);
     CpuAuxTensorHandler transposed1xw_b(offset_int_vec(Transposed1xWRHS), _tmp_b, tensors, true);
     CpuAuxTensorHandler temp_d(offset_int_vec(TempResult), _tmp_d, tensors, true);
 
@@ -173,19 +413,24 @@ void CpuLinear::run(ITensorPack &tensors)
 
     if(_pretranspose_b_func)
     {
-        // Run pretranspose kernel
-        ITensorPack pretranspose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, pretransposed_b.get() } };
-        _pretranspose_b_func->run(pretranspose_pack);
+        if(!_reshape_b_only_on_first_run)
+        {
+            // Run pretranspose kernel
+            ITensorPack pretranspose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, pretransposed_b.get() } };
+            _pretranspose_b_func->run(pretranspose_pack);
+        }
         b_to_use = pretransposed_b.get();
     }
 
     if(_run_interleave_transpose)
     {
-        // Run transpose1xw kernel
-        ITensorPack transpose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, transposed1xw_b.get() } };
-        NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
-                                       _transpose1xW_b_kernel->window(), transpose_pack);
-
+        if(!_reshape_b_only_on_first_run)
+        {
+            // Run transpose1xw kernel
+            ITensorPack transpose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, transposed1xw_b.get() } };
+            NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
+                                           _transpose1xW_b_kernel->window(), transpose_pack);
+        }
         b_to_use = transposed1xw_b.get();
     }
 
@@ -202,6 +447,117 @@ void CpuLinear::run(ITensorPack &tensors)
         ITensorPack pack{ { ACL_SRC_0, temp_d.get() }, { ACL_SRC_1, c }, { ACL_DST, d } };
         NEScheduler::get().schedule_op(_add_bias.get(), Window::DimX, _add_bias->window(), pack);
     }
+
+    // Run activation in place when there is no bias to fuse it with
+    if(_run_activation)
+    {
+        ITensorPack pack{ { ACL_SRC_0, d }, { ACL_DST, d } };
+        NEScheduler::get().schedule_op(_activation_kernel.get(), Window::DimX, _activation_kernel->window(), pack);
+    }
+}
+
+void CpuLinear::prepare(ITensorPack &tensors)
+{
+    if(!_is_prepared)
+    {
+        const ITensor *b = tensors.get_const_tensor(ACL_SRC_1);
+
+        if(_run_weight_only)
+        {
+            CpuAuxTensorHandler packed_b(offset_int_vec(PackedRHS), _packed_b, tensors, false);
+            CpuAuxTensorHandler b_scales(offset_int_vec(RHSGroupScales), _b_group_scales, tensors, false);
+
+            // Quantize and pack every output channel
+            ITensorPack pack{ { ACL_SRC, b }, { ACL_DST_0, packed_b.get() }, { ACL_DST_1, b_scales.get() } };
+            NEScheduler::get().schedule_op(_pack_b_kernel.get(), Window::DimY, _pack_b_kernel->window(), pack);
+
+            b->mark_as_unused();
+        }
+        else if(_run_dynamic_int8)
+        {
+            CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedRHS), _quantized_b, tensors, false);
+            CpuAuxTensorHandler b_scales(offset_int_vec(RHSScales), _b_scales, tensors, false);
+
+            // Quantize every output channel
+            ITensorPack quantize_pack{ { ACL_SRC, b }, { ACL_DST_0, quantized_b.get() }, { ACL_DST_1, b_scales.get() } };
+            NEScheduler::get().schedule_op(_quantize_b_kernel.get(), Window::DimY, _quantize_b_kernel->window(),
+                                           quantize_pack);
+
+            // Pack the quantized weights for the int8 GEMM
+            ITensorPack asm_pack = tensors;
+            asm_pack.add_const_tensor(ACL_SRC_1, quantized_b.get());
+            asm_pack.add_const_tensor(ACL_SRC_2, nullptr);
+            _asm_glue->prepare(asm_pack);
+
+            b->mark_as_unused();
+        }
+        else if(_asm_glue && _asm_glue->is_configured())
+        {
+            _asm_glue->prepare(tensors);
+        }
+        else if(_reshape_b_only_on_first_run)
+        {
+            const ITensor      *b_to_use = b;
+            CpuAuxTensorHandler pretransposed_b(offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors,
+                                                false /*pack_inject: no need to inject into tensors*/);
+            CpuAuxTensorHandler transposed1xw_b(offset_int_vec(Transposed1xWRHS), _tmp_b, tensors,
+                                                false /*pack_inject*/, !_run_interleave_transpose /*bypass_alloc*/);
+
+            // Run pretranspose kernel
+            ITensorPack pretranspose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, pretransposed_b.get() } };
+            _pretranspose_b_func->run(pretranspose_pack);
+            b_to_use = pretransposed_b.get();
+
+            if(_run_interleave_transpose)
+            {
+                // Run transpose1xw kernel
+                ITensorPack transpose_pack{ { ACL_SRC, b_to_use }, { ACL_DST, transposed1xw_b.get() } };
+                NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
+                                               _transpose1xW_b_kernel->window(), transpose_pack);
+            }
+
+            // Weights are only read through their reshaped copy from now on
+            b->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+const std::string &CpuLinear::packed_weights_key() const
+{
+    return _packed_weights_key;
+}
+
+void CpuLinear::prepare_from_packed(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_packed_weights_key.empty(), "Weights reshaped on every run cannot be prepared ahead of time");
+    if(!_is_prepared)
+    {
+        if(_run_dynamic_int8)
+        {
+            // The weight scales are part of the persistent workspace as well
+            CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedRHS), _quantized_b, tensors, false,
+                                            true /*bypass_alloc*/, true /*bypass_import*/);
+            ITensorPack         asm_pack = tensors;
+            asm_pack.add_const_tensor(ACL_SRC_1, quantized_b.get());
+            _asm_glue->prepare_from_packed(asm_pack);
+            tensors.get_const_tensor(ACL_SRC_1)->mark_as_unused();
+        }
+        else if(_asm_glue && _asm_glue->is_configured())
+        {
+            _asm_glue->prepare_from_packed(tensors);
+        }
+        else
+        {
+            tensors.get_const_tensor(ACL_SRC_1)->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuLinear::workspace() const
+{
+    return _aux_mem;
 }
 
 } // namespace cpu
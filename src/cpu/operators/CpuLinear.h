@@ -10,6 +10,13 @@
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/kernels/CpuAddVecKernel.h"
+#include "src/cpu/kernels/CpuLinearDequantizeKernel.h"
+#include "src/cpu/kernels/CpuQuantizeRowsKernel.h"
+#include "src/cpu/kernels/CpuWeightOnlyGemvKernel.h"
+#include "src/cpu/kernels/CpuWeightOnlyPackKernel.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+#include <string>
 
 namespace arm_compute
 {
@@ -18,6 +25,21 @@ namespace cpu
 
 /** Basic function to run @ref kernels::CpuLinearKernel 
  * @note Performs linear function [alpha * A * B + beta * C]
+ *
+ * Weights are stored as (in_features, out_features) and are reshaped once in @ref CpuLinear::prepare when constant.
+ * The assembly path (@ref CpuGemmAssemblyDispatch) transposes and packs them and adds the bias in its output stage,
+ * otherwise the weights are pretransposed and transposed1xW for @ref kernels::CpuGemmMatrixMultiplyKernel.
+ * With @ref LinearLayerInfo::fast_math the assembly path may pack F32 weights as BF16 and run BF16 dot products.
+ * With @ref LinearLayerInfo::dynamic_int8 the weights are quantized per output channel in @ref CpuLinear::prepare, the
+ * input is quantized per row at every run and an int8 GEMM accumulates in S32. @ref kernels::CpuLinearDequantizeKernel
+ * then applies both scales and the bias.
+ * With @ref LinearLayerInfo::weight_only_quantization and a single input row, the weights are packed to 8 or 4 bits
+ * with group-wise scales in @ref CpuLinear::prepare and @ref kernels::CpuWeightOnlyGemvKernel dequantizes them in
+ * registers. This path takes precedence over the dynamic int8 one.
+ * @ref LinearLayerInfo::activation_info is applied with the bias in the output stage of every path. The assembly
+ * kernels apply the activations they support themselves, for the others the bias is left out of the GEMM and
+ * @ref kernels::CpuAddVecKernel adds it and applies the activation in a single in-place pass. Without a bias the same
+ * kernel applies only the activation, so @ref LinearLayerInfo::approximate_gelu holds on every path.
 */
 class CpuLinear : public ICpuOperator
 {
@@ -53,8 +75,24 @@ public:
                            float              beta,
                            const LinearLayerInfo& info = LinearLayerInfo());
 
+    /** Key of the reshaped weights held in the persistent workspace
+     *
+     * Names the shapes, the reshape path and the selected assembly kernel, so that equal keys reshape equal weights
+     * into equal workspaces.
+     *
+     * @return The key, empty if the weights are reshaped on every run
+     */
+    const std::string &packed_weights_key() const;
+    /** Marks the operator as prepared from reshaped weights already held in the persistent workspace of @p tensors
+     *
+     * @param[in] tensors Tensor pack holding the weights and the workspace filled by a previous @ref prepare
+     */
+    void prepare_from_packed(ITensorPack &tensors);
+
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
     enum AuxTensorIdx
@@ -64,6 +102,13 @@ private:
         PreTransposedRHS,
         Transposed1xWRHS,
         TempResult,
+        QuantizedLHS,
+        LHSScales,
+        QuantizedRHS,
+        RHSScales,
+        Accumulators,
+        PackedRHS,
+        RHSGroupScales,
         Count
     };
 
@@ -71,10 +116,21 @@ private:
     TensorInfo _pretransposed_b{};
     TensorInfo _tmp_b{};
     TensorInfo _tmp_d{};
+    TensorInfo _quantized_a{};
+    TensorInfo _a_scales{};
+    TensorInfo _quantized_b{};
+    TensorInfo _b_scales{};
+    TensorInfo _accumulators{};
+    TensorInfo _packed_b{};
+    TensorInfo _b_group_scales{};
 
+    bool _is_prepared{false};
     bool _run_vector_matrix_multiplication{false};
     bool _run_bias_addition{false};
     bool _reshape_b_only_on_first_run{false};
+    bool _run_dynamic_int8{false};
+    bool _run_weight_only{false};
+    bool _run_activation{false};
     bool _run_interleave_transpose{
         true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
 
@@ -83,8 +139,16 @@ private:
     std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>  _interleave_kernel{nullptr};
     std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>   _transpose1xW_b_kernel{nullptr};
     std::unique_ptr<kernels::CpuAddVecKernel>             _add_bias{nullptr};
+    std::unique_ptr<kernels::CpuAddVecKernel>             _activation_kernel{nullptr};
+    std::unique_ptr<CpuGemmAssemblyDispatch>              _asm_glue{nullptr};
+    std::unique_ptr<kernels::CpuQuantizeRowsKernel>       _quantize_a_kernel{nullptr};
+    std::unique_ptr<kernels::CpuQuantizeRowsKernel>       _quantize_b_kernel{nullptr};
+    std::unique_ptr<kernels::CpuLinearDequantizeKernel>   _dequantize_kernel{nullptr};
+    std::unique_ptr<kernels::CpuWeightOnlyPackKernel>     _pack_b_kernel{nullptr};
+    std::unique_ptr<kernels::CpuWeightOnlyGemvKernel>     _weight_only_gemv_kernel{nullptr};
 
     experimental::MemoryRequirements _aux_mem{Count};
+    std::string                      _packed_weights_key{};
 };
 
 } // namespace cpu
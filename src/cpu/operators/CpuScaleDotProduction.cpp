@@ -10,73 +10,94 @@
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
-#include "arm_compute/runtime/CL/CLTensor.h"
-
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
+#include <algorithm>
+#include <cstring>
+#include <utility>
 
 
 namespace arm_compute
 {
-std::unique_ptr<ITensor> create_mask(TensorInfo * mask_target)
-{
-    // Create tensor info
-    TensorInfo mask_info = *mask_target->clone();
-    auto mask_tensor = std::make_unique<Tensor>();
-    mask_tensor->allocator()->init(mask_info);
-    mask_tensor->allocator()->allocate();
-
-    // Fill mask manually
-    Window window;
-    window.use_tensor_dimensions(mask_info.tensor_shape());
-
-    Iterator it(mask_tensor.get(), window);
-    execute_window_loop(window, [&](const Coordinates &coords) {
-        const int i = coords.y();
-        const int j = coords.x();
-
-        float *ptr = reinterpret_cast<float *>(it.ptr());
-        *ptr = (j > i) ? -1e9f : 0.0f;
-    }, it);
-
-    return mask_tensor;
-}
 namespace cpu
 {
+namespace
+{
+/** Copies the valid rows of @p rows after the rows held by @p cache and grows the cache valid region */
+void append_to_cache(const ITensor *rows, ITensor *cache)
+{
+    const ITensorInfo *rows_info = rows->info();
+    const size_t       held      = cache->info()->valid_region().shape.y();
+    const size_t       num_rows  = std::min(rows_info->dimension(1), rows_info->valid_region().shape.y());
+    if(held + num_rows > cache->info()->dimension(1))
+    {
+        ARM_COMPUTE_ERROR("KV cache is full, reset it or raise its length");
+    }
+
+    const size_t row_bytes = rows_info->dimension(0) * rows_info->element_size();
+    for(size_t z = 0; z < rows_info->dimension(2); ++z)
+    {
+        for(size_t y = 0; y < num_rows; ++y)
+        {
+            std::memcpy(cache->ptr_to_element(Coordinates(0, held + y, z)), rows->ptr_to_element(Coordinates(0, y, z)), row_bytes);
+        }
+    }
+
+    ValidRegion valid_region = cache->info()->valid_region();
+    valid_region.shape.set(1, held + num_rows, false);
+    cache->info()->set_valid_region(valid_region);
+}
+} // namespace
+
 
 void CpuScaleDotProduction::configure(const ITensorInfo                 *query,
                                       const ITensorInfo                 *key,
                                       const ITensorInfo                 *value,
                                       ITensorInfo                       *output,
                                       const ScaleDotProductionLayerInfo &info,
-                                      int                                recurrence_count)
+                                      int                                recurrence_count,
+                                      const ITensorInfo                 *key_cache,
+                                      const ITensorInfo                 *value_cache,
+                                      const ITensorInfo                 *lengths)
 {
     _recurrence_count = recurrence_count;
 
     ARM_COMPUTE_LOG_PARAMS(key, value, query, output);
 
-    TensorShape query_buffer = TensorShape(query->tensor_shape().x(),
-                                           query->tensor_shape().y(),
-                                           query->tensor_shape().z(),
-                                           1);
-    TensorShape key_buffer   = TensorShape(key->tensor_shape().x(),
-                                           key->tensor_shape().y(),
-                                           key->tensor_shape().z(),
-                                           1);
-    TensorShape value_buffer = TensorShape(value->tensor_shape().x(),
-                                           value->tensor_shape().y(),
-                                           value->tensor_shape().z(),
-                                           1);
-    TensorShape output_buffer = TensorShape(output->tensor_shape().x(),
-                                           output->tensor_shape().y(),
-                                           output->tensor_shape().z(),
-                                           1);
-    _query_cpu_buffer        = query->clone()->set_tensor_shape(query_buffer);
-    _key_cpu_buffer          = key->clone()->set_tensor_shape(key_buffer);
-    _value_cpu_buffer        = value->clone()->set_tensor_shape(value_buffer);
-    _ouput_cpu_buffer        = output->clone()->set_tensor_shape(output_buffer);
+    // Decoding attends over the cached history, only the fused kernel reads keys past the current tokens
+    _use_kv_cache = key_cache != nullptr;
+    if(_use_kv_cache)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(value_cache);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(key, key_cache, value_cache);
+        ARM_COMPUTE_ERROR_ON(key_cache->dimension(0) != key->dimension(0) || value_cache->dimension(0) != value->dimension(0));
+        ARM_COMPUTE_ERROR_THROW_ON(kernels::CpuFlashAttentionKernel::validate(query, key_cache, value_cache, output, info));
+
+        _run_fused_attention    = true;
+        _flash_attention_kernel = std::make_unique<kernels::CpuFlashAttentionKernel>();
+        _flash_attention_kernel->configure(query, key_cache, value_cache, output, info);
+        return;
+    }
+
+    // A batch of padded sequences is masked per sequence, only the fused kernel reads the lengths
+    _use_lengths = lengths != nullptr;
+    if(_use_lengths)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_use_kv_cache, "Batched sequences cannot be decoded with a KV cache");
+        ARM_COMPUTE_ERROR_THROW_ON(kernels::CpuFlashAttentionKernel::validate(query, key, value, output, info, lengths));
+
+        _run_fused_attention    = true;
+        _flash_attention_kernel = std::make_unique<kernels::CpuFlashAttentionKernel>();
+        _flash_attention_kernel->configure(query, key, value, output, info, lengths);
+        return;
+    }
+
+    // Fused attention streams over the keys with an online softmax, so the score matrix is never materialised
+    _run_fused_attention = bool(kernels::CpuFlashAttentionKernel::validate(query, key, value, output, info));
+    if(_run_fused_attention)
+    {
+        _flash_attention_kernel = std::make_unique<kernels::CpuFlashAttentionKernel>();
+        _flash_attention_kernel->configure(query, key, value, output, info);
+        return;
+    }
 
     // Query multi-Head reshape
     TensorShape query_reshape = TensorShape(query->tensor_shape().x() / info.h(),
@@ -132,48 +153,31 @@ void CpuScaleDotProduction::configure(const ITensorInfo                 *query,
     // Configure interleave kernel
     _query_interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
     _query_interleave_kernel->configure(&_permuted_query, &_tmp_query);
-    _aux_mem[InterleavedLHS] =
-        experimental::MemoryInfo(offset_int_vec(InterleavedLHS), experimental::MemoryLifetime::Persistent, _tmp_query.total_size());
 
     // Configure rhs transpose1xw kernel
     _key_transpose1xW_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
     _key_transpose1xW_kernel->configure(&_transposed_key, &_tmp_key);
-    _aux_mem[Transposed1xWRHS] =
-        experimental::MemoryInfo(offset_int_vec(Transposed1xWRHS), experimental::MemoryLifetime::Persistent, _tmp_key.total_size());
 
     // Matrix multiply compute multi-head attention between Query and Key
     _product_mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
     const int   m      = _permuted_query.dimension(1);
     const int   n      = _transposed_key.dimension(0);
     const int   k      = _permuted_query.dimension(0);
-    const float scale  = 1.0f / sqrt(info.d_model() / info.h());
-    _product_mm_kernel->configure(&_tmp_query, &_tmp_key, &_scaled_query_key, scale, true, GEMMReshapeInfo(m, n, k));
+    _product_mm_kernel->configure(&_tmp_query, &_tmp_key, &_scaled_query_key, 1.0f, true, GEMMReshapeInfo(m, n, k));
 
-    // enable and configure masking of the query-key product
+    // Scale, mask and softmax the query-key product in a single pass
+    const float scale  = 1.0f / sqrt(info.d_model() / info.h());
     _is_masked = info.is_masked();
-    if (_is_masked)
-    {
-        _masked_scaled_kq = *_scaled_query_key.clone();
-        _mask_info = *_scaled_query_key.clone();
-        _masking_kernel = std::make_unique<kernels::CpuAddKernel>();
-        _masking_kernel->configure(&_scaled_query_key, &_mask_info, &_masked_scaled_kq, ConvertPolicy::WRAP);
-    }
-
-    //  Softmax of previous product 
-    _softmax_func = std::make_unique<cpu::CpuSoftmaxGeneric>();
-    _softmax_func->configure(&_scaled_query_key, &_softmaxed_product);
+    _scale_mask_softmax_kernel = std::make_unique<kernels::CpuScaleMaskSoftmaxKernel>();
+    _scale_mask_softmax_kernel->configure(&_scaled_query_key, &_softmaxed_product, scale, _is_masked);
 
     // Configure interleave kernel
     _product_interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
     _product_interleave_kernel->configure(&_softmaxed_product, &_interleaved_product);
-    _aux_mem[InterleavedProduct] =
-        experimental::MemoryInfo(offset_int_vec(InterleavedProduct), experimental::MemoryLifetime::Persistent, _interleaved_product.total_size());
 
     // Configure rhs transpose1xw kernel
     _value_transpose1xW_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
     _value_transpose1xW_kernel->configure(&_permuted_value, &_transposed1xW_value);
-    _aux_mem[Transposed1xWValue] =
-        experimental::MemoryInfo(offset_int_vec(Transposed1xWValue), experimental::MemoryLifetime::Persistent, _transposed1xW_value.total_size());
 
     //  Multiply between scaled product and value
     _context_mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
@@ -194,6 +198,30 @@ void CpuScaleDotProduction::configure(const ITensorInfo                 *query,
 
     _concat_reshape_kernel = std::make_unique<kernels::CpuReshapeKernel>();
     _concat_reshape_kernel->configure(&_permuted_concat, output);
+
+    // Every intermediate is recomputed from the inputs of the run
+    const std::pair<AuxTensorIdx, const TensorInfo *> intermediates[] = {
+        { InterleavedLHS, &_tmp_query },
+        { Transposed1xWRHS, &_tmp_key },
+        { InterleavedProduct, &_interleaved_product },
+        { Transposed1xWValue, &_transposed1xW_value },
+        { QueryReshape, &_reshaped_query },
+        { QueryPermute, &_permuted_query },
+        { KeyReshape, &_reshaped_key },
+        { KeyPermute, &_permuted_key },
+        { ValueReshape, &_reshaped_value },
+        { ValuePermute, &_permuted_value },
+        { KeyTranspose, &_transposed_key },
+        { QueryKeyScale, &_scaled_query_key },
+        { Softmax, &_softmaxed_product },
+        { GemmedContext, &_gemmed_context },
+        { ConcatPermute, &_permuted_concat },
+    };
+    for(const auto &intermediate : intermediates)
+    {
+        _aux_mem[intermediate.first] = experimental::MemoryInfo(offset_int_vec(intermediate.first), experimental::MemoryLifetime::Temporary,
+                                                                intermediate.second->total_size());
+    }
 }
 
 Status
@@ -215,117 +243,34 @@ void CpuScaleDotProduction::run(ITensorPack &tensors)
     auto value  = tensors.get_tensor(ACL_SRC_2);
     auto output = tensors.get_tensor(ACL_DST);
 
-    std::cout << "query id: " << query->info()->id() << std::endl;
-    std::cout << "key id: " << key->info()->id() << std::endl;
-    std::cout << "value id: " << value->info()->id() << std::endl;
-    std::cout << "output id: " << output->info()->id() << std::endl;
-
-    ICLTensor *query_cl;
-    ICLTensor *key_cl;
-    ICLTensor *value_cl;
-    //ICLTensor *output_cl;
-
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-    /*
-if(_recurrence_count ==0){
-    if(query->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *query_nc = const_cast<ITensor *>(query);
-        query_cl          = static_cast<ICLTensor *>(query_nc);
-        query_cl->map(CLScheduler::get().queue());
-    }
-
-    if(key->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *key_nc = const_cast<ITensor *>(key);
-        key_cl          = static_cast<ICLTensor *>(key_nc);
-        key_cl->map(CLScheduler::get().queue());
-    }
+    // CL-backed inputs and output are host mapped by the graph at the device boundary, so they are read in place
+    const ITensor *query_to_use = query;
+    const ITensor *key_to_use   = key;
+    const ITensor *value_to_use = value;
 
-    if(value->info()->tensor_target_type() == TensorTargetType::CL)
+    if(_use_kv_cache)
     {
-        ITensor *value_nc = const_cast<ITensor *>(value);
-        value_cl          = static_cast<ICLTensor *>(value_nc);
-        value_cl->map(CLScheduler::get().queue());
+        auto key_cache   = tensors.get_tensor(ACL_SRC_3);
+        auto value_cache = tensors.get_tensor(ACL_SRC_4);
+        append_to_cache(key_to_use, key_cache);
+        append_to_cache(value_to_use, value_cache);
+
+        ITensorPack attention_pack{ { ACL_SRC_0, query_to_use }, { ACL_SRC_1, key_cache }, { ACL_SRC_2, value_cache }, { ACL_DST, output } };
+        NEScheduler::get().schedule_op(_flash_attention_kernel.get(), Window::DimY, _flash_attention_kernel->window(), attention_pack);
+        return;
     }
 
-    if(output->info()->tensor_target_type() == TensorTargetType::CL)
+    if(_run_fused_attention)
     {
-        output_cl          = static_cast<ICLTensor *>(output);
-        output_cl->map(CLScheduler::get().queue());
-    }
-}
-    std::cout << "query_cl CL_value: " << *reinterpret_cast<float *>(query->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    std::cout << "key_cl CL_value: " << *reinterpret_cast<float *>(key->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    std::cout << "value_cl CL_value: " << *reinterpret_cast<float *>(value->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    std::cout << "output_cl CL_value: " << *reinterpret_cast<float *>(output->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    */
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "mapping cost: " << cost_time << std::endl;
-#endif
-
-#ifdef MEASURE_TIME
-    auto read_start_time = std::chrono::high_resolution_clock::now();
-#endif
-    
-    CpuAuxTensorHandler query_cpu_buffer_aux(offset_int_vec(QueryCPUBuffer), _query_cpu_buffer, tensors);
-    CpuAuxTensorHandler key_cpu_buffer_aux(offset_int_vec(ValueCPUBuffer), _key_cpu_buffer, tensors);
-    CpuAuxTensorHandler value_cpu_buffer_aux(offset_int_vec(KeyCPUBuffer), _value_cpu_buffer, tensors);
-    CpuAuxTensorHandler output_cpu_buffer_aux(offset_int_vec(OuputCPUBuffer), _ouput_cpu_buffer, tensors);
-
-    if(query->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *query_nc = const_cast<ITensor *>(query);
-        query_cl          = static_cast<ICLTensor *>(query_nc);
-        if(_recurrence_count ==0)
+        ITensorPack attention_pack{ { ACL_SRC_0, query_to_use }, { ACL_SRC_1, key_to_use }, { ACL_SRC_2, value_to_use }, { ACL_DST, output } };
+        if(_use_lengths)
         {
-            query_cl->map(CLScheduler::get().queue());
+            attention_pack.add_const_tensor(ACL_SRC_3, tensors.get_const_tensor(ACL_SRC_5));
         }
-        CLScheduler::get().queue().enqueueReadBuffer(query_cl->cl_buffer(), CL_TRUE, 0, query_cpu_buffer_aux.get()->info()->total_size(), query_cpu_buffer_aux.get()->buffer());
-        std::cout << "Aux CL_query: " << *reinterpret_cast<float *>(query_cpu_buffer_aux.get()->ptr_to_element(Coordinates(0,0,0))) << std::endl;
+        NEScheduler::get().schedule_op(_flash_attention_kernel.get(), Window::DimY, _flash_attention_kernel->window(), attention_pack);
+        return;
     }
 
-    if(key->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *key_nc = const_cast<ITensor *>(key);
-        key_cl          = static_cast<ICLTensor *>(key_nc);
-        if(_recurrence_count ==0)
-        {
-            key_cl->map(CLScheduler::get().queue());
-        }
-        CLScheduler::get().queue().enqueueReadBuffer(key_cl->cl_buffer(), CL_TRUE, 0, key_cpu_buffer_aux.get()->info()->total_size(), key_cpu_buffer_aux.get()->buffer());
-        std::cout << "Aux CL_key: " << *reinterpret_cast<float *>(key_cpu_buffer_aux.get()->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    }
-
-    if(value->info()->tensor_target_type() == TensorTargetType::CL)
-    {
-        ITensor *value_nc = const_cast<ITensor *>(value);
-        value_cl          = static_cast<ICLTensor *>(value_nc);
-        if(_recurrence_count ==0)
-        {
-            value_cl->map(CLScheduler::get().queue());
-        }
-        CLScheduler::get().queue().enqueueReadBuffer(value_cl->cl_buffer(), CL_TRUE, 0, value_cpu_buffer_aux.get()->info()->total_size(), value_cpu_buffer_aux.get()->buffer());
-        std::cout << "Aux CL_value: " << *reinterpret_cast<float *>(value_cpu_buffer_aux.get()->ptr_to_element(Coordinates(0,0,0))) << std::endl;
-    }
-    //CLScheduler::get().queue().enqueueReadBuffer(query_cl->cl_buffer(), CL_TRUE, 0, query_cpu_buffer_aux.get()->info()->total_size(), query_cpu_buffer_aux.get()->buffer());
-    //CLScheduler::get().queue().enqueueReadBuffer(key_cl->cl_buffer(), CL_TRUE, 0, key_cpu_buffer_aux.get()->info()->total_size(), value_cpu_buffer_aux.get()->buffer());
-    //CLScheduler::get().queue().enqueueReadBuffer(value_cl->cl_buffer(), CL_TRUE, 0, value_cpu_buffer_aux.get()->info()->total_size(), key_cpu_buffer_aux.get()->buffer());
-
-
-#ifdef MEASURE_TIME
-    auto   read_end_time  = std::chrono::high_resolution_clock::now();
-    double read_cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(read_end_time - read_start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "Reading cost: " << read_cost_time << std::endl;
-#endif
-
     CpuAuxTensorHandler reshaped_query(offset_int_vec(QueryReshape), _reshaped_query, tensors);
     CpuAuxTensorHandler permuted_query(offset_int_vec(QueryPermute), _permuted_query, tensors);
     CpuAuxTensorHandler reshaped_key(offset_int_vec(KeyReshape), _reshaped_key, tensors);
@@ -344,98 +289,31 @@ if(_recurrence_count ==0){
     CpuAuxTensorHandler gemmed_context(offset_int_vec(GemmedContext), _gemmed_context, tensors);
 
     // Run Query multi-Head reshape
-    ITensorPack query_reshape_pack{ { ACL_SRC_0, query_cpu_buffer_aux.get() }, { ACL_DST, reshaped_query.get() } };
+    ITensorPack query_reshape_pack{ { ACL_SRC_0, query_to_use }, { ACL_DST, reshaped_query.get() } };
     NEScheduler::get().schedule_op(_query_reshape_kernel.get(), Window::DimY, _query_reshape_kernel->window(), query_reshape_pack);
     //const auto query_split_dimension = _query_reshape_kernel->get_split_dimension();
-    /*
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "query_reshape cost: " << cost_time << std::endl;
-#endif
-*/
 
     ITensorPack query_permute_pack{ { ACL_SRC, reshaped_query.get() }, { ACL_DST, permuted_query.get() } };
     _query_permute_func->run(query_permute_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "query_permute_func cost: " << cost_time << std::endl;
-#endif
-*/
 
     // Run Key multi-Head reshape
-    ITensorPack key_reshape_pack{ { ACL_SRC_0, key_cpu_buffer_aux.get() }, { ACL_DST, reshaped_key.get() } };
+    ITensorPack key_reshape_pack{ { ACL_SRC_0, key_to_use }, { ACL_DST, reshaped_key.get() } };
     NEScheduler::get().schedule_op(_key_reshape_kernel.get(), Window::DimY, _key_reshape_kernel->window(), key_reshape_pack);
     //const auto key_split_dimension = _key_reshape_kernel->get_split_dimension();
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "key_reshape cost: " << cost_time << std::endl;
-#endif
-*/
 
     ITensorPack key_permute_pack{ { ACL_SRC, reshaped_key.get() }, { ACL_DST, permuted_key.get() } };
     _key_permute_func->run(key_permute_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "key_permute_func cost: " << cost_time << std::endl;
-#endif
-*/
 
     ITensorPack key_transpose_pack{ { ACL_SRC, permuted_key.get() }, { ACL_DST, transposed_key.get() } };
     _key_transpose_func->run(key_transpose_pack);
 
     // Run Value multi-Head reshape
-    ITensorPack value_reshape_pack{ { ACL_SRC_0, value_cpu_buffer_aux.get() }, { ACL_DST, reshaped_value.get() } };
+    ITensorPack value_reshape_pack{ { ACL_SRC_0, value_to_use }, { ACL_DST, reshaped_value.get() } };
     NEScheduler::get().schedule_op(_value_reshape_kernel.get(), Window::DimY, _value_reshape_kernel->window(), value_reshape_pack);
     //const auto value_split_dimension = _value_reshape_kernel->get_split_dimension();
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "value_reshape cost: " << cost_time << std::endl;
-#endif
-*/
 
     ITensorPack value_permute_pack{ { ACL_SRC, reshaped_value.get() }, { ACL_DST, permuted_value.get() } };
     _value_permute_func->run(value_permute_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "value_permute_func cost: " << cost_time << std::endl;
-#endif
-*/
 
     // Run interleave kernel
     ITensorPack interleave_pack{ { ACL_SRC, permuted_query.get() }, { ACL_DST, interleaved_query.get() } };
@@ -450,38 +328,14 @@ if(_recurrence_count ==0){
     // Run matrix multiply compute multi-head attention between Query and Key
     ITensorPack gemm_QK_pack{ { ACL_SRC_0, interleaved_query.get() }, { ACL_SRC_1, transposed1xw_key.get() }, { ACL_DST, scaled_query_key.get() } };
     NEScheduler::get().schedule_op(_product_mm_kernel.get(), Window::DimZ, _product_mm_kernel->window(), gemm_QK_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "MMUL QK cost: " << cost_time << std::endl;
-#endif
-*/
-
-    if (_is_masked)
-    {
-        CpuAuxTensorHandler masked_scaled_kq(offset_int_vec(Mask), _masked_scaled_kq, tensors);
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-        _mask = create_mask(&_mask_info);
-        ITensorPack masking_pack{{ACL_SRC_0, scaled_query_key.get()}, {ACL_SRC_1, _mask.get()}, {ACL_DST, masked_scaled_kq.get()}};
-        NEScheduler::get().schedule_op(_masking_kernel.get(),Window::DimZ,_masking_kernel->window(),masking_pack);
-        scaled_query_key.get()->copy_from(*masked_scaled_kq.get());
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "CpuMasking cost: " << cost_time << std::endl;
-#endif
-    }
+
+    // Keys past the key valid region are padding, expose them to the softmax as invalid score columns
+    ValidRegion score_valid_region = scaled_query_key.get()->info()->valid_region();
+    score_valid_region.shape.set(0, std::min(score_valid_region.shape.x(), key_to_use->info()->valid_region().shape.y()));
+    scaled_query_key.get()->info()->set_valid_region(score_valid_region);
 
     ITensorPack softmax_pack = {{ACL_SRC, scaled_query_key.get()}, {ACL_DST, softmaxed_product.get()}};
-    _softmax_func->run(softmax_pack);
+    NEScheduler::get().schedule_op(_scale_mask_softmax_kernel.get(), Window::DimY, _scale_mask_softmax_kernel->window(), softmax_pack);
 
     // Run interleave kernel
     ITensorPack interleave_product_pack{ { ACL_SRC, softmaxed_product.get() }, { ACL_DST, interleaved_product.get() } };
@@ -496,56 +350,16 @@ if(_recurrence_count ==0){
     // Run matrix multiply compute multi-head attention between Query and Key
     ITensorPack gemm_context_pack{ { ACL_SRC_0, interleaved_product.get() }, { ACL_SRC_1, transposed1xW_value.get() }, { ACL_DST, gemmed_context.get() } };
     NEScheduler::get().schedule_op(_context_mm_kernel.get(), Window::DimZ, _context_mm_kernel->window(), gemm_context_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "MMUL CV cost: " << cost_time << std::endl;
-#endif
-*/
 
     // Concat all attention head together
     ITensorPack concat_permute_pack{ { ACL_SRC, gemmed_context.get() }, { ACL_DST, permuted_concat.get() } };
     _concat_permute_func->run(concat_permute_pack);
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "concat_permute_func cost: " << cost_time << std::endl;
-#endif
-*/
-
-    if (output->buffer() == nullptr) 
-    {
-        ICLTensor * output_cl = static_cast<ICLTensor *>(output);
-        output_cl->map(CLScheduler::get().queue());
-    }
 
     ITensorPack concat_reshape_pack{ { ACL_SRC_0, permuted_concat.get() }, { ACL_DST, output} };
     NEScheduler::get().schedule_op(_concat_reshape_kernel.get(), Window::DimY, _concat_reshape_kernel->window(), concat_reshape_pack);
     
 
     //const auto concat_split_dimension = _concat_reshape_kernel->get_split_dimension();
-    /*
-#ifdef MEASURE_TIME
-    start_time = std::chrono::high_resolution_clock::now();
-#endif
-#ifdef MEASURE_TIME
-    end_time  = std::chrono::high_resolution_clock::now();
-    cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    measure_out.precision(5);
-    measure_out << std::scientific << "concat_reshape cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
-*/
 }
 
 experimental::MemoryRequirements CpuScaleDotProduction::workspace() const
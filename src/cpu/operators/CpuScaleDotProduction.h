@@ -14,6 +14,8 @@
 #include "src/cpu/kernels/CpuGemmInterleave4x4Kernel.h"
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/kernels/CpuAddKernel.h"
+#include "src/cpu/kernels/CpuFlashAttentionKernel.h"
+#include "src/cpu/kernels/CpuScaleMaskSoftmaxKernel.h"
 
 #include "src/cpu/kernels/CpuReshapeKernel.h"
 #include "src/cpu/operators/CpuPermute.h"
@@ -28,7 +30,8 @@ namespace arm_compute
 namespace cpu
 {
 /** Function implementation for scale dot production, uses kernels:
- * @ref kernels::CpuEmbedKernel
+ * @ref kernels::CpuFlashAttentionKernel when the configuration is supported by the fused kernel, otherwise
+ * @ref kernels::CpuGemmMatrixMultiplyKernel and @ref kernels::CpuScaleMaskSoftmaxKernel over the materialised score matrix.
 */
 class CpuScaleDotProduction : public ICpuOperator
 {
@@ -40,12 +43,20 @@ public:
     
     /** Configure operator for a given list of arguments
      * 
+     * With a key and value cache, the valid rows of @p key and @p value are appended to the rows already held by the
+     * caches on every run and the queries attend over the whole cache.
+     *
      * @param[in]  query           Attention key tensor info. Data types supported: F32.
      * @param[in]  key             Attention key tensor info. Data types supported: F32.
      * @param[in]  value           Attention value tensor info. Data types supported: F32.
      * @param[out] output          Destination tensor info. Data type supported: F32
+     * @param[in]  key_cache       (Optional) Key history, shape (d_model, max_len). Its valid region holds the cached rows.
+     * @param[in]  value_cache     (Optional) Value history, same shape as @p key_cache.
+     * @param[in]  lengths         (Optional) Valid length of each sequence when the rows hold a batch of padded sequences,
+     *                             shape (batch). Data types supported: U32. Passed as ACL_SRC_5 at run time.
      */
-    void configure( const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, ITensorInfo *output, const ScaleDotProductionLayerInfo& info, int recurrence_count);
+    void configure( const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, ITensorInfo *output, const ScaleDotProductionLayerInfo& info, int recurrence_count,
+                    const ITensorInfo *key_cache = nullptr, const ITensorInfo *value_cache = nullptr, const ITensorInfo *lengths = nullptr);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuScaleDotProduction::configure()
@@ -79,12 +90,7 @@ private:
         Softmax,
         GemmedContext,
         ConcatPermute,
-        QueryCPUBuffer,
-        KeyCPUBuffer,
-        ValueCPUBuffer,
-        OuputCPUBuffer,
-        Count,
-        Mask
+        Count
     };
 
     std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>    _query_interleave_kernel{nullptr};
@@ -105,9 +111,8 @@ private:
     std::unique_ptr<kernels::CpuReshapeKernel>              _concat_reshape_kernel{nullptr};
     std::unique_ptr<CpuPermute>                             _concat_permute_func{nullptr};
     std::unique_ptr<CpuTranspose>                           _key_transpose_func{nullptr};
-    std::unique_ptr<CpuSoftmaxGeneric>                      _softmax_func{nullptr};
-    std::unique_ptr<kernels::CpuAddKernel>                  _masking_kernel{nullptr};
-    std::unique_ptr<ITensor>                                _mask{nullptr};
+    std::unique_ptr<kernels::CpuScaleMaskSoftmaxKernel>     _scale_mask_softmax_kernel{nullptr};
+    std::unique_ptr<kernels::CpuFlashAttentionKernel>       _flash_attention_kernel{nullptr};
 
     
 
@@ -127,13 +132,6 @@ private:
     TensorInfo _scaled_query_key{};
     TensorInfo _softmaxed_product{};
     TensorInfo _gemmed_context{};
-    TensorInfo _masked_scaled_kq{};
-    TensorInfo _mask_info{};
-
-    TensorInfo _query_cpu_buffer{};
-    TensorInfo _key_cpu_buffer{};
-    TensorInfo _value_cpu_buffer{};
-    TensorInfo _ouput_cpu_buffer{};
 
     bool _run_pretranspose{false};
     bool _run_scale{false};
@@ -141,6 +139,9 @@ private:
     bool _run_interleave_transpose{
         true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
     bool _is_masked{false};
+    bool _run_fused_attention{false}; /**< If we run CpuFlashAttentionKernel instead of the unfused GEMM/softmax chain */
+    bool _use_kv_cache{false};        /**< If the keys and values are appended to the caches passed as ACL_SRC_3/ACL_SRC_4 */
+    bool _use_lengths{false};         /**< If the rows hold a batch of sequences whose lengths are passed as ACL_SRC_5 */
 
     experimental::MemoryRequirements _aux_mem{Count};
 
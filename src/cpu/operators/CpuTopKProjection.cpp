@@ -0,0 +1,117 @@
+#include "src/cpu/operators/CpuTopKProjection.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+TensorInfo candidates_info(const ITensorInfo *weights, const TopKProjectionLayerInfo &info)
+{
+    const unsigned int blocks = kernels::CpuTopKProjectionKernel::num_blocks(weights->dimension(1));
+    return TensorInfo(TensorShape(2U, info.k(), blocks, info.num_rows()), 1, DataType::F32);
+}
+} // namespace
+
+void CpuTopKProjection::configure(const ITensorInfo             *src,
+                                  const ITensorInfo             *weights,
+                                  const ITensorInfo             *bias,
+                                  ITensorInfo                   *dst,
+                                  const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, weights, bias, dst);
+
+    auto_init_if_empty(*dst, TensorInfo(TensorShape(2U, info.k(), info.num_rows()), 1, DataType::F32));
+    ARM_COMPUTE_ERROR_THROW_ON(CpuTopKProjection::validate(src, weights, bias, dst, info));
+
+    _info       = info;
+    _candidates = candidates_info(weights, info);
+
+    _projection_kernel = std::make_unique<kernels::CpuTopKProjectionKernel>();
+    _projection_kernel->configure(src, weights, bias, &_candidates, info);
+
+    _aux_mem[BlockCandidates] =
+        MemoryInfo(offset_int_vec(BlockCandidates), MemoryLifetime::Temporary, _candidates.total_size());
+}
+
+Status CpuTopKProjection::validate(const ITensorInfo             *src,
+                                   const ITensorInfo             *weights,
+                                   const ITensorInfo             *bias,
+                                   const ITensorInfo             *dst,
+                                   const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+
+    const TensorInfo candidates = candidates_info(weights, info);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuTopKProjectionKernel::validate(src, weights, bias, &candidates, info));
+
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           TensorShape(2U, info.k(), info.num_rows()));
+    }
+    return Status{};
+}
+
+void CpuTopKProjection::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler candidates(offset_int_vec(BlockCandidates), _candidates, tensors, true);
+
+    ITensorPack pack = tensors;
+    pack.add_tensor(TensorType::ACL_DST, candidates.get());
+    NEScheduler::get().schedule_op(_projection_kernel.get(), Window::DimX, _projection_kernel->window(), pack);
+
+    // Merge the best k of every block, the blocks are few so this runs on the calling thread
+    const unsigned int k      = _info.k();
+    const unsigned int blocks = static_cast<unsigned int>(_candidates.dimension(2));
+    const ITensor     *part   = candidates.get();
+
+    std::vector<std::pair<float, float>> merged(k * blocks);
+    for(unsigned int r = 0; r < _info.num_rows(); ++r)
+    {
+        for(unsigned int b = 0; b < blocks; ++b)
+        {
+            for(unsigned int i = 0; i < k; ++i)
+            {
+                const float id    = *reinterpret_cast<const float *>(part->ptr_to_element(Coordinates(0, i, b, r)));
+                const float score = *reinterpret_cast<const float *>(part->ptr_to_element(Coordinates(1, i, b, r)));
+                merged[b * k + i] = std::make_pair(score, id);
+            }
+        }
+        std::partial_sort(merged.begin(), merged.begin() + k, merged.end(),
+                          [](const std::pair<float, float> &a, const std::pair<float, float> &b)
+                          { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            *reinterpret_cast<float *>(dst->ptr_to_element(Coordinates(0, i, r))) = merged[i].second;
+            *reinterpret_cast<float *>(dst->ptr_to_element(Coordinates(1, i, r))) = merged[i].first;
+        }
+    }
+}
+
+experimental::MemoryRequirements CpuTopKProjection::workspace() const
+{
+    return _aux_mem;
+}
+
+} // namespace cpu
+} // namespace arm_compute
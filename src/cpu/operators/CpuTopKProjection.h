@@ -0,0 +1,67 @@
+#ifndef ARM_COMPUTE_CPU_TOPK_PROJECTION_H
+#define ARM_COMPUTE_CPU_TOPK_PROJECTION_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuTopKProjectionKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+/** Basic function to run @ref kernels::CpuTopKProjectionKernel
+ * @note Performs dst[r] = topk(weights * src[rows[r]] + bias) without storing the logits
+*/
+class CpuTopKProjection : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src     Input tensor info, shape (d_model, seq_len). Data type supported: F32.
+     * @param[in]  weights Weights tensor info, shape (d_model, d_vocab). Data type supported: Same as @p src.
+     * @param[in]  bias    Bias tensor info, shape (d_vocab). Can be nullptr. Data type supported: Same as @p src.
+     * @param[out] dst     Destination tensor info, shape (2, k, num_rows). Holds the (id, score) pairs of every
+     *                     projected row from the best to the worst score. Data type supported: F32.
+     * @param[in]  info    Top-k projection layer information.
+     */
+    void configure(const ITensorInfo             *src,
+                   const ITensorInfo             *weights,
+                   const ITensorInfo             *bias,
+                   ITensorInfo                   *dst,
+                   const TopKProjectionLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuTopKProjection::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *src,
+                           const ITensorInfo             *weights,
+                           const ITensorInfo             *bias,
+                           const ITensorInfo             *dst,
+                           const TopKProjectionLayerInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        BlockCandidates = 0,
+        Count
+    };
+
+    TensorInfo              _candidates{};
+    TopKProjectionLayerInfo _info{};
+
+    std::unique_ptr<kernels::CpuTopKProjectionKernel> _projection_kernel{nullptr};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_TOPK_PROJECTION_H */
@@ -35,6 +35,7 @@
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 #include <arm_neon.h>
+#include <sstream>
 
 namespace arm_compute
 {
@@ -206,6 +207,8 @@ public:
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &tensors) override;
+    std::string                      packed_b_layout() const override;
+    void                             prepare_from_packed(ITensorPack &tensors) override;
     bool                             is_configured() const override;
     experimental::MemoryRequirements workspace() const override;
     bool                             isVarWeightsKernel() const override
@@ -642,6 +645,52 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::string Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::packed_b_layout() const
+{
+    ARM_COMPUTE_ERROR_ON(_gemm_kernel_asm == nullptr);
+    const arm_gemm::GemmConfig cfg = _gemm_kernel_asm->get_config();
+
+    std::stringstream ss;
+    ss << cfg.filter << "/" << static_cast<int>(cfg.method) << "/" << cfg.inner_block_size << "/"
+       << cfg.outer_block_size << "/" << _run_pre_pretranspose_b << _B_pretranspose_required;
+    return ss.str();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_from_packed(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        auto b = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        auto c = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(b);
+        ARM_COMPUTE_ERROR_ON_MSG(!_is_b_constant, "Only constant weights can be prepared ahead of time");
+
+        if (c && c->info()->data_type() == DataType::S32)
+        {
+            _gemm_kernel_asm->set_quantized_bias(
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
+        }
+
+        // Point the kernel to the pretransposed array instead of filling it
+        if (_B_pretranspose_required)
+        {
+            CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+            ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
+            _gemm_kernel_asm->set_pretransposed_B_data(pretranspose.get()->buffer());
+            b->mark_as_unused();
+        }
+
+        if (_gemm_info.method == AsmConvMethod::Indirect)
+        {
+            prepare_indirect_buffer(tensors);
+        }
+
+        _is_prepared = true;
+    }
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 bool Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::is_configured() const
 {
@@ -1172,6 +1221,18 @@ void CpuGemmAssemblyDispatch::prepare(ITensorPack &tensors)
     _arm_gemm->prepare(tensors);
 }
 
+std::string CpuGemmAssemblyDispatch::packed_b_layout() const
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    return _arm_gemm->packed_b_layout();
+}
+
+void CpuGemmAssemblyDispatch::prepare_from_packed(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    _arm_gemm->prepare_from_packed(tensors);
+}
+
 bool CpuGemmAssemblyDispatch::is_configured() const
 {
     return _arm_gemm && _arm_gemm->is_configured();
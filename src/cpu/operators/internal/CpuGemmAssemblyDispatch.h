@@ -92,6 +92,8 @@ public:
                                                                                 const QuantizationInfo &,
                                                                                 const bool,
                                                                                 const bool) = 0;
+        virtual std::string                      packed_b_layout() const                    = 0;
+        virtual void                             prepare_from_packed(ITensorPack &tensors)  = 0;
         virtual ~IFallback()                                                                = default;
     };
 
@@ -197,6 +199,21 @@ public:
                                         const bool                     is_prepared,
                                         const bool                     negated_offsets);
 
+    /** Layout of the prepared B: the selected kernel and its blocking
+     *
+     * Two configurations with the same layout and shapes prepare the same persistent workspace from the same B.
+     *
+     * @return The layout description
+     */
+    std::string packed_b_layout() const;
+    /** Marks the function as prepared from a B already prepared into the persistent workspace tensors of @p tensors
+     *
+     * The workspace content must come from a previous @ref prepare of a configuration with the same @ref packed_b_layout
+     *
+     * @param[in] tensors Tensor pack holding B and the workspace
+     */
+    void prepare_from_packed(ITensorPack &tensors);
+
     // Inherited methods overridden:
     void                             prepare(ITensorPack &tensors) override;
     void                             run(ITensorPack &tensors) override;
@@ -25,16 +25,19 @@ namespace kernels
 
 void ClLayerNormKernel::configure(const ClCompileContext &compile_context,
                                   const ITensorInfo      *input,
+                                  const ITensorInfo      *gamma,
+                                  const ITensorInfo      *beta,
                                   ITensorInfo            *output,
                                   LayerNormLayerInfo      info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate(input, output, info));
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input, gamma, beta, output, info));
     ARM_COMPUTE_UNUSED(compile_context);
 
     _info                 = info;
     _input                = input;
     _output               = output;
+    _has_gamma_beta       = (gamma != nullptr && beta != nullptr);
     const int layer_width = input->dimension(info.axis());
 
     // Output tensor auto initialization if not yet initialized
@@ -55,6 +58,7 @@ void ClLayerNormKernel::configure(const ClCompileContext &compile_context,
     build_opts.add_option(("-DVEC_SIZE=" + support::cpp11::to_string(vec_size_x)));
     build_opts.add_option(("-DWIDTH=" + support::cpp11::to_string(layer_width)));
     build_opts.add_option(("-DVEC_SIZE_LEFTOVER=" + support::cpp11::to_string(vec_size_x_leftovers)));
+    build_opts.add_option_if(_has_gamma_beta, "-DHAS_GAMMA_BETA");
 
     std::string kernel_name("layer_norm");
 
@@ -63,19 +67,27 @@ void ClLayerNormKernel::configure(const ClCompileContext &compile_context,
 }
 
 Status ClLayerNormKernel::validate(const ITensorInfo *input,
+                                   const ITensorInfo *gamma,
+                                   const ITensorInfo *beta,
                                    const ITensorInfo *output,
                                    LayerNormLayerInfo info)
 {
-    ARM_COMPUTE_UNUSED(input);
     ARM_COMPUTE_UNUSED(output);
     ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((gamma == nullptr) != (beta == nullptr), "Gamma and beta must be given together");
+    if(gamma != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, gamma, beta);
+        ARM_COMPUTE_RETURN_ERROR_ON(gamma->dimension(0) != input->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(beta->dimension(0) != input->dimension(0));
+    }
     return Status{};
 }
 
 void ClLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue)
 {
     const ICLTensor *input =
-        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC));
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
     ICLTensor *output = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
 
     /*
@@ -93,6 +105,15 @@ void ClLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, cl::C
     unsigned int idx   = 0;
     add_3D_tensor_argument(idx, input, slice);
     add_3D_tensor_argument(idx, output, slice);
+    if(_has_gamma_beta)
+    {
+        const ICLTensor *gamma =
+            utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_1));
+        const ICLTensor *beta =
+            utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_2));
+        add_1D_tensor_argument(idx, gamma, slice);
+        add_1D_tensor_argument(idx, beta, slice);
+    }
 
     _kernel.setArg<cl_float>(idx++, _info.epsilon());
     _kernel.setArg<cl_float>(idx++, _info.gamma());
@@ -26,11 +26,15 @@ class ClLayerNormKernel : public IClKernel
     /** Initialise the kernel's inputs and output
      *
      * @param[in]  input1 An input tensor. Data type supported: f32.
+     * @param[in]  gamma  (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     * @param[in]  beta   (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
      * @param[out] output Output tensor. Data type supported: F32.
      * @param[out] op     Logical operation to perform
      */
     void configure(const ClCompileContext &compile_context,
                    const ITensorInfo      *input,
+                   const ITensorInfo      *gamma,
+                   const ITensorInfo      *beta,
                    ITensorInfo            *output,
                    LayerNormLayerInfo      info);
     /** Static function to check if given info will lead to a valid configuration of @ref ClLayerNormKernel
@@ -41,8 +45,11 @@ class ClLayerNormKernel : public IClKernel
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *input, const ITensorInfo *output, LayerNormLayerInfo info);
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           LayerNormLayerInfo info);
 
     // Inherited methods overridden:
     void run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue) override;
@@ -50,6 +57,7 @@ class ClLayerNormKernel : public IClKernel
     private:
     const ITensorInfo *_input{ nullptr };
     ITensorInfo       *_output{ nullptr };
+    bool               _has_gamma_beta{ false };
     LayerNormLayerInfo _info{};
     LayerNormKernelPtr _run_method{ nullptr };
     std::string        _name{};
@@ -11,23 +11,24 @@ namespace opencl
 {
 void ClLayerNorm::configure(const CLCompileContext   &compile_context,
                             const ITensorInfo        *input,
+                            const ITensorInfo        *gamma,
+                            const ITensorInfo        *beta,
                             ITensorInfo              *output,
                             const LayerNormLayerInfo &info)
 {
     auto k = std::make_unique<kernels::ClLayerNormKernel>();
-    k->configure(compile_context, input, output, info);
+    k->configure(compile_context, input, gamma, beta, output, info);
     _layer_norm_kernel = std::move(k); 
 }
 
 Status
 ClLayerNorm::validate(const ITensorInfo        *input,
-                      ITensorInfo              *output,
+                      const ITensorInfo        *gamma,
+                      const ITensorInfo        *beta,
+                      const ITensorInfo        *output,
                       const LayerNormLayerInfo &info)
 {
-    ARM_COMPUTE_UNUSED(input);
-    ARM_COMPUTE_UNUSED(output);
-    ARM_COMPUTE_UNUSED(info);
-    return Status{};
+    return kernels::ClLayerNormKernel::validate(input, gamma, beta, output, info);
 }
 
 void ClLayerNorm::run(ITensorPack &tensors)
@@ -23,11 +23,15 @@ class ClLayerNorm : public IClOperator
     /** Initialise the kernel's inputs and output
      *
      * @param[in]  input      Input tensor. Data type supported: f32.
+     * @param[in]  gamma      (Optional) Per-channel scale, shape (input.dim0). Data type supported: Same as @p input.
+     * @param[in]  beta       (Optional) Per-channel offset, shape (input.dim0). Data type supported: Same as @p input.
      * @param[out] output     Output tensor. Data type supported: F32.
      * @param[in]  info       (Optional)LayerNorm layer operation information
      */
     void configure(const CLCompileContext   &compile_context,
                    const ITensorInfo        *input,
+                   const ITensorInfo        *gamma,
+                   const ITensorInfo        *beta,
                    ITensorInfo              *output,
                    const LayerNormLayerInfo &info = LayerNormLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref ClLayerNormKernel
@@ -37,7 +41,9 @@ class ClLayerNorm : public IClOperator
      * @return a status
      */
     static Status validate(const ITensorInfo        *input,
-                           ITensorInfo              *output,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *output,
                            const LayerNormLayerInfo &info = LayerNormLayerInfo());
 
     // Inherited methods overridden:
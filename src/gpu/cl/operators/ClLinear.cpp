@@ -24,9 +24,12 @@ void ClLinear::configure(const ClCompileContext &compile_context,
                          const LinearLayerInfo  &linear_info)
 {
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, linear_info);
-    ARM_COMPUTE_UNUSED(a, b, c, d, alpha);
-    ARM_COMPUTE_UNUSED(linear_info);
-    ARM_COMPUTE_UNUSED(beta);
+    ARM_COMPUTE_ERROR_THROW_ON(ClLinear::validate(a, b, c, d, alpha, beta, linear_info));
+    if(linear_info.activation_info().enabled())
+    {
+        // Validation is compiled out without asserts, the activation must not be dropped silently
+        ARM_COMPUTE_ERROR("Fused activations are not supported by the OpenCL linear layer");
+    }
 
     // Specify whether transpose weights is necessary in matmul info
     const MatMulInfo mat_info = MatMulInfo().adj_rhs(true);
@@ -56,7 +59,9 @@ ClLinear::validate(const ITensorInfo *a,
     ARM_COMPUTE_UNUSED(d);
     ARM_COMPUTE_UNUSED(alpha);
     ARM_COMPUTE_UNUSED(beta);
-    ARM_COMPUTE_UNUSED(linear_info);
+    // Only the CPU linear layer applies an activation in its output stage
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(linear_info.activation_info().enabled(),
+                                    "Fused activations are not supported by the OpenCL linear layer");
     return Status{};
 }
 
@@ -28,7 +28,7 @@ public:
      * @param[out] d      Output tensor. Data type supported: F32.
      * @param[in]  alpha  Weight of the matrix product
      * @param[in]  beta   Weight of matrix C
-     * @param[in]  info   (Optional)Linear layer operation information
+     * @param[in]  info   (Optional)Linear layer operation information, its activation must be disabled
      */
     void configure(const ClCompileContext &compile_context,
                    ITensorInfo *a,
@@ -951,7 +951,17 @@ NodeID GraphBuilder::add_embedding_node(Graph              &g,
     check_nodeidx_pair(input, g);
 
     // Get input tensor descriptor
-    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+    TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+
+    // Tables hold the model data type, the ids stay 32-bit integers
+    if(emb_info.data_type() != DataType::UNKNOWN)
+    {
+        input_tensor_desc.data_type = emb_info.data_type();
+    }
+    else if(!is_data_type_float(input_tensor_desc.data_type))
+    {
+        input_tensor_desc.data_type = DataType::F32;
+    }
 
     // Vocabulary const node output tensor descriptor
     TensorDescriptor v_desc = input_tensor_desc;
@@ -1042,9 +1052,11 @@ NodeID GraphBuilder::add_embedding_node(Graph              &g,
 NodeID GraphBuilder::add_linear_node(Graph &g, NodeParams params, NodeIdxPair input,
                                      LinearLayerInfo     ff_info,
                                      ITensorAccessorUPtr ff_weights,
-                                     ITensorAccessorUPtr ff_bias)
+                                     ITensorAccessorUPtr ff_bias,
+                                     FastMathHint        fast_math_hint)
 {
     check_nodeidx_pair(input, g);
+    ff_info.set_fast_math(fast_math_hint == FastMathHint::Enabled);
 
     // Get input tensor descriptor
     const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
@@ -1099,6 +1111,49 @@ NodeID GraphBuilder::add_linear_node(Graph &g, NodeParams params, NodeIdxPair in
     return f_nid;
 }
 
+NodeID GraphBuilder::add_topk_projection_node(Graph &g, NodeParams params, NodeIdxPair input,
+                                              TopKProjectionLayerInfo info,
+                                              ITensorAccessorUPtr     weights,
+                                              ITensorAccessorUPtr     bias)
+{
+    check_nodeidx_pair(input, g);
+
+    // Get input tensor descriptor
+    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+
+    // Create weight and bias tensor shape
+    TensorDescriptor w_desc = input_tensor_desc;
+    w_desc.shape            = info.w_shape();
+    TensorDescriptor b_desc = input_tensor_desc;
+    b_desc.shape            = info.b_shape();
+
+    NodeID w_nid, b_nid, p_nid;
+    if(params.target != Target::UNSPECIFIED)
+    {
+        w_nid = add_const_node_with_name(g, params, params.target, "Projection Weights", w_desc, std::move(weights));
+        b_nid = add_const_node_with_name(g, params, params.target, "Projection Bias", b_desc, std::move(bias));
+        p_nid = g.add_node<TopKProjectionLayerNode>(params.target, info);
+
+        g.add_connection(params.target, input.node_id, input.index, p_nid, 0);
+        g.add_connection(params.target, w_nid, 0, p_nid, 1);
+        g.add_connection(params.target, b_nid, 0, p_nid, 2);
+    }
+    else
+    {
+        w_nid = add_const_node_with_name(g, params, "Projection Weights", w_desc, std::move(weights));
+        b_nid = add_const_node_with_name(g, params, "Projection Bias", b_desc, std::move(bias));
+        p_nid = g.add_node<TopKProjectionLayerNode>(info);
+
+        g.add_connection(input.node_id, input.index, p_nid, 0);
+        g.add_connection(w_nid, 0, p_nid, 1);
+        g.add_connection(b_nid, 0, p_nid, 2);
+    }
+
+    set_node_params(g, p_nid, params);
+
+    return p_nid;
+}
+
 NodeID GraphBuilder::add_attention_linear_layer(Graph &g, NodeParams params, NodeIdxPair input,
                                                 LinearLayerInfo     linear_info,
                                                 ITensorAccessorUPtr query_weights,
@@ -1106,9 +1161,11 @@ NodeID GraphBuilder::add_attention_linear_layer(Graph &g, NodeParams params, Nod
                                                 ITensorAccessorUPtr key_weights,
                                                 ITensorAccessorUPtr key_bias,
                                                 ITensorAccessorUPtr value_weights,
-                                                ITensorAccessorUPtr value_bias)
+                                                ITensorAccessorUPtr value_bias,
+                                                FastMathHint        fast_math_hint)
 {
     check_nodeidx_pair(input, g);
+    linear_info.set_fast_math(fast_math_hint == FastMathHint::Enabled);
 
     // Get input tensor descriptor
     const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
@@ -1225,19 +1282,68 @@ NodeID GraphBuilder::add_scale_dot_production_node(Graph &g, NodeParams params,
     return sdp_nid;
 }
 
-NodeID GraphBuilder::add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info)
+NodeID GraphBuilder::add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info,
+                                         ITensorAccessorUPtr gamma_accessor,
+                                         ITensorAccessorUPtr beta_accessor)
 {
     check_nodeidx_pair(input, g);
 
+    bool has_gamma = (gamma_accessor != nullptr);
+    bool has_beta  = (beta_accessor != nullptr);
+
+    // Get input tensor descriptor
+    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+
+    // Gamma and beta hold one value per channel of the normalized axis
+    TensorDescriptor common_desc = input_tensor_desc;
+    common_desc.shape            = TensorShape(input_tensor_desc.shape[info.axis()]);
+
+    NodeID gamma_nid = EmptyNodeID;
+    NodeID beta_nid  = EmptyNodeID;
+
     NodeID l_nid;
     if(params.target != Target::UNSPECIFIED)
     {  
+        if(has_gamma)
+        {
+            gamma_nid = add_const_node_with_name(g, params, params.target, "Gamma", common_desc, std::move(gamma_accessor));
+        }
+        if(has_beta)
+        {
+            beta_nid = add_const_node_with_name(g, params, params.target, "Beta", common_desc, std::move(beta_accessor));
+        }
+
         l_nid = g.add_node<LayerNormNode>(params.target, info);
-        g.add_connection(params.target, input.node_id, 0, l_nid, 0);
+        g.add_connection(params.target, input.node_id, input.index, l_nid, 0);
+        if(has_gamma)
+        {
+            g.add_connection(params.target, gamma_nid, 0, l_nid, 1);
+        }
+        if(has_beta)
+        {
+            g.add_connection(params.target, beta_nid, 0, l_nid, 2);
+        }
     }else
     {
+        if(has_gamma)
+        {
+            gamma_nid = add_const_node_with_name(g, params, "Gamma", common_desc, std::move(gamma_accessor));
+        }
+        if(has_beta)
+        {
+            beta_nid = add_const_node_with_name(g, params, "Beta", common_desc, std::move(beta_accessor));
+        }
+
         l_nid = g.add_node<LayerNormNode>(info);
-        g.add_connection(input.node_id, 0, l_nid, 0);
+        g.add_connection(input.node_id, input.index, l_nid, 0);
+        if(has_gamma)
+        {
+            g.add_connection(gamma_nid, 0, l_nid, 1);
+        }
+        if(has_beta)
+        {
+            g.add_connection(beta_nid, 0, l_nid, 2);
+        }
     }
 
     set_node_params(g, l_nid, params);
@@ -101,8 +101,19 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply backend mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::Backend);
 
+    // Alias the const tensors loaded by a graph of the same topology
+    if(ctx.config().shared_consts != nullptr)
+    {
+        detail::share_const_tensors(graph, *ctx.config().shared_consts);
+    }
+
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
+    if(is_switching(forced_target) && ctx.config().overlap_devices)
+    {
+        // Tasks and transition buffer lifetimes follow this order
+        topological_sorted_nodes = device_overlap_sort(graph, topological_sorted_nodes);
+    }
 
     // Validate all nodes
     detail::validate_all_nodes(graph);
@@ -137,6 +148,11 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Finalize Graph context
     ctx.finalize();
 
+    if(ctx.config().enable_profiling)
+    {
+        workload.profiler.enable();
+    }
+
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
@@ -150,49 +166,43 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    Profiler &profiler = it->second.profiler;
+
     while(true)
     {
         std::cout << "switching/src/graph/GraphManager.cpp call_all_input_node_accessors start:" << std::endl;
 
-#ifdef MEASURE_TIME
-        auto input_start_time = std::chrono::high_resolution_clock::now();
-#endif
+        profiler.begin_run();
+        const int64_t input_start = profiler.is_enabled() ? Profiler::now() : 0;
+
         // Call input accessors
         if(!detail::call_all_input_node_accessors(it->second))
         {
             return;
         }
-#ifdef MEASURE_TIME
-        auto   input_end_time  = std::chrono::high_resolution_clock::now();
-        double input_cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(input_end_time - input_start_time).count();
-
-        std::ofstream measure_out("measure_output.txt", std::ios::app);
-        measure_out.precision(5);
-        measure_out << std::scientific << "Input cost: " << input_cost_time << std::endl;
-
-#endif
+        if(profiler.is_enabled())
+        {
+            profiler.record(Profiler::InputSlot, input_start, Profiler::now());
+        }
         std::cout << "switching/src/graph/GraphManager.cpp call_all_input_node_accessors end:" << std::endl;
 
         std::cout << "switching/src/graph/GraphManager.cpp call_all_tasks start:" << std::endl;
 
-#ifdef MEASURE_TIME
-        auto all_task_start_time = std::chrono::high_resolution_clock::now();
-#endif
         // Run graph
         detail::call_all_tasks(it->second);
-#ifdef MEASURE_TIME
-        auto   all_task_end_time  = std::chrono::high_resolution_clock::now();
-        double all_task_cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(all_task_end_time - all_task_start_time).count();
-
-        measure_out.precision(5);
-        measure_out << std::scientific << "All_task cost: " << all_task_cost_time << std::endl;
-#endif
         std::cout << "switching/src/graph/GraphManager.cpp call_all_tasks end:" << std::endl;
 
         std::cout << "switching/src/graph/GraphManager.cpp call_all_output_node_accessors start:" << std::endl;
 
+        const int64_t output_start = profiler.is_enabled() ? Profiler::now() : 0;
+
         // Call output accessors
-        if(!detail::call_all_output_node_accessors(it->second))
+        const bool more_data = detail::call_all_output_node_accessors(it->second);
+        if(profiler.is_enabled())
+        {
+            profiler.record(Profiler::OutputSlot, output_start, Profiler::now());
+        }
+        if(!more_data)
         {
             return;
         }
@@ -200,6 +210,14 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+Profiler &GraphManager::profiler(Graph &graph)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    return it->second.profiler;
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
@@ -0,0 +1,70 @@
+#include "arm_compute/graph/KVCache.h"
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+void clear_history(arm_compute::Tensor &cache)
+{
+    ValidRegion valid_region = cache.info()->valid_region();
+    valid_region.shape.set(1, 0, false);
+    cache.info()->set_valid_region(valid_region);
+}
+} // namespace
+
+KVCache::KVCache(unsigned int d_model, unsigned int max_len, DataType data_type)
+    : _info(TensorShape(d_model, max_len), 1, data_type), _layers()
+{
+    ARM_COMPUTE_ERROR_ON(d_model == 0 || max_len == 0);
+}
+
+unsigned int KVCache::length() const
+{
+    return _layers.empty() ? 0 : static_cast<unsigned int>(_layers.front()->key.info()->valid_region().shape.y());
+}
+
+unsigned int KVCache::max_length() const
+{
+    return static_cast<unsigned int>(_info.dimension(1));
+}
+
+void KVCache::reset()
+{
+    for(auto &l : _layers)
+    {
+        clear_history(l->key);
+        clear_history(l->value);
+    }
+}
+
+ITensor *KVCache::key(unsigned int layer)
+{
+    return &this->layer(layer).key;
+}
+
+ITensor *KVCache::value(unsigned int layer)
+{
+    return &this->layer(layer).value;
+}
+
+KVCache::Layer &KVCache::layer(unsigned int index)
+{
+    while(_layers.size() <= index)
+    {
+        auto l = std::make_unique<Layer>();
+        for(arm_compute::Tensor *cache : { &l->key, &l->value })
+        {
+            cache->allocator()->init(_info);
+            cache->allocator()->allocate();
+            clear_history(*cache);
+        }
+        _layers.push_back(std::move(l));
+    }
+    return *_layers[index];
+}
+} // namespace graph
+} // namespace arm_compute
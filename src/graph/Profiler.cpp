@@ -0,0 +1,185 @@
+#include "arm_compute/graph/Profiler.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/TypePrinter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+double percentile(std::vector<int64_t> &durations, double p)
+{
+    const size_t idx = std::min(durations.size() - 1, static_cast<size_t>(p * (durations.size() - 1) + 0.5));
+    std::nth_element(durations.begin(), durations.begin() + idx, durations.end());
+    return durations[idx] / 1000.0;
+}
+
+std::string escape_json(const std::string &str)
+{
+    std::string out;
+    out.reserve(str.size());
+    for(char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+    return out;
+}
+} // namespace
+
+Profiler::Profiler() : _enabled(false), _run(0), _next(0), _count(0), _buffer(), _slots()
+{
+    _slots.push_back({ "input_accessors", Target::UNSPECIFIED });
+    _slots.push_back({ "all_tasks", Target::UNSPECIFIED });
+    _slots.push_back({ "output_accessors", Target::UNSPECIFIED });
+}
+
+void Profiler::enable(size_t capacity)
+{
+    ARM_COMPUTE_ERROR_ON(capacity == 0);
+    if(_buffer.size() != capacity)
+    {
+        _buffer.assign(capacity, Record{});
+        _next  = 0;
+        _count = 0;
+    }
+    _enabled = true;
+}
+
+void Profiler::disable()
+{
+    _enabled = false;
+}
+
+uint32_t Profiler::add_slot(std::string name, Target target)
+{
+    _slots.push_back({ std::move(name), target });
+    return static_cast<uint32_t>(_slots.size() - 1);
+}
+
+void Profiler::begin_run()
+{
+    if(_enabled)
+    {
+        ++_run;
+    }
+}
+
+void Profiler::record(uint32_t slot, int64_t start_ns, int64_t end_ns)
+{
+    if(!_enabled)
+    {
+        return;
+    }
+    _buffer[_next] = { slot, _run, start_ns, end_ns };
+    _next          = (_next + 1) % _buffer.size();
+    _count         = std::min(_count + 1, _buffer.size());
+}
+
+void Profiler::clear()
+{
+    _next  = 0;
+    _count = 0;
+    _run   = 0;
+}
+
+int64_t Profiler::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::vector<Profiler::Record> Profiler::records() const
+{
+    std::vector<Record> out;
+    out.reserve(_count);
+    const size_t first = (_next + _buffer.size() - _count) % std::max<size_t>(_buffer.size(), 1);
+    for(size_t i = 0; i < _count; ++i)
+    {
+        out.push_back(_buffer[(first + i) % _buffer.size()]);
+    }
+    return out;
+}
+
+void Profiler::export_chrome_trace(const std::string &filename) const
+{
+    std::ofstream out(filename);
+    ARM_COMPUTE_ERROR_ON_MSG(!out.good(), "Cannot open the trace file!");
+
+    const auto spans  = records();
+    const auto origin = spans.empty() ? 0 : spans.front().start_ns;
+
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    for(size_t i = 0; i < spans.size(); ++i)
+    {
+        const auto &r    = spans[i];
+        const auto &slot = _slots[r.slot];
+        out << (i == 0 ? "" : ",") << "\n{\"name\":\"" << escape_json(slot.name) << "\",\"cat\":\"" << slot.target
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << static_cast<int>(slot.target) << ",\"ts\":" << (r.start_ns - origin) / 1000.0
+            << ",\"dur\":" << (r.end_ns - r.start_ns) / 1000.0 << ",\"args\":{\"run\":" << r.run << "}}";
+    }
+    out << "\n]}\n";
+}
+
+void Profiler::export_csv(const std::string &filename) const
+{
+    std::ofstream out(filename);
+    ARM_COMPUTE_ERROR_ON_MSG(!out.good(), "Cannot open the csv file!");
+
+    const auto spans  = records();
+    const auto origin = spans.empty() ? 0 : spans.front().start_ns;
+
+    out << std::fixed << std::setprecision(3) << "run,name,target,start_us,duration_us\n";
+    for(const auto &r : spans)
+    {
+        const auto &slot = _slots[r.slot];
+        out << r.run << "," << slot.name << "," << slot.target << "," << (r.start_ns - origin) / 1000.0 << ","
+            << (r.end_ns - r.start_ns) / 1000.0 << "\n";
+    }
+}
+
+void Profiler::print_summary(std::ostream &os) const
+{
+    std::vector<std::vector<int64_t>> durations(_slots.size());
+    for(const auto &r : records())
+    {
+        durations[r.slot].push_back(r.end_ns - r.start_ns);
+    }
+
+    std::ios format(nullptr);
+    format.copyfmt(os);
+    os << std::fixed << std::setprecision(3) << std::left << std::setw(40) << "name" << std::setw(8) << "target"
+       << std::setw(8) << "count" << std::setw(14) << "mean_us" << std::setw(14) << "p50_us"
+       << "p99_us" << std::endl;
+    for(size_t i = 0; i < _slots.size(); ++i)
+    {
+        auto &d = durations[i];
+        if(d.empty())
+        {
+            continue;
+        }
+        double sum = 0.0;
+        for(auto v : d)
+        {
+            sum += v;
+        }
+        std::stringstream target;
+        target << _slots[i].target;
+        os << std::setw(40) << _slots[i].name << std::setw(8) << target.str() << std::setw(8) << d.size()
+           << std::setw(14) << sum / d.size() / 1000.0 << std::setw(14) << percentile(d, 0.5) << percentile(d, 0.99)
+           << std::endl;
+    }
+    os.copyfmt(format);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,47 @@
+#include "arm_compute/graph/SequenceBatch.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+SequenceBatch::SequenceBatch(unsigned int batch_size, unsigned int max_len) : _lengths(), _max_len(max_len)
+{
+    ARM_COMPUTE_ERROR_ON(batch_size == 0 || max_len == 0);
+    _lengths.allocator()->init(TensorInfo(TensorShape(batch_size), 1, DataType::U32));
+    _lengths.allocator()->allocate();
+
+    // Until lengths are set every sequence is full
+    set_lengths(std::vector<unsigned int>(batch_size, max_len));
+}
+
+unsigned int SequenceBatch::batch_size() const
+{
+    return static_cast<unsigned int>(_lengths.info()->dimension(0));
+}
+
+unsigned int SequenceBatch::max_length() const
+{
+    return _max_len;
+}
+
+void SequenceBatch::set_lengths(const std::vector<unsigned int> &lengths)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(lengths.size() > batch_size(), "More sequences than the batch holds");
+    auto *dst = reinterpret_cast<uint32_t *>(_lengths.buffer() + _lengths.info()->offset_first_element_in_bytes());
+    for(unsigned int b = 0; b < batch_size(); ++b)
+    {
+        dst[b] = (b < lengths.size()) ? std::min(lengths[b], _max_len) : 0U;
+    }
+}
+
+ITensor *SequenceBatch::lengths()
+{
+    return &_lengths;
+}
+} // namespace graph
+} // namespace arm_compute
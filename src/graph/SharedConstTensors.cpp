@@ -0,0 +1,48 @@
+#include "arm_compute/graph/SharedConstTensors.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+size_t SharedConstTensors::size() const
+{
+    return _entries.size();
+}
+
+void SharedConstTensors::add(ITensorHandle *handle, const TensorDescriptor &desc)
+{
+    _entries.push_back({ handle, desc });
+}
+
+ITensorHandle *SharedConstTensors::find(size_t index, const TensorDescriptor &desc) const
+{
+    if(index >= _entries.size())
+    {
+        return nullptr;
+    }
+    const Entry &e = _entries[index];
+    const bool matches = e.desc.shape == desc.shape && e.desc.data_type == desc.data_type && e.desc.target == desc.target;
+    return matches ? e.handle : nullptr;
+}
+
+bool SharedConstTensors::contains(const ITensorHandle *handle) const
+{
+    return handle != nullptr && std::any_of(_entries.begin(), _entries.end(), [&](const Entry &e)
+    {
+        return e.handle == handle;
+    });
+}
+
+std::shared_ptr<IWeightsManager> SharedConstTensors::weights_manager() const
+{
+    return _weights_manager;
+}
+
+void SharedConstTensors::set_weights_manager(std::shared_ptr<IWeightsManager> wm)
+{
+    _weights_manager = std::move(wm);
+}
+} // namespace graph
+} // namespace arm_compute
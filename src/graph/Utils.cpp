@@ -100,7 +100,6 @@ void check_target_on_graph(Graph &g, Target target)
 
 PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
 {
-    ARM_COMPUTE_UNUSED(target);
     PassManager pm;
 
     // Passes that mutate graph IR
@@ -122,6 +121,10 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
         }
     }
     pm.append(std::make_unique<NodeFusionMutator>());
+    if (is_switching(target) && !cfg.placement_cost_file.empty())
+    {
+        pm.append(std::make_unique<DevicePlacementMutator>(load_device_cost_table(cfg.placement_cost_file)));
+    }
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
@@ -27,7 +27,9 @@
 
 #include "support/Iterable.h"
 
+#include <algorithm>
 #include <list>
+#include <set>
 #include <stack>
 
 namespace arm_compute
@@ -67,6 +69,33 @@ inline bool all_inputs_are_visited(const INode *node, const std::vector<bool> &v
 
     return are_all_visited;
 }
+
+/** Checks if a node runs on the host and maps CL tensors before running
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node reads or writes a CL tensor from the host
+ */
+inline bool host_maps_device_tensors(const INode *node)
+{
+    for (size_t i = 0; i < node->num_inputs(); ++i)
+    {
+        const Tensor *tensor = node->input(i);
+        if (tensor != nullptr && tensor->desc().target == Target::CL)
+        {
+            return true;
+        }
+    }
+    for (size_t i = 0; i < node->num_outputs(); ++i)
+    {
+        const Tensor *tensor = node->output(i);
+        if (tensor != nullptr && tensor->desc().target == Target::CL)
+        {
+            return true;
+        }
+    }
+    return false;
+}
 } // namespace detail
 
 std::vector<NodeID> bfs(Graph &g)
@@ -186,5 +215,118 @@ std::vector<NodeID> dfs(Graph &g)
 
     return dfs_order_vector;
 }
+
+std::vector<NodeID> device_overlap_sort(Graph &g, const std::vector<NodeID> &order)
+{
+    // Nodes without a task, device nodes that only enqueue work, and host nodes
+    enum Lane
+    {
+        Free,
+        Device,
+        Host,
+        NumLanes
+    };
+    using ReadySet = std::set<std::pair<size_t, NodeID>>;
+
+    const size_t        num_nodes = g.nodes().size();
+    std::vector<size_t> rank(num_nodes, order.size());
+    std::vector<size_t> missing_inputs(num_nodes, 0);
+    std::vector<Lane>   lane(num_nodes, Free);
+    std::vector<bool>   maps_device(num_nodes, false);
+    ReadySet            ready[NumLanes];
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        rank[order[i]] = i;
+    }
+
+    for (auto n : order)
+    {
+        INode *node = g.node(n);
+        ARM_COMPUTE_ERROR_ON(node == nullptr);
+
+        const NodeType type = node->type();
+        if (type == NodeType::Input || type == NodeType::Output || type == NodeType::Const)
+        {
+            lane[n] = Free;
+        }
+        else if (node->assigned_target() == Target::NEON && type != NodeType::PrintLayer)
+        {
+            lane[n]        = Host;
+            maps_device[n] = detail::host_maps_device_tensors(node);
+        }
+        else
+        {
+            lane[n] = Device;
+        }
+
+        for (const auto &eid : node->input_edges())
+        {
+            const Edge *e = (eid != EmptyEdgeID) ? g.edge(eid) : nullptr;
+            if (e != nullptr && rank[e->producer_id()] < order.size())
+            {
+                ++missing_inputs[n];
+            }
+        }
+        if (missing_inputs[n] == 0)
+        {
+            ready[lane[n]].emplace(rank[n], n);
+        }
+    }
+
+    std::vector<NodeID> sorted;
+    sorted.reserve(order.size());
+
+    // Whether device work was enqueued since the last host node that waited for the queue
+    bool device_in_flight = false;
+    while (sorted.size() < order.size())
+    {
+        ReadySet::iterator next;
+        if (!ready[Free].empty())
+        {
+            next = ready[Free].begin();
+            sorted.push_back(next->second);
+            ready[Free].erase(next);
+        }
+        else if (!ready[Device].empty())
+        {
+            next = ready[Device].begin();
+            sorted.push_back(next->second);
+            ready[Device].erase(next);
+            device_in_flight = true;
+        }
+        else
+        {
+            if (ready[Host].empty())
+            {
+                ARM_COMPUTE_ERROR("Traversal does not cover the inputs of all its nodes!");
+            }
+            next = std::find_if(ready[Host].begin(), ready[Host].end(), [&](const std::pair<size_t, NodeID> &r)
+                                { return !device_in_flight || !maps_device[r.second]; });
+            if (next == ready[Host].end())
+            {
+                next = ready[Host].begin();
+            }
+            device_in_flight = device_in_flight && !maps_device[next->second];
+            sorted.push_back(next->second);
+            ready[Host].erase(next);
+        }
+
+        // Release the consumers whose inputs are all issued
+        const INode *node = g.node(sorted.back());
+        for (const auto &eid : node->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            ARM_COMPUTE_ERROR_ON(e == nullptr);
+            const NodeID c = e->consumer_id();
+            if (rank[c] < order.size() && --missing_inputs[c] == 0)
+            {
+                ready[lane[c]].emplace(rank[c], c);
+            }
+        }
+    }
+
+    return sorted;
+}
 } // namespace graph
 } // namespace arm_compute
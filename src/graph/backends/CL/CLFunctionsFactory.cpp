@@ -360,16 +360,16 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
                 *polymorphic_downcast<EmbeddingSumLayerNode *>(node));
         case NodeType::LinearLayer:
             return detail::create_linear_layer<CLLinearLayer, CLTargetInfo>(
-                *polymorphic_downcast<LinearLayerNode *>(node));
+                *polymorphic_downcast<LinearLayerNode *>(node), ctx);
         case NodeType::LayerNormLayer:
             return detail::create_layer_norm_layer<CLLayerNormLayer, CLTargetInfo>(
                 *polymorphic_downcast<LayerNormNode *>(node));
         case NodeType::AttentionLinearLayer:
             return detail::create_attention_linear_layer<CLAttentionLinearLayer,CLTargetInfo>(
-                *polymorphic_downcast<AttentionLinearNode *>(node));
+                *polymorphic_downcast<AttentionLinearNode *>(node), ctx);
         case NodeType::ScaleDotProductionAttentionLayer:
             return detail::create_scale_dot_production_layer<CLScaleDotProductionAttentionLayer,CLTargetInfo>(
-                *polymorphic_downcast<ScaleDotProductionAttentionNode *>(node));
+                *polymorphic_downcast<ScaleDotProductionAttentionNode *>(node), ctx);
         default:
             return nullptr;
     }
@@ -33,6 +33,7 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SharedConstTensors.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
@@ -40,6 +41,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PackedWeightsCache.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
@@ -93,7 +95,21 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
     {
         WeightsManagerContext wm_ctx;
         wm_ctx.target = Target::NEON;
-        wm_ctx.wm     = create_weights_manager();
+        // Graphs sharing their const tensors also share the reshaped weights
+        const std::shared_ptr<SharedConstTensors> &shared = ctx.config().shared_consts;
+        wm_ctx.wm = (shared != nullptr) ? shared->weights_manager() : nullptr;
+        if (wm_ctx.wm == nullptr)
+        {
+            wm_ctx.wm = create_weights_manager();
+            if (!ctx.config().packed_weights_dir.empty())
+            {
+                wm_ctx.wm->set_packed_weights_cache(std::make_shared<PackedWeightsCache>(ctx.config().packed_weights_dir));
+            }
+            if (shared != nullptr)
+            {
+                shared->set_weights_manager(wm_ctx.wm);
+            }
+        }
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
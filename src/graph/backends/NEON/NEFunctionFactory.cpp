@@ -114,6 +114,44 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return func;
 }
+
+template <>
+std::unique_ptr<IFunction>
+create_scale_dot_production_layer<NEScaleDotProductionAttentionLayer, NETargetInfo>(ScaleDotProductionAttentionNode &node,
+                                                                                    GraphContext                    &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *query  = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *key    = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *value  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(query == nullptr || key == nullptr || value == nullptr || output == nullptr);
+
+    // Decoding appends to the history of this layer instead of attending over the current tokens only
+    const unsigned int layer       = attention_layer_index(node);
+    KVCache           *kv_cache    = ctx.config().kv_cache.get();
+    ITensor           *key_cache   = (kv_cache != nullptr) ? kv_cache->key(layer) : nullptr;
+    ITensor           *value_cache = (kv_cache != nullptr) ? kv_cache->value(layer) : nullptr;
+
+    // A batch of padded sequences is masked per sequence
+    SequenceBatch *sequence_batch = ctx.config().sequence_batch.get();
+    ITensor       *lengths        = (sequence_batch != nullptr) ? sequence_batch->lengths() : nullptr;
+
+    // Create and configure function
+    auto func = std::make_unique<NEScaleDotProductionAttentionLayer>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(query, key, value, output, node.sdpa_info(), layer, key_cache, value_cache, lengths);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << query->info()->data_type() << " Query shape: "
+                               << query->info()->tensor_shape() << " Output shape: " << output->info()->tensor_shape()
+                               << " KV cache: " << (kv_cache != nullptr) << " Batched: " << (sequence_batch != nullptr) << std::endl);
+
+    return func;
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -243,16 +281,25 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
                 *polymorphic_downcast<EmbeddingSumLayerNode *>(node));
         case NodeType::LinearLayer:
             return detail::create_linear_layer<NELinearLayer, NETargetInfo>(
-                *polymorphic_downcast<LinearLayerNode *>(node));
+                *polymorphic_downcast<LinearLayerNode *>(node), ctx);
         case NodeType::AttentionLinearLayer:
             return detail::create_attention_linear_layer<NEAttentionLinearLayer,NETargetInfo>(
-                *polymorphic_downcast<AttentionLinearNode *>(node));
+                *polymorphic_downcast<AttentionLinearNode *>(node), ctx);
         case NodeType::ScaleDotProductionAttentionLayer:
             return detail::create_scale_dot_production_layer<NEScaleDotProductionAttentionLayer,NETargetInfo>(
-                *polymorphic_downcast<ScaleDotProductionAttentionNode *>(node));
+                *polymorphic_downcast<ScaleDotProductionAttentionNode *>(node), ctx);
         case NodeType::LayerNormLayer:
             return detail::create_layer_norm_layer<NELayerNormLayer, NETargetInfo>(
                 *polymorphic_downcast<LayerNormNode *>(node));
+        case NodeType::AddLayerNormLayer:
+            return detail::create_add_layer_norm_layer<NEAddLayerNormLayer, NETargetInfo>(
+                *polymorphic_downcast<AddLayerNormNode *>(node));
+        case NodeType::EmbeddingGatherSumLayer:
+            return detail::create_embedding_gather_sum_layer<NEEmbeddingGatherSumLayer, NETargetInfo>(
+                *polymorphic_downcast<EmbeddingGatherSumNode *>(node), ctx);
+        case NodeType::TopKProjectionLayer:
+            return detail::create_topk_projection_layer<NETopKProjectionLayer, NETargetInfo>(
+                *polymorphic_downcast<TopKProjectionLayerNode *>(node), ctx);
         default:
             return nullptr;
     }
@@ -26,15 +26,13 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/SharedConstTensors.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
-
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -42,6 +40,128 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Collects the CL backed parent handles a host task reads or writes */
+std::vector<ITensorHandle *> collect_host_mapped_handles(INode &node)
+{
+    std::vector<ITensorHandle *> handles;
+    if(node.assigned_target() != Target::NEON)
+    {
+        return handles;
+    }
+
+    auto add_handle = [&handles](Tensor *tensor)
+    {
+        if(tensor == nullptr || tensor->handle() == nullptr || tensor->handle()->target() != Target::CL)
+        {
+            return;
+        }
+        // Sub-tensors share their parent's mapping
+        ITensorHandle *parent = tensor->handle()->parent_handle();
+        if(std::find(handles.begin(), handles.end(), parent) == handles.end())
+        {
+            handles.push_back(parent);
+        }
+    };
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        add_handle(node.input(i));
+    }
+    for(size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        add_handle(node.output(i));
+    }
+    return handles;
+}
+
+void unmap_all_handles(ExecutionWorkload &workload)
+{
+    for(auto handle : workload.mapped_handles)
+    {
+        handle->unmap();
+    }
+    workload.mapped_handles.clear();
+}
+
+/** Moves the workload across a device boundary before running a task
+ *
+ * Device (and utility) tasks unmap every host mapped handle in one batch. Host tasks map the
+ * CL handles they touch that are not already mapped; only the last map blocks, as the queue is in order.
+ */
+void transition_handles(ExecutionWorkload &workload, ExecutionTask &task)
+{
+    if(task.task == nullptr || task.node->assigned_target() != Target::NEON)
+    {
+        unmap_all_handles(workload);
+        return;
+    }
+
+    std::vector<ITensorHandle *> to_map;
+    for(auto handle : task.host_mapped_handles)
+    {
+        const ITensor &tensor = handle->tensor();
+        if(tensor.info()->is_resizable() || !tensor.is_used())
+        {
+            continue;
+        }
+        if(std::find(workload.mapped_handles.begin(), workload.mapped_handles.end(), handle) == workload.mapped_handles.end())
+        {
+            to_map.push_back(handle);
+        }
+    }
+    for(size_t i = 0; i < to_map.size(); ++i)
+    {
+        to_map[i]->map(i + 1 == to_map.size());
+        workload.mapped_handles.push_back(to_map[i]);
+    }
+}
+/** Gives the outputs of a row-wise node the valid rows of its first input
+ *
+ * Inputs shorter than their tensor are padded, e.g. to a sequence length bucket. The rows past the valid region are
+ * still computed but attention ignores them as keys and consumers ignore them as outputs.
+ */
+void forward_valid_rows(INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::AddLayerNormLayer:
+        case NodeType::AttentionLinearLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::LayerNormLayer:
+        case NodeType::LinearLayer:
+        case NodeType::ScaleDotProductionAttentionLayer:
+            break;
+        default:
+            return;
+    }
+
+    Tensor *src = node.input(0);
+    if(src == nullptr || src->handle() == nullptr)
+    {
+        return;
+    }
+    const ITensorInfo *src_info = src->handle()->tensor().info();
+    const size_t       rows     = src_info->valid_region().shape.y();
+    for(size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *dst = node.output(i);
+        if(dst == nullptr || dst->handle() == nullptr)
+        {
+            continue;
+        }
+        ITensorInfo *dst_info = dst->handle()->tensor().info();
+        if(dst_info->dimension(1) == src_info->dimension(1) && dst_info->valid_region().shape.y() != rows)
+        {
+            ValidRegion valid_region = dst_info->valid_region();
+            valid_region.shape.set(1, rows, false);
+            dst_info->set_valid_region(valid_region);
+        }
+    }
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -144,6 +264,47 @@ void configure_all_tensors(Graph &g)
 
 }
 
+void share_const_tensors(Graph &g, SharedConstTensors &shared)
+{
+    size_t index = 0;
+    for(auto &nid : g.nodes(NodeType::Const))
+    {
+        INode *node = g.node(nid);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        for(size_t i = 0; i < node->num_outputs(); ++i, ++index)
+        {
+            Tensor *tensor = node->output(i);
+            if(tensor == nullptr || tensor->handle() == nullptr || tensor->bound_edges().empty())
+            {
+                // Keep the indices of graphs with the same topology aligned
+                if(index >= shared.size())
+                {
+                    shared.add(nullptr, TensorDescriptor());
+                }
+                continue;
+            }
+
+            if(index >= shared.size())
+            {
+                shared.add(tensor->handle(), tensor->desc());
+                continue;
+            }
+
+            // Alias the whole registered tensor, its data is already loaded
+            ITensorHandle *parent = shared.find(index, tensor->desc());
+            if(parent != nullptr)
+            {
+                backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(parent->target());
+                tensor->set_handle(backend.create_subtensor(parent, tensor->desc().shape, Coordinates(), false));
+                tensor->extract_accessor();
+            }
+        }
+    }
+}
+
 void allocate_all_input_tensors(INode &node)
 {
     for(unsigned int i = 0; i < node.num_inputs(); ++i)
@@ -227,6 +388,8 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
             {
                 std::cout << node->name() << std::endl;
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
+                workload.tasks.back().host_mapped_handles = collect_host_mapped_handles(*node);
+                workload.tasks.back().profile_slot        = workload.profiler.add_slot(node->name(), assigned_target);
             }
         }
     }
@@ -257,11 +420,12 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
-void release_unused_tensors(Graph &g)
+void release_unused_tensors(Graph &g, const SharedConstTensors *shared)
 {
     for(auto &tensor : g.tensors())
     {
-        if(tensor != nullptr && tensor->handle() != nullptr)
+        // Shared const tensors are still read by the graphs finalized later
+        if(tensor != nullptr && tensor->handle() != nullptr && (shared == nullptr || !shared->contains(tensor->handle())))
         {
             tensor->handle()->release_if_unused();
         }
@@ -316,8 +480,10 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
     for(auto &task : workload.tasks)
     {
+        transition_handles(workload, task);
         task.prepare();
-        release_unused_tensors(*workload.graph);
+        unmap_all_handles(workload);
+        release_unused_tensors(*workload.graph, workload.ctx->config().shared_consts.get());
     }
 }
 
@@ -334,21 +500,34 @@ void call_all_tasks(ExecutionWorkload &workload)
         }
     }
 
-    // Execute tasks
+    Profiler     &profiler    = workload.profiler;
+    const bool    profiling   = profiler.is_enabled();
+    const int64_t tasks_start = profiling ? Profiler::now() : 0;
+
+    // Execute tasks, CL tasks only enqueue work so the host blocks only when it maps a CL tensor.
+    // Profiling waits for every CL task and so serialises the devices.
     for(auto &task : workload.tasks)
     {
-#ifdef MEASURE_TIME
-        auto all_task_start_time = std::chrono::high_resolution_clock::now();
-#endif
+        const int64_t start = profiling ? Profiler::now() : 0;
+        transition_handles(workload, task);
+        forward_valid_rows(*task.node);
         task();
-#ifdef MEASURE_TIME
-        auto   all_task_end_time  = std::chrono::high_resolution_clock::now();
-        double all_task_cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(all_task_end_time - all_task_start_time).count();
-
-        std::ofstream measure_out("measure_output.txt", std::ios::app);
-        measure_out.precision(5);
-        measure_out << std::scientific << task.node->name() <<" cost: " << all_task_cost_time << std::endl;
-#endif
+        if(profiling)
+        {
+            // CL tasks only enqueue work, wait for the device so the span covers the execution
+            if(task.node->assigned_target() == Target::CL)
+            {
+                backends::BackendRegistry::get().get_backend(Target::CL).sync();
+            }
+            profiler.record(task.profile_slot, start, Profiler::now());
+        }
+    }
+
+    // Hand outputs back to their device before the transition buffers are released
+    unmap_all_handles(workload);
+    if(profiling)
+    {
+        profiler.record(Profiler::TasksSlot, tasks_start, Profiler::now());
     }
 
     // Release memory for the transition buffers
@@ -48,6 +48,11 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+Profiler &Stream::profiler()
+{
+    return _manager.profiler(_g);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
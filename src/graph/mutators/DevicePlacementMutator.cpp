@@ -0,0 +1,318 @@
+#include "arm_compute/graph/mutators/DevicePlacementMutator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/LinearLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr double pinned_cost = 1e30;
+constexpr double flow_eps    = 1e-15;
+
+/** Dinic max-flow on a dense node numbering, source and sink included */
+class MinCut
+{
+public:
+    explicit MinCut(size_t num_vertices) : _adj(num_vertices), _level(num_vertices), _next(num_vertices)
+    {
+    }
+
+    void add_edge(size_t from, size_t to, double cap, double reverse_cap = 0.0)
+    {
+        if(cap <= 0.0 && reverse_cap <= 0.0)
+        {
+            return;
+        }
+        _adj[from].push_back({ to, _adj[to].size(), cap });
+        _adj[to].push_back({ from, _adj[from].size() - 1, reverse_cap });
+    }
+
+    double solve(size_t s, size_t t)
+    {
+        double flow = 0.0;
+        while(bfs(s, t))
+        {
+            std::fill(_next.begin(), _next.end(), 0);
+            for(double f = dfs(s, t, std::numeric_limits<double>::max()); f > flow_eps; f = dfs(s, t, std::numeric_limits<double>::max()))
+            {
+                flow += f;
+            }
+        }
+        return flow;
+    }
+
+    /** Whether a vertex stays on the source side of the minimum cut, valid after solve() */
+    bool on_source_side(size_t v) const
+    {
+        return _level[v] >= 0;
+    }
+
+private:
+    struct Arc
+    {
+        size_t to;
+        size_t rev;
+        double cap;
+    };
+
+    bool bfs(size_t s, size_t t)
+    {
+        std::fill(_level.begin(), _level.end(), -1);
+        std::queue<size_t> q;
+        _level[s] = 0;
+        q.push(s);
+        while(!q.empty())
+        {
+            const size_t v = q.front();
+            q.pop();
+            for(const auto &a : _adj[v])
+            {
+                if(a.cap > flow_eps && _level[a.to] < 0)
+                {
+                    _level[a.to] = _level[v] + 1;
+                    q.push(a.to);
+                }
+            }
+        }
+        return _level[t] >= 0;
+    }
+
+    double dfs(size_t v, size_t t, double pushed)
+    {
+        if(v == t)
+        {
+            return pushed;
+        }
+        for(; _next[v] < _adj[v].size(); ++_next[v])
+        {
+            Arc &a = _adj[v][_next[v]];
+            if(a.cap > flow_eps && _level[a.to] == _level[v] + 1)
+            {
+                const double f = dfs(a.to, t, std::min(pushed, a.cap));
+                if(f > flow_eps)
+                {
+                    a.cap -= f;
+                    _adj[a.to][a.rev].cap += f;
+                    return f;
+                }
+            }
+        }
+        return 0.0;
+    }
+
+    std::vector<std::vector<Arc>> _adj;
+    std::vector<int>              _level;
+    std::vector<size_t>           _next;
+};
+
+double parse_cost(const std::string &field)
+{
+    if(field.empty() || field == "-")
+    {
+        return -1.0;
+    }
+    return std::stod(field);
+}
+
+bool follows_neighbours(const INode &node)
+{
+    return node.type() == NodeType::Const || node.type() == NodeType::Input || node.type() == NodeType::Output;
+}
+
+/** Whether only the NEON backend can run a node, placement runs after fusion and must not move those to CL */
+bool neon_only(const INode &node)
+{
+    switch(node.type())
+    {
+        // Fused nodes without a CL function
+        case NodeType::AddLayerNormLayer:
+        case NodeType::EmbeddingGatherSumLayer:
+        case NodeType::TopKProjectionLayer:
+            return true;
+        // Only the NEON linear layer applies a fused activation
+        case NodeType::LinearLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const LinearLayerNode *>(&node)->fused_activation().enabled();
+        default:
+            return false;
+    }
+}
+
+double tensor_bytes(const Tensor *tensor)
+{
+    if(tensor == nullptr)
+    {
+        return 0.0;
+    }
+    const TensorDescriptor &desc = tensor->desc();
+    return static_cast<double>(desc.shape.total_size() * data_size_from_type(desc.data_type));
+}
+} // namespace
+
+DeviceCostTable load_device_cost_table(const std::string &filename)
+{
+    std::ifstream file(filename);
+    ARM_COMPUTE_ERROR_ON_MSG(!file.good(), "Cannot open the device cost table!");
+
+    DeviceCostTable table;
+    std::string     line;
+    while(std::getline(file, line))
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::stringstream        ss(line);
+        std::vector<std::string> fields;
+        std::string              field;
+        while(std::getline(ss, field, ','))
+        {
+            fields.push_back(field);
+        }
+        ARM_COMPUTE_ERROR_ON_MSG(fields.size() != 3, "Device cost table lines need three comma separated fields!");
+
+        if(fields[0] == "transfer")
+        {
+            table.transfer_latency  = std::stod(fields[1]);
+            table.transfer_per_byte = std::stod(fields[2]);
+        }
+        else
+        {
+            table.nodes[fields[0]] = { parse_cost(fields[1]), parse_cost(fields[2]) };
+        }
+    }
+    return table;
+}
+
+DevicePlacementMutator::DevicePlacementMutator(DeviceCostTable costs) : _costs(std::move(costs))
+{
+}
+
+const char *DevicePlacementMutator::name()
+{
+    return "DevicePlacementMutator";
+}
+
+IGraphMutator::MutationType DevicePlacementMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void DevicePlacementMutator::mutate(Graph &g)
+{
+    auto &nodes = g.nodes();
+
+    // Vertex i + 2 stands for node i, the source side runs on NEON and the sink side on CL
+    const size_t source = 0;
+    const size_t sink   = 1;
+    MinCut       cut(nodes.size() + 2);
+
+    const bool cl_supported = is_target_supported(Target::CL);
+
+    for(auto &node : nodes)
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        const size_t v  = node->id() + 2;
+        const auto   it = _costs.nodes.find(node->name());
+
+        double neon_cost = 0.0;
+        double cl_cost   = 0.0;
+        if(it != _costs.nodes.end())
+        {
+            neon_cost = it->second.neon < 0.0 ? pinned_cost : it->second.neon;
+            cl_cost   = it->second.cl < 0.0 ? pinned_cost : it->second.cl;
+        }
+        else if(!follows_neighbours(*node))
+        {
+            // No measurements, keep the hand assigned target
+            neon_cost = node->assigned_target() == Target::CL ? pinned_cost : 0.0;
+            cl_cost   = node->assigned_target() == Target::NEON ? pinned_cost : 0.0;
+        }
+        if(!cl_supported || neon_only(*node))
+        {
+            cl_cost = pinned_cost;
+        }
+
+        // Cutting source->v places v on CL, cutting v->sink places v on NEON
+        cut.add_edge(source, v, cl_cost);
+        cut.add_edge(v, sink, neon_cost);
+    }
+
+    for(auto &edge : g.edges())
+    {
+        if(edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr)
+        {
+            continue;
+        }
+        const double transfer = _costs.transfer_latency + _costs.transfer_per_byte * tensor_bytes(edge->tensor());
+        cut.add_edge(edge->producer_id() + 2, edge->consumer_id() + 2, transfer, transfer);
+    }
+
+    const double latency = cut.solve(source, sink);
+    ARM_COMPUTE_UNUSED(latency);
+
+    size_t num_cl = 0;
+    for(auto &node : nodes)
+    {
+        if(node != nullptr)
+        {
+            const Target target = cut.on_source_side(node->id() + 2) ? Target::NEON : Target::CL;
+            node->set_assigned_target(target);
+            num_cl += (target == Target::CL) ? 1 : 0;
+        }
+    }
+
+    // CL functions only accept CL tensors while NEON functions host map them, so any tensor touched by CL lives on CL
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor != nullptr)
+        {
+            tensor->desc().target = Target::NEON;
+        }
+    }
+    for(auto &node : nodes)
+    {
+        if(node == nullptr || node->assigned_target() != Target::CL)
+        {
+            continue;
+        }
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            if(node->input(i) != nullptr)
+            {
+                node->input(i)->desc().target = Target::CL;
+            }
+        }
+        for(size_t i = 0; i < node->num_outputs(); ++i)
+        {
+            if(node->output(i) != nullptr)
+            {
+                node->output(i)->desc().target = Target::CL;
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Placed " << num_cl << " nodes on CL, estimated latency " << latency << "s"
+                                         << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
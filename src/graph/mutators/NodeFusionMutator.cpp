@@ -231,6 +231,159 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+void fuse_eltwise_add_with_layer_norm(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *add_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(output_edge->producer());
+    auto *ln_node  = arm_compute::utils::cast::polymorphic_downcast<LayerNormNode *>(output_edge->consumer());
+
+    ARM_COMPUTE_ERROR_ON(add_node->output(0) == nullptr || ln_node->output(0) == nullptr);
+
+    // Only a plain residual sum of two equally shaped float tensors can be folded into the normalization
+    const Edge *lhs_edge = add_node->input_edge(0);
+    const Edge *rhs_edge = add_node->input_edge(1);
+    if (add_node->eltwise_operation() != EltwiseOperation::Add || add_node->fused_activation().enabled() ||
+        lhs_edge == nullptr || rhs_edge == nullptr || lhs_edge->tensor() == nullptr || rhs_edge->tensor() == nullptr ||
+        lhs_edge->tensor()->desc().shape != rhs_edge->tensor()->desc().shape ||
+        !is_data_type_float(add_node->output(0)->desc().data_type) || ln_node->layer_norm_info().axis() != 0)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing Eltwise Add node with ID : " << output_edge->producer_id()
+                                                                       << " with LayerNorm node with ID : "
+                                                                       << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if the residual sum has an output accessor
+    if (add_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = ln_node->assigned_target();
+
+        // The fused node takes over the normalized output tensor, so its descriptor, backend handle and
+        // accessor stay exactly as configured for the consumers
+        const TensorID           ln_output_id  = ln_node->output_id(0);
+        std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*ln_node);
+
+        const NodeID fused_id = g.add_node<AddLayerNormNode>(assigned_target, ln_node->layer_norm_info());
+
+        // Add connections from the add/layer norm inputs to the fused node
+        g.add_connection(lhs_edge->producer_id(), lhs_edge->producer_idx(), fused_id, 0);
+        g.add_connection(rhs_edge->producer_id(), rhs_edge->producer_idx(), fused_id, 1);
+        if (ln_node->input_edge(1) != nullptr)
+        {
+            g.add_connection(ln_node->input_edge(1)->producer_id(), 0, fused_id, 2);
+        }
+        if (ln_node->input_edge(2) != nullptr)
+        {
+            g.add_connection(ln_node->input_edge(2)->producer_id(), 0, fused_id, 3);
+        }
+
+        auto fused_node = g.node(fused_id);
+        fused_node->set_common_node_parameters(NodeParams{add_node->name() + "+" + ln_node->name(), assigned_target});
+
+        // Remove the old nodes and hand their consumers over to the fused node
+        g.remove_node(ln_node->id());
+        g.remove_node(add_node->id());
+        fused_node->set_output_tensor(ln_output_id, 0);
+        for (auto &driving_node : driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of eltwise add with layer normalization due to the presence of an output accessor\n");
+    }
+}
+
+void fuse_embedding_gather_sum(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *position_node = arm_compute::utils::cast::polymorphic_downcast<PositionEmbeddingLayerNode *>(output_edge->producer());
+    auto *sum_node      = arm_compute::utils::cast::polymorphic_downcast<EmbeddingSumLayerNode *>(output_edge->consumer());
+
+    ARM_COMPUTE_ERROR_ON(position_node->output(0) == nullptr || sum_node->output(0) == nullptr);
+
+    // The sum must be fed by the token and segment lookups of the same embedding layer, each used only here
+    const Edge *token_edge   = sum_node->input_edge(0);
+    const Edge *segment_edge = sum_node->input_edge(1);
+    if (output_edge->consumer_idx() != 2 || token_edge == nullptr || segment_edge == nullptr)
+    {
+        return;
+    }
+    INode *token_node   = token_edge->producer();
+    INode *segment_node = segment_edge->producer();
+    if (token_node == nullptr || segment_node == nullptr ||
+        token_node->type() != NodeType::TokenEmbeddingLayer || segment_node->type() != NodeType::SegmentEmbeddingLayer ||
+        token_node->output_edges().size() != 1 || segment_node->output_edges().size() != 1 ||
+        token_node->assigned_target() != Target::NEON || segment_node->assigned_target() != Target::NEON)
+    {
+        return;
+    }
+
+    const Edge *tokens_edge         = token_node->input_edge(0);
+    const Edge *vocab_edge          = token_node->input_edge(1);
+    const Edge *segments_edge       = segment_node->input_edge(0);
+    const Edge *segment_table_edge  = segment_node->input_edge(1);
+    const Edge *position_table_edge = position_node->input_edge(1);
+    if (tokens_edge == nullptr || vocab_edge == nullptr || segments_edge == nullptr || segment_table_edge == nullptr ||
+        position_table_edge == nullptr)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing embedding nodes with ID : " << token_node->id() << ", " << segment_node->id()
+                                                                      << ", " << position_node->id()
+                                                                      << " into EmbeddingSum node with ID : "
+                                                                      << sum_node->id() << std::endl);
+
+    // Prevent fusion if any of the intermediate lookups has an output accessor
+    if (token_node->output(0)->accessor() == nullptr && segment_node->output(0)->accessor() == nullptr &&
+        position_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = sum_node->assigned_target();
+
+        // The fused node takes over the summed output tensor, so its descriptor, backend handle and
+        // accessor stay exactly as configured for the consumers
+        const TensorID           sum_output_id = sum_node->output_id(0);
+        std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*sum_node);
+
+        const NodeID fused_id = g.add_node<EmbeddingGatherSumNode>(assigned_target, sum_node->embedding_sum_info());
+
+        // Ids and embedding tables go straight to the fused node
+        g.add_connection(tokens_edge->producer_id(), tokens_edge->producer_idx(), fused_id, 0);
+        g.add_connection(segments_edge->producer_id(), segments_edge->producer_idx(), fused_id, 1);
+        g.add_connection(vocab_edge->producer_id(), vocab_edge->producer_idx(), fused_id, 2);
+        g.add_connection(segment_table_edge->producer_id(), segment_table_edge->producer_idx(), fused_id, 3);
+        g.add_connection(position_table_edge->producer_id(), position_table_edge->producer_idx(), fused_id, 4);
+
+        auto fused_node = g.node(fused_id);
+        fused_node->set_common_node_parameters(NodeParams{sum_node->name(), assigned_target});
+
+        // Remove the lookups and the sum, their intermediate tensors are never allocated
+        const NodeID token_id    = token_node->id();
+        const NodeID segment_id  = segment_node->id();
+        const NodeID position_id = position_node->id();
+        g.remove_node(sum_node->id());
+        g.remove_node(token_id);
+        g.remove_node(segment_id);
+        g.remove_node(position_id);
+        fused_node->set_output_tensor(sum_output_id, 0);
+        for (auto &driving_node : driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of embedding lookups due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph                      &g,
                                const Edge                 *output_edge,
@@ -385,10 +538,20 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::LINEAR,     Activation::LOGISTIC,     Activation::LU_BOUNDED_RELU,
         Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
         Activation::SQUARE,     Activation::TANH};
+    // Activations the linear layer applies with the bias in its output stage
+    const std::set<Activation> supported_linear_activations = {Activation::BOUNDED_RELU, Activation::GELU,
+                                                               Activation::IDENTITY, Activation::LU_BOUNDED_RELU,
+                                                               Activation::RELU};
 
     // Preconditions
     auto empty_prec     = [](INode &) { return true; };
     auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
+    auto neon_fused_prec = [&g](INode &n)
+    {
+        // Producer and consumer must both run on the CPU backend
+        const auto output_edge = g.edge(*n.output_edges().begin());
+        return n.assigned_target() == Target::NEON && output_edge->consumer()->assigned_target() == Target::NEON;
+    };
     auto qs8_prec       = [&g](INode &n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
@@ -418,11 +581,19 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, supported_fused_activations);
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(
         g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
+    // Feed-forward GEMM followed by its activation, only the CPU linear layer has a fused output stage
+    detail::fuse_layer<LinearLayerNode, ActivationLayerNode>(
+        g, neon_fused_prec, detail::fuse_node_with_activation<LinearLayerNode>, supported_linear_activations);
     // The fusion of BatchNormalizationLayer must occur after the fusion of ActivationLayer. Because FusedConvolutionBatchNormalizationNode assumes the BatchNormalization is already fused with activation, if any
     detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Residual add followed by layer normalization, only the CPU backend has a fused operator
+    detail::fuse_layer<EltwiseLayerNode, LayerNormNode>(g, neon_fused_prec, detail::fuse_eltwise_add_with_layer_norm);
+    // Token, segment and position lookups followed by their sum, gathered and summed in one CPU kernel
+    detail::fuse_layer<PositionEmbeddingLayerNode, EmbeddingSumLayerNode>(g, neon_fused_prec,
+                                                                          detail::fuse_embedding_gather_sum);
 }
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,54 @@
+#include "arm_compute/graph/nodes/AddLayerNormNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+AddLayerNormNode::AddLayerNormNode(LayerNormLayerInfo info): _info(std::move(info))
+{
+    _input_edges.resize(4, EmptyEdgeID); // Input0, input1, gamma, beta
+    _outputs.resize(1, NullTensorID);
+}
+
+const LayerNormLayerInfo& AddLayerNormNode::layer_norm_info() const
+{
+    return _info;
+}
+
+bool AddLayerNormNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor AddLayerNormNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *src = input(0);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    return src->desc();
+}
+
+NodeType AddLayerNormNode::type() const
+{
+    return NodeType::AddLayerNormLayer;
+}
+
+void AddLayerNormNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,64 @@
+#include "arm_compute/graph/nodes/EmbeddingGatherSumNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+EmbeddingGatherSumNode::EmbeddingGatherSumNode(EmbeddingLayerInfo info) : _info(std::move(info))
+{
+    _input_edges.resize(5, EmptyEdgeID); // Tokens, segments, vocab, segment table, position table
+    _outputs.resize(1, NullTensorID);
+}
+
+const EmbeddingLayerInfo &EmbeddingGatherSumNode::embedding_info() const
+{
+    return _info;
+}
+
+TensorDescriptor EmbeddingGatherSumNode::compute_output_descriptor(const TensorDescriptor &tokens_descriptor,
+                                                                   const TensorDescriptor &vocab_descriptor)
+{
+    TensorDescriptor output_descriptor = vocab_descriptor;
+    output_descriptor.shape.set(1, tokens_descriptor.shape.x() * tokens_descriptor.shape.y());
+
+    return output_descriptor;
+}
+
+bool EmbeddingGatherSumNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(2) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor EmbeddingGatherSumNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *tokens = input(0);
+    const Tensor *vocab  = input(2);
+    ARM_COMPUTE_ERROR_ON(tokens == nullptr || vocab == nullptr);
+
+    return compute_output_descriptor(tokens->desc(), vocab->desc());
+}
+
+NodeType EmbeddingGatherSumNode::type() const
+{
+    return NodeType::EmbeddingGatherSumLayer;
+}
+
+void EmbeddingGatherSumNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -9,7 +9,7 @@ namespace graph
 {
 LayerNormNode::LayerNormNode(LayerNormLayerInfo info): _info(std::move(info))
 {
-    _input_edges.resize(1, EmptyEdgeID); // Input, weight, bias
+    _input_edges.resize(3, EmptyEdgeID); // Input, gamma, beta
     _outputs.resize(1, NullTensorID);
 }
 
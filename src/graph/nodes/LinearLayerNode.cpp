@@ -18,6 +18,16 @@ const LinearLayerInfo& LinearLayerNode::linear_info() const
     return _linear_info;
 }
 
+ActivationLayerInfo LinearLayerNode::fused_activation() const
+{
+    return _linear_info.activation_info();
+}
+
+void LinearLayerNode::set_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _linear_info.set_activation_info(fused_activation);
+}
+
 bool LinearLayerNode::forward_descriptors()
 {
     if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
@@ -43,7 +43,7 @@ TensorDescriptor PositionEmbeddingLayerNode::compute_output_descriptor(const Ten
                                                                        const TensorDescriptor &vector_descriptor)
 {
     TensorDescriptor output_descriptor = vector_descriptor;
-    output_descriptor.shape.set(1, input_descriptor.shape.x());
+    output_descriptor.shape.set(1, input_descriptor.shape.x() * input_descriptor.shape.y());
 
     return output_descriptor;
 }
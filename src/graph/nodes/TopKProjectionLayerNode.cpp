@@ -0,0 +1,59 @@
+#include "arm_compute/graph/nodes/TopKProjectionLayerNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+TopKProjectionLayerNode::TopKProjectionLayerNode(TopKProjectionLayerInfo info) : _info(std::move(info))
+{
+    _input_edges.resize(3, EmptyEdgeID); // Input, weights, bias
+    _outputs.resize(1, NullTensorID);
+}
+
+const TopKProjectionLayerInfo &TopKProjectionLayerNode::topk_info() const
+{
+    return _info;
+}
+
+bool TopKProjectionLayerNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor TopKProjectionLayerNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *src = input(0);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    // Ids and scores are both stored as F32
+    TensorDescriptor output_desc = src->desc();
+    output_desc.shape            = TensorShape(2U, _info.k(), _info.num_rows());
+    output_desc.data_type        = DataType::F32;
+
+    return output_desc;
+}
+
+NodeType TopKProjectionLayerNode::type() const
+{
+    return NodeType::TopKProjectionLayer;
+}
+
+void TopKProjectionLayerNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
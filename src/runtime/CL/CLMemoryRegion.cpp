@@ -92,7 +92,6 @@ void *CLBufferMemoryRegion::ptr()
 void *CLBufferMemoryRegion::map(cl::CommandQueue &q, bool blocking)
 {
     ARM_COMPUTE_ERROR_ON(_mem.get() == nullptr);
-    std::cout << "CLBufferMemoryRegion::map " << std::endl;
     _mapping = q.enqueueMapBuffer(_mem, blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, 0, _size);
     return _mapping;
 }
@@ -152,7 +151,6 @@ void *CLCoarseSVMMemoryRegion::map(cl::CommandQueue &q, bool blocking)
     clEnqueueSVMMap(q.get(), blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, _ptr, _size, 0, nullptr,
                     nullptr);
     
-    std::cout << "CLCoarseSVMMemoryRegion::map" << std::endl;
     _mapping = _ptr;
     return _mapping;
 }
@@ -175,7 +173,6 @@ void *CLFineSVMMemoryRegion::map(cl::CommandQueue &q, bool blocking)
     {
         clFinish(q.get());
     }
-    std::cout << "CLFineSVMMemoryRegion::map" << std::endl;
     _mapping = _ptr;
     return _mapping;
 }
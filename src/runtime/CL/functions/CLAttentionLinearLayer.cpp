@@ -3,17 +3,16 @@
 #include "arm_compute/core/CL/ICLTensor.h"
 #include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLConcatenateLayer.h"
+#include "arm_compute/runtime/CL/functions/CLLinearLayer.h"
+#include "arm_compute/runtime/CL/functions/CLSlice.h"
 
 #include "src/core/CL/ICLKernel.h"
 #include "src/core/helpers/MemoryHelpers.h"
 
 #include "src/gpu/cl/operators/ClLinear.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
@@ -39,6 +38,18 @@ struct CLAttentionLinearLayer::Impl
     std::unique_ptr<opencl::ClLinear> key_kernel{ nullptr };
     std::unique_ptr<opencl::ClLinear> value_kernel{ nullptr };
 
+    // Fused QKV projection
+    CLTensor                            qkv_w{};
+    CLTensor                            qkv_b{};
+    CLTensor                            qkv_output{};
+    std::unique_ptr<CLConcatenateLayer> concat_w_func{ nullptr };
+    std::unique_ptr<CLConcatenateLayer> concat_b_func{ nullptr };
+    std::unique_ptr<CLLinearLayer>      qkv_func{ nullptr };
+    std::unique_ptr<CLSlice>            query_slice{ nullptr };
+    std::unique_ptr<CLSlice>            key_slice{ nullptr };
+    std::unique_ptr<CLSlice>            value_slice{ nullptr };
+
+    bool is_fused{ false };
     bool is_prepared{ false };
 };
 
@@ -71,9 +82,50 @@ void CLAttentionLinearLayer::configure(const CLCompileContext &compile_context,
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_UNUSED(linear_info);
 
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
+    // All projections read the same input, so one GEMM over [Wq | Wk | Wv] produces all three outputs
+    _impl->is_fused    = linear_info.fuse_qkv() && query_input == key_input && key_input == value_input;
+    _impl->is_prepared = false;
+    if(_impl->is_fused)
+    {
+        _impl->query_w      = query_w;
+        _impl->key_w        = key_w;
+        _impl->value_w      = value_w;
+        _impl->query_output = query_output;
+        _impl->key_output   = key_output;
+        _impl->value_output = value_output;
+
+        // Weights are stored (in_features, out_features), output features are concatenated along Y
+        std::vector<const ICLTensor *> weights{ static_cast<const ICLTensor *>(query_w), static_cast<const ICLTensor *>(key_w),
+                                                static_cast<const ICLTensor *>(value_w) };
+        std::vector<const ICLTensor *> biases{ static_cast<const ICLTensor *>(query_b), static_cast<const ICLTensor *>(key_b),
+                                               static_cast<const ICLTensor *>(value_b) };
+        _impl->concat_w_func = std::make_unique<CLConcatenateLayer>();
+        _impl->concat_w_func->configure(compile_context, weights, &_impl->qkv_w, Window::DimY);
+        _impl->concat_b_func = std::make_unique<CLConcatenateLayer>();
+        _impl->concat_b_func->configure(compile_context, biases, &_impl->qkv_b, Window::DimX);
+
+        _impl->qkv_func = std::make_unique<CLLinearLayer>();
+        _impl->qkv_func->configure(compile_context, query_input, &_impl->qkv_w, &_impl->qkv_b, &_impl->qkv_output, linear_info);
+
+        // Split the (3 * d_model, seq_len) result back into the query, key and value outputs
+        const int d_q = query_w->info()->dimension(1);
+        const int d_k = key_w->info()->dimension(1);
+        const int d_v = value_w->info()->dimension(1);
+        _impl->query_slice = std::make_unique<CLSlice>();
+        _impl->query_slice->configure(compile_context, &_impl->qkv_output, static_cast<ICLTensor *>(query_output), Coordinates(0), Coordinates(d_q));
+        _impl->key_slice = std::make_unique<CLSlice>();
+        _impl->key_slice->configure(compile_context, &_impl->qkv_output, static_cast<ICLTensor *>(key_output), Coordinates(d_q), Coordinates(d_q + d_k));
+        _impl->value_slice = std::make_unique<CLSlice>();
+        _impl->value_slice->configure(compile_context, &_impl->qkv_output, static_cast<ICLTensor *>(value_output),
+                                      Coordinates(d_q + d_k), Coordinates(d_q + d_k + d_v));
+
+        _impl->qkv_w.allocator()->allocate();
+        _impl->qkv_b.allocator()->allocate();
+        _impl->qkv_output.allocator()->allocate();
+
+        return;
+    }
+
     _impl->query_input  = query_input;
     _impl->query_w      = query_w;
     _impl->query_b      = query_b;
@@ -97,15 +149,6 @@ void CLAttentionLinearLayer::configure(const CLCompileContext &compile_context,
 
     _impl->value_kernel = std::make_unique<opencl::ClLinear>();
     _impl->value_kernel->configure(compile_context, value_input->info(), value_w->info(), value_b->info(), value_output->info(), 1.0f, 0.f);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLAttentionLinearLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 Status CLAttentionLinearLayer::validate(const ITensor *input,
@@ -118,9 +161,17 @@ Status CLAttentionLinearLayer::validate(const ITensor *input,
 
 void CLAttentionLinearLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
+    if(_impl->is_fused)
+    {
+        prepare();
+
+        _impl->qkv_func->run();
+        _impl->query_slice->run();
+        _impl->key_slice->run();
+        _impl->value_slice->run();
+
+        return;
+    }
 
     // Q
     ITensorPack query_pack;
@@ -145,15 +196,22 @@ void CLAttentionLinearLayer::run()
     value_pack.add_tensor(TensorType::ACL_SRC_2, _impl->value_b);
     value_pack.add_tensor(TensorType::ACL_DST, _impl->value_output);
     _impl->value_kernel->run(value_pack);
+}
 
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLAttentionLinearLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+void CLAttentionLinearLayer::prepare()
+{
+    if(_impl->is_fused && !_impl->is_prepared)
+    {
+        // Concatenate the weights once, every run reads the fused copy
+        _impl->concat_w_func->run();
+        _impl->concat_b_func->run();
+
+        _impl->query_w->mark_as_unused();
+        _impl->key_w->mark_as_unused();
+        _impl->value_w->mark_as_unused();
+
+        _impl->is_prepared = true;
+    }
 }
 
 } // namespace arm_compute
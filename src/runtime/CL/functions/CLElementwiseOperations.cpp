@@ -36,11 +36,6 @@
 
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 struct CLArithmeticAddition::Impl
@@ -90,26 +85,12 @@ Status CLArithmeticAddition::validate(const ITensorInfo         *input1,
 
 void CLArithmeticAddition::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC_0, _impl->src_0);
     pack.add_tensor(TensorType::ACL_SRC_1, _impl->src_1);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
 
     _impl->op->run(pack);
-
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLArithmeticAddition::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 struct CLArithmeticSubtraction::Impl
@@ -7,11 +7,6 @@
 #include "src/core/CL/ICLKernel.h"
 #include "src/gpu/cl/operators/ClEmbedSum.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
@@ -48,10 +43,6 @@ void CLEmbeddingSumLayer::configure(const CLCompileContext   &compile_context,
                                     ICLTensor                *output,
                                     const EmbeddingLayerInfo &emb_info)
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     _impl->token    = token;
     _impl->segment  = segment;
     _impl->position = position;
@@ -64,15 +55,6 @@ void CLEmbeddingSumLayer::configure(const CLCompileContext   &compile_context,
                          position->info(),
                          output->info(),
                          emb_info);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLEmbeddingSumLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 void CLEmbeddingSumLayer::prepare()
@@ -81,10 +63,6 @@ void CLEmbeddingSumLayer::prepare()
 
 void CLEmbeddingSumLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC_0, _impl->token);
     pack.add_tensor(TensorType::ACL_SRC_1, _impl->segment);
@@ -92,15 +70,6 @@ void CLEmbeddingSumLayer::run()
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
 
     _impl->op->run(pack);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLEmbeddingSumLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 } // namespace arm_compute
\ No newline at end of file
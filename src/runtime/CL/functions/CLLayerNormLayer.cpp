@@ -7,17 +7,14 @@
 
 #include "src/gpu/cl/operators/ClLayerNorm.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
 struct CLLayerNormLayer::Impl
 {
     const ITensor                     *src{ nullptr };
+    const ITensor                     *gamma{ nullptr };
+    const ITensor                     *beta{ nullptr };
     ITensor                           *dst{ nullptr };
     std::unique_ptr<opencl::ClLayerNorm> op{ nullptr };
 };
@@ -39,27 +36,34 @@ void CLLayerNormLayer::configure(const CLCompileContext   &compile_context,
                                  ITensor                *output,
                                  const LayerNormLayerInfo &LayerNorm_info)
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
+    configure(compile_context, input, nullptr, nullptr, output, LayerNorm_info);
+}
+void CLLayerNormLayer::configure(const ITensor          *input,
+                                 const ITensor          *gamma,
+                                 const ITensor          *beta,
+                                 ITensor                *output,
+                                 const LayerNormLayerInfo &LayerNorm_info)
+{
+    configure(CLKernelLibrary::get().get_compile_context(), input, gamma, beta, output, LayerNorm_info);
+}
+void CLLayerNormLayer::configure(const CLCompileContext   &compile_context,
+                                 const ITensor          *input,
+                                 const ITensor          *gamma,
+                                 const ITensor          *beta,
+                                 ITensor                *output,
+                                 const LayerNormLayerInfo &LayerNorm_info)
+{
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_LOG_PARAMS(input, output);
+    ARM_COMPUTE_LOG_PARAMS(input, gamma, beta, output);
 
-    _impl->src = input;
-    _impl->dst = output;
+    _impl->src   = input;
+    _impl->gamma = gamma;
+    _impl->beta  = beta;
+    _impl->dst   = output;
 
     _impl->op = std::make_unique<opencl::ClLayerNorm>();
-    _impl->op->configure(compile_context, input->info(), output->info(), LayerNorm_info);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLLayerNormLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    _impl->op->configure(compile_context, input->info(), (gamma != nullptr) ? gamma->info() : nullptr,
+                         (beta != nullptr) ? beta->info() : nullptr, output->info(), LayerNorm_info);
 }
 
 Status CLLayerNormLayer::validate(const ICLTensor          *input,
@@ -67,30 +71,19 @@ Status CLLayerNormLayer::validate(const ICLTensor          *input,
                                   const LayerNormLayerInfo &LayerNorm_info)
 {
     ARM_COMPUTE_UNUSED(LayerNorm_info);
-    return opencl::ClLayerNorm::validate(input->info(), output->info(), LayerNorm_info);
+    return opencl::ClLayerNorm::validate(input->info(), nullptr, nullptr, output->info(), LayerNorm_info);
 }
 
 void CLLayerNormLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
 
-    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
+    pack.add_tensor(TensorType::ACL_SRC_1, _impl->gamma);
+    pack.add_tensor(TensorType::ACL_SRC_2, _impl->beta);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
 
     _impl->op->run(pack);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLLayerNormLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 } // namespace arm_compute
@@ -9,11 +9,6 @@
 
 #include "src/gpu/cl/operators/ClLinear.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
@@ -51,11 +46,6 @@ void CLLinearLayer::configure(const CLCompileContext &compile_context,
                               const ITensor *bias, ITensor *output, const LinearLayerInfo &linear_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_UNUSED(linear_info);
-
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
 
     _impl->src    = input;
     _impl->weight = weight;
@@ -63,32 +53,19 @@ void CLLinearLayer::configure(const CLCompileContext &compile_context,
     _impl->dst    = output;
 
     _impl->op = std::make_unique<opencl::ClLinear>();
-    _impl->op->configure(compile_context, input->info(), weight->info(), bias->info(), output->info(), 1.0f, 0.f);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLLinearLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    _impl->op->configure(compile_context, input->info(), weight->info(), bias->info(), output->info(), 1.0f, 0.f, linear_info);
 }
 
 Status CLLinearLayer::validate(const ITensor *input,
                                const ITensor *weight,
                                const ITensor *bias, ITensor *output, const LinearLayerInfo &linear_info)
 {
-    ARM_COMPUTE_UNUSED(linear_info);
-    return opencl::ClLinear::validate(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f);
+    return opencl::ClLinear::validate(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f,
+                                      linear_info);
 }
 
 void CLLinearLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
 
     pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
@@ -97,15 +74,6 @@ void CLLinearLayer::run()
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
 
     _impl->op->run(pack);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLLinearLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 } // namespace arm_compute
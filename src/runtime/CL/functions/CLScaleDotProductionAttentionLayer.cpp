@@ -9,11 +9,6 @@
 #include "src/core/CL/ICLKernel.h"
 #include "src/gpu/cl/operators/ClScaleDotProduction.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
@@ -61,45 +56,19 @@ void CLScaleDotProductionAttentionLayer::configure(const CLCompileContext
                                                    const ScaleDotProductionLayerInfo &info,
                                                    int recurrence_count)
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     std::cout << "NEScaleDotProductionAttentionLayer::configure recurrence count: " << recurrence_count << std::endl;
 
     /* Scale dot production of key and query */
     _impl->scale_dot_production_op = std::make_unique<opencl::ClScaleDotProduction>();
     _impl->scale_dot_production_op->configure(compile_context, query->info(), key->info(), value->info(), output->info(), info);
     _impl->scale_dot_pack = { { ACL_SRC_0, query }, { ACL_SRC_1, key }, { ACL_SRC_2, value }, { ACL_DST, output } };
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLScaleDotProductionAttentionLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 void CLScaleDotProductionAttentionLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
 
     _impl->scale_dot_production_op->run(_impl->scale_dot_pack);
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "CLScaleDotProductionAttentionLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 
 } // namespace arm_compute
\ No newline at end of file
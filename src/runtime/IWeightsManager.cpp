@@ -25,7 +25,8 @@
 
 namespace arm_compute
 {
-IWeightsManager::IWeightsManager() : _managed_weights(), _managed_counter(), _managed_weights_parents()
+IWeightsManager::IWeightsManager()
+    : _managed_weights(), _managed_counter(), _managed_weights_parents(), _packed_weights_cache(), _packed_weights()
 {
 }
 
@@ -174,4 +175,26 @@ void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 
     _managed_counter[weights].is_unused = true;
 }
+
+void IWeightsManager::set_packed_weights_cache(std::shared_ptr<PackedWeightsCache> cache)
+{
+    _packed_weights_cache = std::move(cache);
+}
+
+PackedWeightsCache *IWeightsManager::packed_weights_cache() const
+{
+    return _packed_weights_cache.get();
+}
+
+void IWeightsManager::register_packed_weights(const std::string &key, std::vector<const ITensor *> buffers)
+{
+    // The first registration wins, later functions import it rather than replace it
+    _packed_weights.emplace(key, std::move(buffers));
+}
+
+std::vector<const ITensor *> IWeightsManager::find_packed_weights(const std::string &key) const
+{
+    const auto it = _packed_weights.find(key);
+    return (it != _packed_weights.end()) ? it->second : std::vector<const ITensor *>();
+}
 } // namespace arm_compute
@@ -27,11 +27,6 @@
 
 #include "src/cpu/operators/CpuActivation.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 struct NEActivationLayer::Impl
@@ -70,22 +65,9 @@ NEActivationLayer::validate(const ITensorInfo *input, const ITensorInfo *output,
 void NEActivationLayer::run()
 {
 
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC, _impl->src);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
     _impl->op->run(pack);
-    
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NEActivationLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 }
 } // namespace arm_compute
@@ -0,0 +1,71 @@
+#include "arm_compute/runtime/NEON/functions/NEAddLayerNormLayer.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuAddLayerNorm.h"
+
+namespace arm_compute
+{
+
+struct NEAddLayerNormLayer::Impl
+{
+    const ITensor                         *src0{nullptr};
+    const ITensor                         *src1{nullptr};
+    const ITensor                         *gamma{nullptr};
+    const ITensor                         *beta{nullptr};
+    ITensor                               *dst{nullptr};
+    std::unique_ptr<cpu::CpuAddLayerNorm>  op{nullptr};
+};
+
+NEAddLayerNormLayer::NEAddLayerNormLayer() : _impl(std::make_unique<Impl>())
+{
+}
+NEAddLayerNormLayer::~NEAddLayerNormLayer() = default;
+
+void NEAddLayerNormLayer::configure(const ITensor *input1,
+                                    const ITensor *input2,
+                                    const ITensor *gamma,
+                                    const ITensor *beta,
+                                    ITensor *output,
+                                    const LayerNormLayerInfo& LayerNorm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input1, input2, output);
+    ARM_COMPUTE_LOG_PARAMS(input1, input2, gamma, beta, output);
+
+    _impl->src0  = input1;
+    _impl->src1  = input2;
+    _impl->gamma = gamma;
+    _impl->beta  = beta;
+    _impl->dst   = output;
+
+    _impl->op = std::make_unique<cpu::CpuAddLayerNorm>();
+    _impl->op->configure(input1->info(), input2->info(), (gamma != nullptr) ? gamma->info() : nullptr,
+                         (beta != nullptr) ? beta->info() : nullptr, output->info(), LayerNorm_info);
+}
+
+Status NEAddLayerNormLayer::validate(const ITensorInfo *input1,
+                                     const ITensorInfo *input2,
+                                     const ITensorInfo *gamma,
+                                     const ITensorInfo *beta,
+                                     const ITensorInfo *output,
+                                     const LayerNormLayerInfo& LayerNorm_info)
+{
+    return cpu::CpuAddLayerNorm::validate(input1, input2, gamma, beta, output, LayerNorm_info);
+}
+
+void NEAddLayerNormLayer::run()
+{
+    ITensorPack pack;
+
+    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src0);
+    pack.add_tensor(TensorType::ACL_SRC_1, _impl->src1);
+    pack.add_tensor(TensorType::ACL_SRC_2, _impl->gamma);
+    pack.add_tensor(TensorType::ACL_SRC_3, _impl->beta);
+    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
+
+    _impl->op->run(pack);
+}
+
+} // namespace arm_compute
@@ -1,39 +1,48 @@
 #include "arm_compute/runtime/NEON/functions/NEAttentionLinearLayer.h"
 
 #include "arm_compute/core/Validate.h"
-#include "src/core/helpers/MemoryHelpers.h"
-#include "src/cpu/operators/CpuLinear.h"
-
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
+#include "arm_compute/runtime/NEON/functions/NESlice.h"
 
 namespace arm_compute
 {
 
 struct NEAttentionLinearLayer::Impl
 {
-    const ITensor                  *query_input{ nullptr };
-    const ITensor                  *query_w{ nullptr };
-    const ITensor                  *query_b{ nullptr };
-    const ITensor                  *key_input{ nullptr };
-    const ITensor                  *key_w{ nullptr };
-    const ITensor                  *key_b{ nullptr };
-    const ITensor                  *value_input{ nullptr };
-    const ITensor                  *value_w{ nullptr };
-    const ITensor                  *value_b{ nullptr };
-    ITensor                        *query_output{ nullptr };
-    ITensor                        *key_output{ nullptr };
-    ITensor                        *value_output{ nullptr };
-    std::unique_ptr<cpu::CpuLinear> query_kernel{ nullptr };
-    std::unique_ptr<cpu::CpuLinear> key_kernel{ nullptr };
-    std::unique_ptr<cpu::CpuLinear> value_kernel{ nullptr };
+    MemoryGroup                    memory_group{};
+    IWeightsManager               *weights_manager{ nullptr };
+    std::unique_ptr<NELinearLayer> query_func{ nullptr };
+    std::unique_ptr<NELinearLayer> key_func{ nullptr };
+    std::unique_ptr<NELinearLayer> value_func{ nullptr };
+
+    // Fused QKV projection
+    const ITensor                      *query_w{ nullptr };
+    const ITensor                      *query_b{ nullptr };
+    const ITensor                      *key_w{ nullptr };
+    const ITensor                      *key_b{ nullptr };
+    const ITensor                      *value_w{ nullptr };
+    const ITensor                      *value_b{ nullptr };
+    Tensor                              qkv_w{};
+    Tensor                              qkv_b{};
+    Tensor                              qkv_output{};
+    std::unique_ptr<NEConcatenateLayer> concat_w_func{ nullptr };
+    std::unique_ptr<NEConcatenateLayer> concat_b_func{ nullptr };
+    std::unique_ptr<NELinearLayer>      qkv_func{ nullptr };
+    std::unique_ptr<NESlice>            query_slice{ nullptr };
+    std::unique_ptr<NESlice>            key_slice{ nullptr };
+    std::unique_ptr<NESlice>            value_slice{ nullptr };
+
+    bool is_fused{ false };
+    bool is_prepared{ false };
 };
 
-NEAttentionLinearLayer::NEAttentionLinearLayer()
+NEAttentionLinearLayer::NEAttentionLinearLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
     : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group    = MemoryGroup(std::move(memory_manager));
+    _impl->weights_manager = weights_manager;
 }
 
 NEAttentionLinearLayer::~NEAttentionLinearLayer() = default;
@@ -44,86 +53,128 @@ void NEAttentionLinearLayer::configure(const ITensor *query_input, const ITensor
                                        ITensor *query_output, ITensor *key_output, ITensor *value_output,
                                        const LinearLayerInfo& linear_info)
 {
-    ARM_COMPUTE_UNUSED(linear_info);
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
-
-    _impl->query_input  = query_input;
-    _impl->query_w      = query_w;
-    _impl->query_b      = query_b;
-    _impl->query_output = query_output;
-
-    _impl->query_kernel = std::make_unique<cpu::CpuLinear>();
-    _impl->query_kernel->configure(query_input->info(), query_w->info(), query_b->info(), query_output->info(), 1.0f, 1.0f);
-
-    _impl->key_input  = key_input;
-    _impl->key_w      = key_w;
-    _impl->key_b      = key_b;
-    _impl->key_output = key_output;
-
-    _impl->key_kernel = std::make_unique<cpu::CpuLinear>();
-    _impl->key_kernel->configure(key_input->info(), key_w->info(), key_b->info(), key_output->info(), 1.0f, 1.0f);
-
-    _impl->value_input  = value_input;
-    _impl->value_w      = value_w;
-    _impl->value_b      = value_b;
-    _impl->value_output = value_output;
-
-    _impl->value_kernel = std::make_unique<cpu::CpuLinear>();
-    _impl->value_kernel->configure(value_input->info(), value_w->info(), value_b->info(), value_output->info(), 1.0f, 1.0f);
-
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NEAttentionLinearLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    // All projections read the same input, so one GEMM over [Wq | Wk | Wv] produces all three outputs.
+    // Projections with and without a bias can not share one GEMM output stage
+    const bool has_bias  = query_b != nullptr && key_b != nullptr && value_b != nullptr;
+    const bool no_bias   = query_b == nullptr && key_b == nullptr && value_b == nullptr;
+    _impl->is_fused      = linear_info.fuse_qkv() && query_input == key_input && key_input == value_input && (has_bias || no_bias);
+    _impl->is_prepared   = false;
+    if(_impl->is_fused)
+    {
+        _impl->query_w = query_w;
+        _impl->query_b = query_b;
+        _impl->key_w   = key_w;
+        _impl->key_b   = key_b;
+        _impl->value_w = value_w;
+        _impl->value_b = value_b;
+
+        // Weights are stored (in_features, out_features), output features are concatenated along Y
+        _impl->concat_w_func = std::make_unique<NEConcatenateLayer>();
+        _impl->concat_w_func->configure({ query_w, key_w, value_w }, &_impl->qkv_w, Window::DimY);
+        if(has_bias)
+        {
+            _impl->concat_b_func = std::make_unique<NEConcatenateLayer>();
+            _impl->concat_b_func->configure({ query_b, key_b, value_b }, &_impl->qkv_b, Window::DimX);
+        }
+
+        // The fused result only lives until it is split. The outputs are distinct tensors of the graph, so the GEMM
+        // can not write them in place: each is a contiguous (d, seq_len) tensor, a strided view of the
+        // (3 * d_model, seq_len) result would need every consumer to accept padded rows
+        _impl->memory_group.manage(&_impl->qkv_output);
+
+        // Only concatenate the weights when the reshaped copy is not shared or cached
+        _impl->qkv_func = std::make_unique<NELinearLayer>(nullptr, _impl->weights_manager);
+        _impl->qkv_func->configure(query_input, &_impl->qkv_w, has_bias ? &_impl->qkv_b : nullptr, &_impl->qkv_output, linear_info);
+        _impl->qkv_func->set_weights_source({ query_w, key_w, value_w }, [this]()
+        {
+            _impl->qkv_w.allocator()->allocate();
+            _impl->concat_w_func->run();
+        });
+
+        // Split the (3 * d_model, seq_len) result back into the query, key and value outputs
+        const int d_q = query_w->info()->dimension(1);
+        const int d_k = key_w->info()->dimension(1);
+        const int d_v = value_w->info()->dimension(1);
+        _impl->query_slice = std::make_unique<NESlice>();
+        _impl->query_slice->configure(&_impl->qkv_output, query_output, Coordinates(0), Coordinates(d_q));
+        _impl->key_slice = std::make_unique<NESlice>();
+        _impl->key_slice->configure(&_impl->qkv_output, key_output, Coordinates(d_q), Coordinates(d_q + d_k));
+        _impl->value_slice = std::make_unique<NESlice>();
+        _impl->value_slice->configure(&_impl->qkv_output, value_output, Coordinates(d_q + d_k), Coordinates(d_q + d_k + d_v));
+
+        _impl->qkv_output.allocator()->allocate();
+    }
+    else
+    {
+        // Each projection owns its reshaped weights, which are prepared once and reused by every run
+        _impl->query_func = std::make_unique<NELinearLayer>(nullptr, _impl->weights_manager);
+        _impl->query_func->configure(query_input, query_w, query_b, query_output, linear_info);
+
+        _impl->key_func = std::make_unique<NELinearLayer>(nullptr, _impl->weights_manager);
+        _impl->key_func->configure(key_input, key_w, key_b, key_output, linear_info);
+
+        _impl->value_func = std::make_unique<NELinearLayer>(nullptr, _impl->weights_manager);
+        _impl->value_func->configure(value_input, value_w, value_b, value_output, linear_info);
+    }
 }
 
 void NEAttentionLinearLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
-    // Q
-    ITensorPack query_pack;
-    query_pack.add_tensor(TensorType::ACL_SRC_0, _impl->query_input);
-    query_pack.add_tensor(TensorType::ACL_SRC_1, _impl->query_w);
-    query_pack.add_tensor(TensorType::ACL_SRC_2, _impl->query_b);
-    query_pack.add_tensor(TensorType::ACL_DST, _impl->query_output);
-    _impl->query_kernel->run(query_pack);
-
-    // K
-    ITensorPack key_pack;
-    key_pack.add_tensor(TensorType::ACL_SRC_0, _impl->key_input);
-    key_pack.add_tensor(TensorType::ACL_SRC_1, _impl->key_w);
-    key_pack.add_tensor(TensorType::ACL_SRC_2, _impl->key_b);
-    key_pack.add_tensor(TensorType::ACL_DST, _impl->key_output);
-    _impl->key_kernel->run(key_pack);
-
-    // V
-    ITensorPack value_pack;
-    value_pack.add_tensor(TensorType::ACL_SRC_0, _impl->value_input);
-    value_pack.add_tensor(TensorType::ACL_SRC_1, _impl->value_w);
-    value_pack.add_tensor(TensorType::ACL_SRC_2, _impl->value_b);
-    value_pack.add_tensor(TensorType::ACL_DST, _impl->value_output);
-    _impl->value_kernel->run(value_pack);
-
-
-#ifdef MEASURE_TIME
-    auto          end_time  = std::chrono::high_resolution_clock::now();
-    double        cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt", std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NEAttentionLinearLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    if(_impl->is_fused)
+    {
+        prepare();
+
+        MemoryGroupResourceScope scope_mg(_impl->memory_group);
+        _impl->qkv_func->run();
+
+        _impl->query_slice->run();
+        _impl->key_slice->run();
+        _impl->value_slice->run();
+    }
+    else
+    {
+        _impl->query_func->run();
+        _impl->key_func->run();
+        _impl->value_func->run();
+    }
+}
+
+void NEAttentionLinearLayer::prepare()
+{
+    if(!_impl->is_fused)
+    {
+        _impl->query_func->prepare();
+        _impl->key_func->prepare();
+        _impl->value_func->prepare();
+        return;
+    }
+
+    if(!_impl->is_prepared)
+    {
+        // The fused bias is read by every run, the original ones are not
+        if(_impl->concat_b_func != nullptr)
+        {
+            _impl->qkv_b.allocator()->allocate();
+            _impl->concat_b_func->run();
+            _impl->query_b->mark_as_unused();
+            _impl->key_b->mark_as_unused();
+            _impl->value_b->mark_as_unused();
+        }
+
+        // Concatenates the weights only if it has to reshape them
+        _impl->qkv_func->prepare();
+
+        // Only the packed copy is read from now on
+        _impl->query_w->mark_as_unused();
+        _impl->key_w->mark_as_unused();
+        _impl->value_w->mark_as_unused();
+        if(!_impl->qkv_w.is_used())
+        {
+            _impl->qkv_w.allocator()->free();
+        }
+
+        _impl->is_prepared = true;
+    }
 }
 
 } // namespace arm_compute
\ No newline at end of file
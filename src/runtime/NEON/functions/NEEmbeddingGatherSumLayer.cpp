@@ -0,0 +1,82 @@
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingGatherSumLayer.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuEmbeddingGatherSum.h"
+
+namespace arm_compute
+{
+
+struct NEEmbeddingGatherSumLayer::Impl
+{
+    const ITensor                               *tokens{nullptr};
+    const ITensor                               *segments{nullptr};
+    const ITensor                               *vocab{nullptr};
+    const ITensor                               *segment_table{nullptr};
+    const ITensor                               *position_table{nullptr};
+    const ITensor                               *history{nullptr};
+    ITensor                                     *dst{nullptr};
+    std::unique_ptr<cpu::CpuEmbeddingGatherSum>  op{nullptr};
+};
+
+NEEmbeddingGatherSumLayer::NEEmbeddingGatherSumLayer() : _impl(std::make_unique<Impl>())
+{
+}
+NEEmbeddingGatherSumLayer::~NEEmbeddingGatherSumLayer() = default;
+
+void NEEmbeddingGatherSumLayer::configure(const ITensor            *tokens,
+                                          const ITensor            *segments,
+                                          const ITensor            *vocab,
+                                          const ITensor            *segment_table,
+                                          const ITensor            *position_table,
+                                          ITensor                  *output,
+                                          const EmbeddingLayerInfo &emb_info,
+                                          const ITensor            *history)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tokens, segments, vocab, segment_table, position_table, output);
+    ARM_COMPUTE_LOG_PARAMS(tokens, segments, vocab, segment_table, position_table, output);
+
+    _impl->tokens         = tokens;
+    _impl->segments       = segments;
+    _impl->vocab          = vocab;
+    _impl->segment_table  = segment_table;
+    _impl->position_table = position_table;
+    _impl->history        = history;
+    _impl->dst            = output;
+
+    _impl->op = std::make_unique<cpu::CpuEmbeddingGatherSum>();
+    _impl->op->configure(tokens->info(), segments->info(), vocab->info(), segment_table->info(),
+                         position_table->info(), output->info(), emb_info);
+}
+
+Status NEEmbeddingGatherSumLayer::validate(const ITensorInfo        *tokens,
+                                           const ITensorInfo        *segments,
+                                           const ITensorInfo        *vocab,
+                                           const ITensorInfo        *segment_table,
+                                           const ITensorInfo        *position_table,
+                                           const ITensorInfo        *output,
+                                           const EmbeddingLayerInfo &emb_info)
+{
+    return cpu::CpuEmbeddingGatherSum::validate(tokens, segments, vocab, segment_table, position_table, output, emb_info);
+}
+
+void NEEmbeddingGatherSumLayer::run()
+{
+    ITensorPack pack;
+
+    pack.add_tensor(TensorType::ACL_SRC_0, _impl->tokens);
+    pack.add_tensor(TensorType::ACL_SRC_1, _impl->segments);
+    pack.add_tensor(TensorType::ACL_SRC_2, _impl->vocab);
+    pack.add_tensor(TensorType::ACL_SRC_3, _impl->segment_table);
+    pack.add_tensor(TensorType::ACL_SRC_4, _impl->position_table);
+    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
+    if(_impl->history != nullptr)
+    {
+        pack.add_tensor(TensorType::ACL_SRC_5, _impl->history);
+    }
+
+    _impl->op->run(pack);
+}
+
+} // namespace arm_compute
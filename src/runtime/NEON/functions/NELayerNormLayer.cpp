@@ -6,17 +6,14 @@
 #include "src/common/utils/Log.h"
 #include "src/cpu/operators/CpuLayerNorm.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
 struct  NELayerNormLayer::Impl
 {
     const ITensor                       *src{nullptr};
+    const ITensor                       *gamma{nullptr};
+    const ITensor                       *beta{nullptr};
     ITensor                             *dst{nullptr};
     std::unique_ptr<cpu::CpuLayerNorm>  op{nullptr};
 };
@@ -30,59 +27,48 @@ void NELayerNormLayer::configure(const ITensor *input,
                               ITensor *output,
                               const LayerNormLayerInfo& LayerNorm_info)
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
+    configure(input, nullptr, nullptr, output, LayerNorm_info);
+}
 
+void NELayerNormLayer::configure(const ITensor *input,
+                              const ITensor *gamma,
+                              const ITensor *beta,
+                              ITensor *output,
+                              const LayerNormLayerInfo& LayerNorm_info)
+{
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_LOG_PARAMS(input, output);
+    ARM_COMPUTE_LOG_PARAMS(input, gamma, beta, output);
 
     _impl->src      = input;
+    _impl->gamma    = gamma;
+    _impl->beta     = beta;
     _impl->dst      = output;
 
     _impl->op = std::make_unique<cpu::CpuLayerNorm>();
-    _impl->op->configure(input->info(), output->info(), LayerNorm_info);
-
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NELayerNormLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    _impl->op->configure(input->info(), (gamma != nullptr) ? gamma->info() : nullptr,
+                         (beta != nullptr) ? beta->info() : nullptr, output->info(), LayerNorm_info);
 }
 
-Status NELayerNormLayer::validate(const ITensor *input,
-                                  ITensor *output, 
+Status NELayerNormLayer::validate(const ITensorInfo *input,
+                                  const ITensorInfo *gamma,
+                                  const ITensorInfo *beta,
+                                  const ITensorInfo *output,
                                   const LayerNormLayerInfo& LayerNorm_info)
 {
-    ARM_COMPUTE_UNUSED(LayerNorm_info);
-    return cpu::CpuLayerNorm::validate(input->info(), output->info(), LayerNorm_info);
+    return cpu::CpuLayerNorm::validate(input, gamma, beta, output, LayerNorm_info);
 }
 
 void NELayerNormLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
     ITensorPack pack;
     
-    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
+    pack.add_tensor(TensorType::ACL_SRC_1, _impl->gamma);
+    pack.add_tensor(TensorType::ACL_SRC_2, _impl->beta);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
     
     _impl->op->run(pack);
 
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NELayerNormLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
-
 }
 
 } // namespace arm_compute
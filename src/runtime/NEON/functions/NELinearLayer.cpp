@@ -1,30 +1,84 @@
 #include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
 
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/PackedWeightsCache.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuLinear.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
+#include <sstream>
+#include <vector>
 
 namespace arm_compute
 {
 
+using namespace arm_compute::experimental;
+
+namespace
+{
+/** Points the workspace tensors at the reshaped weights of another function, freeing their own memory
+ *
+ * @return False if there is nothing to import, the sizes differ or an import fails, @p packed then keeps memory of its own
+ */
+bool import_packed_weights(const std::vector<const ITensor *> &shared, const std::vector<Tensor *> &packed)
+{
+    if(shared.empty() || shared.size() != packed.size())
+    {
+        return false;
+    }
+    for(size_t i = 0; i < packed.size(); ++i)
+    {
+        if(shared[i]->info()->total_size() != packed[i]->info()->total_size())
+        {
+            return false;
+        }
+    }
+    for(size_t i = 0; i < packed.size(); ++i)
+    {
+        if(!bool(packed[i]->allocator()->import_memory(shared[i]->buffer())))
+        {
+            // The workspace keeps memory of its own to reshape the weights into
+            for(size_t j = 0; j < i; ++j)
+            {
+                packed[j]->allocator()->free();
+                packed[j]->allocator()->allocate();
+            }
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
 struct  NELinearLayer::Impl
 {
+    MemoryGroup                        memory_group{};
+    IWeightsManager                    *weights_manager{nullptr};
+
     const ITensor                      *src{nullptr};
     const ITensor                      *weight{nullptr};
     const ITensor                      *bias{nullptr};
     ITensor                            *dst{nullptr};
     std::unique_ptr<cpu::CpuLinear>    kernel{nullptr};
+
+    ITensorPack                        run_pack{};
+    PackedWeightsCache::Mapping        packed_weights{nullptr};
+    std::vector<const ITensor *>       weight_sources{};
+    std::function<void()>              fill_weights{};
+    WorkspaceData<Tensor>              workspace{};
+    experimental::MemoryRequirements   aux_mem_req{};
+
+    bool                               is_prepared{false};
 };
 
-NELinearLayer::NELinearLayer() : _impl(std::make_unique<Impl>())
+NELinearLayer::NELinearLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group    = MemoryGroup(std::move(memory_manager));
+    _impl->weights_manager = weights_manager;
 }
 NELinearLayer::~NELinearLayer() = default;
 
@@ -34,62 +88,142 @@ void NELinearLayer::configure(const ITensor *input,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_LOG_PARAMS(input, output);
-    ARM_COMPUTE_UNUSED(linear_info);
-
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
 
     _impl->src      = input;
     _impl->weight   = weight;
     _impl->bias     = bias;
     _impl->dst      = output;
 
+    _impl->is_prepared = false;
+
     _impl->kernel = std::make_unique<cpu::CpuLinear>();
-    _impl->kernel->configure(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f);
-
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NELinearLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    _impl->kernel->configure(input->info(), weight->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(),
+                             1.0f, 1.0f, linear_info);
+
+    if(_impl->weights_manager != nullptr)
+    {
+        _impl->weights_manager->manage(weight);
+    }
+
+    // Reshaped weights live in the persistent part of the workspace and are shared by every run
+    _impl->aux_mem_req = _impl->kernel->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weight}, {ACL_SRC_2, bias}, {ACL_DST, output}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
 }
 
 Status NELinearLayer::validate(const ITensor *input, 
                               const ITensor *weight, 
                               const ITensor *bias, ITensor *output, const LinearLayerInfo& linear_info)
 {
-    ARM_COMPUTE_UNUSED(linear_info);
-    return cpu::CpuLinear::validate(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f);
+    return cpu::CpuLinear::validate(input->info(), weight->info(), (bias != nullptr) ? bias->info() : nullptr,
+                                    output->info(), 1.0f, 1.0f, linear_info);
+}
+
+void NELinearLayer::set_weights_source(std::vector<const ITensor *> sources, std::function<void()> fill)
+{
+    ARM_COMPUTE_ERROR_ON(_impl->is_prepared);
+    ARM_COMPUTE_ERROR_ON(sources.empty() || !fill);
+    _impl->weight_sources = std::move(sources);
+    _impl->fill_weights   = std::move(fill);
 }
 
 void NELinearLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
-    ITensorPack pack;
-
-    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
-    pack.add_tensor(TensorType::ACL_SRC_1, _impl->weight);
-    pack.add_tensor(TensorType::ACL_SRC_2, _impl->bias);
-    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
-    
-    _impl->kernel->run(pack);
-
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NELinearLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    prepare();
 
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->kernel->run(_impl->run_pack);
+
+}
+
+void NELinearLayer::prepare()
+{
+    if(!_impl->is_prepared)
+    {
+        IWeightsManager    *wm    = _impl->weights_manager;
+        PackedWeightsCache *cache = (wm != nullptr) ? wm->packed_weights_cache() : nullptr;
+
+        // Weights filled on demand are only materialized when they have to be reshaped
+        const std::vector<const ITensor *> sources =
+            _impl->weight_sources.empty() ? std::vector<const ITensor *>{ _impl->weight } : _impl->weight_sources;
+        const auto reshape = [&]()
+        {
+            if(_impl->fill_weights)
+            {
+                _impl->fill_weights();
+            }
+            _impl->kernel->prepare(_impl->run_pack);
+        };
+        if(wm != nullptr && !_impl->kernel->packed_weights_key().empty())
+        {
+            // The reshaped weights are the persistent part of the workspace
+            std::vector<Tensor *>        packed;
+            std::vector<const ITensor *> packed_to_share;
+            for(auto &ws : _impl->workspace)
+            {
+                if(ws.lifetime == MemoryLifetime::Persistent)
+                {
+                    packed.push_back(ws.tensor.get());
+                    packed_to_share.push_back(ws.tensor.get());
+                }
+            }
+
+            // Functions of this manager reading the same weights memory, e.g. the sequence length buckets of a model,
+            // reuse the reshaped copy of the first one prepared
+            std::stringstream shared_key;
+            shared_key << _impl->kernel->packed_weights_key();
+            for(const ITensor *source : sources)
+            {
+                shared_key << "@" << static_cast<const void *>(source->buffer() + source->info()->offset_first_element_in_bytes());
+            }
+            if(import_packed_weights(wm->find_packed_weights(shared_key.str()), packed))
+            {
+                _impl->kernel->prepare_from_packed(_impl->run_pack);
+            }
+            else
+            {
+                std::stringstream key;
+                if(cache != nullptr)
+                {
+                    key << _impl->kernel->packed_weights_key() << "/" << std::hex << PackedWeightsCache::fingerprint(sources);
+                    _impl->packed_weights = cache->load(key.str(), packed);
+                }
+                if(_impl->packed_weights != nullptr)
+                {
+                    _impl->kernel->prepare_from_packed(_impl->run_pack);
+                }
+                else
+                {
+                    reshape();
+                    if(cache != nullptr)
+                    {
+                        cache->store(key.str(), packed_to_share);
+                    }
+                }
+                wm->register_packed_weights(shared_key.str(), packed_to_share);
+            }
+        }
+        else
+        {
+            reshape();
+        }
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
+
+        // Handle weights managed infrastructure
+        if(_impl->weights_manager != nullptr && _impl->weights_manager->are_weights_managed(_impl->weight))
+        {
+            // Ensure the weights only get released once the last function sharing them has finished its prepare
+            if(!_impl->weight->is_used())
+            {
+                _impl->weights_manager->pre_mark_as_unused(_impl->weight);
+            }
+            _impl->weight->mark_as_used();
+            _impl->weights_manager->release(_impl->weight);
+        }
+    }
 }
 
 } // namespace arm_compute
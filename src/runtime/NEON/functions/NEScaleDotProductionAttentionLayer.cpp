@@ -1,15 +1,11 @@
 #include "arm_compute/runtime/NEON/functions/NEScaleDotProductionAttentionLayer.h"
 
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuScaleDotProduction.h"
 #include "src/cpu/operators/CpuGemm.h"
 
-#ifdef MEASURE_TIME
-#include <chrono>
-#include <fstream>
-#endif
-
 namespace arm_compute
 {
 
@@ -19,6 +15,7 @@ struct NEScaleDotProductionAttentionLayer::Impl
     MemoryGroup                         memory_group{};
 
     ITensorPack                         scale_dot_pack{};
+    WorkspaceData<Tensor>               workspace{};
 
     IRuntimeContext                    *ctx{nullptr};
 
@@ -36,9 +33,10 @@ struct NEScaleDotProductionAttentionLayer::Recurrence
     ITensor     *output{nullptr};
 };
 
-NEScaleDotProductionAttentionLayer::NEScaleDotProductionAttentionLayer()
+NEScaleDotProductionAttentionLayer::NEScaleDotProductionAttentionLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _impl(std::make_unique<Impl>()), _recurrence(std::make_unique<Recurrence>())
 {
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
 }
 
 NEScaleDotProductionAttentionLayer::~NEScaleDotProductionAttentionLayer() = default;
@@ -48,46 +46,38 @@ void NEScaleDotProductionAttentionLayer::configure(ITensor *query,
                                                    ITensor *value,
                                                    ITensor *output,
                                                    const ScaleDotProductionLayerInfo& info,
-                                                   int recurrence_count)
+                                                   int recurrence_count,
+                                                   ITensor *key_cache,
+                                                   ITensor *value_cache,
+                                                   ITensor *lengths)
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
     std::cout << "NEScaleDotProductionAttentionLayer::configure recurrence count: " << recurrence_count << std::endl;
     /* Scale dot production of key and query */
     _impl->scale_dot_production_op  = std::make_unique<cpu::CpuScaleDotProduction>();
-    _impl->scale_dot_production_op->configure(query->info(),key->info(),value->info(),output->info(),info,recurrence_count);
+    _impl->scale_dot_production_op->configure(query->info(),key->info(),value->info(),output->info(),info,recurrence_count,
+                                              key_cache != nullptr ? key_cache->info() : nullptr,
+                                              value_cache != nullptr ? value_cache->info() : nullptr,
+                                              lengths != nullptr ? lengths->info() : nullptr);
     _impl->scale_dot_pack = {{ACL_SRC_0, query}, {ACL_SRC_1, key}, {ACL_SRC_2, value}, {ACL_DST, output}};
-
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NEScaleDotProductionAttentionLayer::configure cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
+    if(key_cache != nullptr)
+    {
+        _impl->scale_dot_pack.add_tensor(ACL_SRC_3, key_cache);
+        _impl->scale_dot_pack.add_tensor(ACL_SRC_4, value_cache);
+    }
+    if(lengths != nullptr)
+    {
+        _impl->scale_dot_pack.add_tensor(ACL_SRC_5, lengths);
+    }
+
+    // Intermediates of the unfused path, the fused kernels need none
+    _impl->workspace = manage_workspace<Tensor>(_impl->scale_dot_production_op->workspace(), _impl->memory_group, _impl->scale_dot_pack);
 
 }
 
 void NEScaleDotProductionAttentionLayer::run()
 {
-#ifdef MEASURE_TIME
-    auto start_time = std::chrono::high_resolution_clock::now();
-#endif
-
-    ITensorPack pack;
-
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
     _impl->scale_dot_production_op->run(_impl->scale_dot_pack);
-    
-#ifdef MEASURE_TIME
-    auto   end_time  = std::chrono::high_resolution_clock::now();
-    double cost_time = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
-    std::ofstream measure_out("measure_output.txt",std::ios::app);
-    measure_out.precision(5);
-    measure_out << std::scientific << "NEScaleDotProductionAttentionLayer::run cost: " << cost_time << std::endl;
-    measure_out.close();
-#endif
 
 }
 
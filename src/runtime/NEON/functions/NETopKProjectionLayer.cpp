@@ -0,0 +1,66 @@
+#include "arm_compute/runtime/NEON/functions/NETopKProjectionLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuTopKProjection.h"
+
+namespace arm_compute
+{
+
+using namespace arm_compute::experimental;
+
+struct NETopKProjectionLayer::Impl
+{
+    MemoryGroup                             memory_group{};
+    std::unique_ptr<cpu::CpuTopKProjection> op{nullptr};
+
+    ITensorPack                      run_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    experimental::MemoryRequirements aux_mem_req{};
+};
+
+NETopKProjectionLayer::NETopKProjectionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+NETopKProjectionLayer::~NETopKProjectionLayer() = default;
+
+void NETopKProjectionLayer::configure(const ITensor                 *input,
+                                      const ITensor                 *weights,
+                                      const ITensor                 *bias,
+                                      ITensor                       *output,
+                                      const TopKProjectionLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_LOG_PARAMS(input, weights, bias, output);
+
+    _impl->op = std::make_unique<cpu::CpuTopKProjection>();
+    _impl->op->configure(input->info(), weights->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(),
+                         info);
+
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, bias}, {ACL_DST, output}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack);
+}
+
+Status NETopKProjectionLayer::validate(const ITensorInfo             *input,
+                                       const ITensorInfo             *weights,
+                                       const ITensorInfo             *bias,
+                                       const ITensorInfo             *output,
+                                       const TopKProjectionLayerInfo &info)
+{
+    return cpu::CpuTopKProjection::validate(input, weights, bias, output, info);
+}
+
+void NETopKProjectionLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+} // namespace arm_compute
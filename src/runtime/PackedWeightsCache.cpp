@@ -0,0 +1,237 @@
+#include "arm_compute/runtime/PackedWeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include "arm_compute/core/utils/misc/MMappedFile.h"
+
+#include <unistd.h>
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr char     blob_magic[8]    = {'A', 'C', 'L', 'P', 'W', 'C', '0', '1'};
+constexpr size_t   blob_alignment   = 4096;
+constexpr uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+constexpr uint64_t fnv_prime        = 0x100000001b3ULL;
+
+uint64_t fnv1a(uint64_t hash, const uint8_t *data, size_t size)
+{
+    // Hash whole words, the tail byte by byte
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * fnv_prime;
+    }
+    for(; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * fnv_prime;
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t fnv1a(uint64_t hash, const T &value)
+{
+    return fnv1a(hash, reinterpret_cast<const uint8_t *>(&value), sizeof(T));
+}
+
+size_t align_blob(size_t size)
+{
+    return ((size + blob_alignment - 1) / blob_alignment) * blob_alignment;
+}
+
+/** Size of the header: magic, key length, key, number of buffers and their sizes */
+size_t header_size(const std::string &key, size_t num_buffers)
+{
+    return align_blob(sizeof(blob_magic) + sizeof(uint64_t) + key.size() + sizeof(uint64_t) * (1 + num_buffers));
+}
+} // namespace
+
+PackedWeightsCache::PackedWeightsCache(std::string directory) : _directory(std::move(directory))
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_directory.empty(), "The packed weights cache needs a directory");
+}
+
+uint64_t PackedWeightsCache::fingerprint(const ITensor &weights)
+{
+    return fingerprint(std::vector<const ITensor *>{ &weights });
+}
+
+uint64_t PackedWeightsCache::fingerprint(const std::vector<const ITensor *> &weights)
+{
+    ARM_COMPUTE_ERROR_ON(weights.empty());
+
+    // Shape of the concatenation along Y
+    TensorShape shape = weights[0]->info()->tensor_shape();
+    for(size_t i = 1; i < weights.size(); ++i)
+    {
+        shape.set(1, shape[1] + weights[i]->info()->dimension(1));
+    }
+
+    uint64_t hash = fnv1a(fnv_offset_basis, weights[0]->info()->data_type());
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        hash = fnv1a(hash, static_cast<uint64_t>(shape[d]));
+    }
+
+    // Every row, so weights differing anywhere never share a blob. Rows are hashed one by one to skip the padding
+    for(const ITensor *tensor : weights)
+    {
+        ARM_COMPUTE_ERROR_ON(tensor->buffer() == nullptr);
+        const ITensorInfo *info      = tensor->info();
+        const size_t       row_bytes = info->dimension(0) * info->element_size();
+        Window             win;
+        win.use_tensor_dimensions(info->tensor_shape());
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        Iterator row(tensor, win);
+        execute_window_loop(
+            win, [&](const Coordinates &) { hash = fnv1a(hash, row.ptr(), row_bytes); }, row);
+    }
+    return hash;
+}
+
+PackedWeightsCache::Mapping PackedWeightsCache::load(const std::string &key, const std::vector<Tensor *> &buffers) const
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    const std::string file = path(key);
+    std::ifstream     header(file, std::ios::binary);
+    if(!header.good())
+    {
+        return nullptr;
+    }
+
+    char     magic[sizeof(blob_magic)];
+    uint64_t key_size = 0;
+    header.read(magic, sizeof(magic));
+    header.read(reinterpret_cast<char *>(&key_size), sizeof(key_size));
+    if(!header.good() || std::memcmp(magic, blob_magic, sizeof(blob_magic)) != 0 || key_size != key.size())
+    {
+        return nullptr;
+    }
+
+    std::string stored_key(key_size, '\0');
+    uint64_t    num_buffers = 0;
+    header.read(&stored_key[0], key_size);
+    header.read(reinterpret_cast<char *>(&num_buffers), sizeof(num_buffers));
+    if(!header.good() || stored_key != key || num_buffers != buffers.size())
+    {
+        return nullptr;
+    }
+
+    std::vector<size_t> offsets;
+    size_t              offset = header_size(key, buffers.size());
+    for(Tensor *buffer : buffers)
+    {
+        uint64_t size = 0;
+        header.read(reinterpret_cast<char *>(&size), sizeof(size));
+        const size_t alignment = buffer->allocator()->alignment();
+        if(!header.good() || size != buffer->info()->total_size() || (alignment != 0 && blob_alignment % alignment != 0))
+        {
+            return nullptr;
+        }
+        offsets.push_back(offset);
+        offset += align_blob(size);
+    }
+    header.close();
+
+    // Pages of a private mapping are only copied if written to, the kernels never write to their weights
+    auto mapping = std::make_shared<utils::mmap_io::MMappedFile>(file, offset, 0, true);
+    if(!mapping->is_mapped() || mapping->map_size() < offset)
+    {
+        return nullptr;
+    }
+
+    std::vector<bool> was_allocated;
+    for(Tensor *buffer : buffers)
+    {
+        was_allocated.push_back(buffer->buffer() != nullptr);
+    }
+    for(size_t i = 0; i < buffers.size(); ++i)
+    {
+        if(!bool(buffers[i]->allocator()->import_memory(mapping->data() + offsets[i])))
+        {
+            // Give the imported buffers their own memory back before the blob is unmapped
+            for(size_t j = 0; j < i; ++j)
+            {
+                buffers[j]->allocator()->free();
+                if(was_allocated[j])
+                {
+                    buffers[j]->allocator()->allocate();
+                }
+            }
+            return nullptr;
+        }
+    }
+    return mapping;
+#else  /* !defined(_WIN64) && !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(key, buffers);
+    return nullptr;
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+}
+
+void PackedWeightsCache::store(const std::string &key, const std::vector<const ITensor *> &buffers) const
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    const std::string file = path(key);
+    const std::string tmp  = file + ".tmp" + std::to_string(getpid());
+    std::ofstream     blob(tmp, std::ios::binary | std::ios::trunc);
+    if(!blob.good())
+    {
+        return;
+    }
+
+    const uint64_t key_size    = key.size();
+    const uint64_t num_buffers = buffers.size();
+    blob.write(blob_magic, sizeof(blob_magic));
+    blob.write(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+    blob.write(key.data(), key.size());
+    blob.write(reinterpret_cast<const char *>(&num_buffers), sizeof(num_buffers));
+    for(const ITensor *buffer : buffers)
+    {
+        const uint64_t size = buffer->info()->total_size();
+        blob.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    }
+
+    // Every buffer starts on its own page
+    const std::vector<char> padding(blob_alignment, 0);
+    const size_t            offset = header_size(key, buffers.size());
+    blob.write(padding.data(), offset - static_cast<size_t>(blob.tellp()));
+    for(const ITensor *buffer : buffers)
+    {
+        const size_t size = buffer->info()->total_size();
+        blob.write(reinterpret_cast<const char *>(buffer->buffer() + buffer->info()->offset_first_element_in_bytes()), size);
+        blob.write(padding.data(), align_blob(size) - size);
+    }
+    blob.close();
+
+    // Publish whole blobs only
+    if(!blob.good() || std::rename(tmp.c_str(), file.c_str()) != 0)
+    {
+        std::remove(tmp.c_str());
+    }
+#else  /* !defined(_WIN64) && !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(key, buffers);
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+}
+
+std::string PackedWeightsCache::path(const std::string &key) const
+{
+    std::stringstream ss;
+    ss << _directory << "/" << std::hex << std::setw(16) << std::setfill('0')
+       << fnv1a(fnv_offset_basis, reinterpret_cast<const uint8_t *>(key.data()), key.size()) << ".pack";
+    return ss.str();
+}
+} // namespace arm_compute
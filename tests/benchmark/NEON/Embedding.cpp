@@ -0,0 +1,43 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingSumLayer.h"
+#include "arm_compute/runtime/NEON/functions/NETokenEmbeddingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/EmbeddingFixture.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types  = framework::dataset::make("DataType", { DataType::F32 });
+const auto num_threads = framework::dataset::make("NumThreads", { 1U, 2U, 4U });
+/** BERT uncased and GPT-2 vocabulary sizes */
+const auto vocab_sizes = framework::dataset::make("VocabSize", { 30522U, 50257U });
+} // namespace
+
+using NETokenEmbeddingFixture = TokenEmbeddingFixture<Tensor, NETokenEmbeddingLayer, Accessor>;
+using NEEmbeddingSumFixture   = EmbeddingSumFixture<Tensor, NEEmbeddingSumLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(TokenEmbeddingLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NETokenEmbeddingFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), vocab_sizes, data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NETokenEmbeddingFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), vocab_sizes, data_types, num_threads));
+TEST_SUITE_END() // TokenEmbeddingLayer
+
+TEST_SUITE(EmbeddingSumLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NEEmbeddingSumFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NEEmbeddingSumFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), data_types, num_threads));
+TEST_SUITE_END() // EmbeddingSumLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,34 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELayerNormLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/LayerNormFixture.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types  = framework::dataset::make("DataType", { DataType::F32 });
+const auto num_threads = framework::dataset::make("NumThreads", { 1U, 2U, 4U });
+} // namespace
+
+using NELayerNormFixture = LayerNormFixture<Tensor, NELayerNormLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(LayerNorm)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NELayerNormFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NELayerNormFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), data_types, num_threads));
+TEST_SUITE_END() // LayerNorm
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
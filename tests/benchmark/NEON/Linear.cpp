@@ -0,0 +1,46 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEAttentionLinearLayer.h"
+#include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/LinearLayerFixture.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types  = framework::dataset::make("DataType", { DataType::F32 });
+const auto num_threads = framework::dataset::make("NumThreads", { 1U, 2U, 4U });
+/** Attention output projection and feed-forward expansion */
+const auto expansions = framework::dataset::make("Expansion", { 1U, 4U });
+const auto fuse_qkv   = framework::dataset::make("FuseQKV", { false, true });
+/** Float GEMMs against int8 GEMMs on dynamically quantized inputs and weights */
+const auto dynamic_int8 = framework::dataset::make("DynamicInt8", { false, true });
+} // namespace
+
+using NELinearLayerFixture          = LinearLayerFixture<Tensor, NELinearLayer, Accessor>;
+using NEAttentionLinearLayerFixture = AttentionLinearLayerFixture<Tensor, NEAttentionLinearLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(LinearLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NELinearLayerFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), expansions, dynamic_int8, data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NELinearLayerFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), expansions, dynamic_int8, data_types, num_threads));
+TEST_SUITE_END() // LinearLayer
+
+TEST_SUITE(AttentionLinearLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NEAttentionLinearLayerFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), fuse_qkv, dynamic_int8, data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NEAttentionLinearLayerFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), fuse_qkv, dynamic_int8, data_types, num_threads));
+TEST_SUITE_END() // AttentionLinearLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
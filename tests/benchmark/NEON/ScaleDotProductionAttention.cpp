@@ -0,0 +1,36 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEScaleDotProductionAttentionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/ScaleDotProductionAttentionFixture.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types  = framework::dataset::make("DataType", { DataType::F32 });
+const auto num_threads = framework::dataset::make("NumThreads", { 1U, 2U, 4U });
+/** Encoder and causal decoder attention */
+const auto is_masked = framework::dataset::make("IsMasked", { false, true });
+} // namespace
+
+using NEScaleDotProductionAttentionFixture = ScaleDotProductionAttentionFixture<Tensor, NEScaleDotProductionAttentionLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ScaleDotProductionAttentionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunBERT, NEScaleDotProductionAttentionFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::BERTTransformerDataset(), is_masked, data_types, num_threads));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLongBERT, NEScaleDotProductionAttentionFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LongBERTTransformerDataset(), is_masked, data_types, num_threads));
+TEST_SUITE_END() // ScaleDotProductionAttentionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
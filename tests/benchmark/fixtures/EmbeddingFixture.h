@@ -0,0 +1,141 @@
+#ifndef ARM_COMPUTE_TEST_EMBEDDINGFIXTURE
+#define ARM_COMPUTE_TEST_EMBEDDINGFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for Neon, gathers seq_len rows of a d_vocab vocabulary on @p num_threads CPU threads */
+template <typename TensorType, typename Function, typename Accessor>
+class TokenEmbeddingFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int d_vocab, DataType data_type, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        // Create tensors
+        ids   = create_tensor<TensorType>(TensorShape(seq_len), DataType::U32);
+        vocab = create_tensor<TensorType>(TensorShape(d_model, d_vocab), data_type);
+        dst   = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+
+        embedding.configure(&ids, &vocab, &dst, EmbeddingLayerInfo(d_model, d_vocab));
+
+        ARM_COMPUTE_ASSERT(ids.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        ids.allocator()->allocate();
+        vocab.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(ids), 0, 0U, d_vocab - 1);
+        library->fill_tensor_uniform(Accessor(vocab), 1, -1.f, 1.f);
+    }
+
+    void run()
+    {
+        embedding.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        ids.allocator()->free();
+        vocab.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   ids{};
+    TensorType   vocab{};
+    TensorType   dst{};
+    Function     embedding{};
+    unsigned int _num_threads{ 0 };
+};
+
+/** Fixture that can be used for Neon, sums the token, segment and position embeddings on @p num_threads CPU threads */
+template <typename TensorType, typename Function, typename Accessor>
+class EmbeddingSumFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, DataType data_type, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        const TensorShape shape(d_model, seq_len);
+
+        // Create tensors
+        token    = create_tensor<TensorType>(shape, data_type);
+        segment  = create_tensor<TensorType>(shape, data_type);
+        position = create_tensor<TensorType>(shape, data_type);
+        dst      = create_tensor<TensorType>(shape, data_type);
+
+        embedding_sum.configure(&token, &segment, &position, &dst, EmbeddingLayerInfo(d_model));
+
+        ARM_COMPUTE_ASSERT(token.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        token.allocator()->allocate();
+        segment.allocator()->allocate();
+        position.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(token), 0, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(segment), 1, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(position), 2, -1.f, 1.f);
+    }
+
+    void run()
+    {
+        embedding_sum.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        token.allocator()->free();
+        segment.allocator()->free();
+        position.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   token{};
+    TensorType   segment{};
+    TensorType   position{};
+    TensorType   dst{};
+    Function     embedding_sum{};
+    unsigned int _num_threads{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_EMBEDDINGFIXTURE */
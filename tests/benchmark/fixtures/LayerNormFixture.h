@@ -0,0 +1,82 @@
+#ifndef ARM_COMPUTE_TEST_LAYERNORMFIXTURE
+#define ARM_COMPUTE_TEST_LAYERNORMFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for Neon, runs on @p num_threads CPU threads */
+template <typename TensorType, typename Function, typename Accessor>
+class LayerNormFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, DataType data_type, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        // Create tensors
+        src   = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+        gamma = create_tensor<TensorType>(TensorShape(d_model), data_type);
+        beta  = create_tensor<TensorType>(TensorShape(d_model), data_type);
+        dst   = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+
+        layer_norm.configure(&src, &gamma, &beta, &dst, LayerNormLayerInfo(0 /*Window::DimX*/, 1e-12f));
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(gamma), 1, 0.5f, 1.5f);
+        library->fill_tensor_uniform(Accessor(beta), 2, -0.5f, 0.5f);
+    }
+
+    void run()
+    {
+        layer_norm.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        gamma.allocator()->free();
+        beta.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   src{};
+    TensorType   gamma{};
+    TensorType   beta{};
+    TensorType   dst{};
+    Function     layer_norm{};
+    unsigned int _num_threads{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LAYERNORMFIXTURE */
@@ -0,0 +1,176 @@
+#ifndef ARM_COMPUTE_TEST_LINEARLAYERFIXTURE
+#define ARM_COMPUTE_TEST_LINEARLAYERFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for Neon, projects d_model to expansion * d_model features on @p num_threads CPU threads
+ *
+ * The weights are reshaped by a first run in setup, so only the steady state is measured. With @p dynamic_int8 the
+ * projection runs as a dynamically quantized int8 GEMM, to be compared against the float run of the same sizes.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class LinearLayerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, bool dynamic_int8, DataType data_type, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        const unsigned int d_out = d_model * expansion;
+
+        // Create tensors
+        src     = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+        weights = create_tensor<TensorType>(TensorShape(d_model, d_out), data_type);
+        bias    = create_tensor<TensorType>(TensorShape(d_out), data_type);
+        dst     = create_tensor<TensorType>(TensorShape(d_out, seq_len), data_type);
+
+        LinearLayerInfo info(d_out, weights.info()->tensor_shape(), bias.info()->tensor_shape());
+        info.set_dynamic_int8(dynamic_int8);
+        linear.configure(&src, &weights, &bias, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(weights), 1, -0.1f, 0.1f);
+        library->fill_tensor_uniform(Accessor(bias), 2, -0.1f, 0.1f);
+
+        linear.run();
+    }
+
+    void run()
+    {
+        linear.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        bias.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   src{};
+    TensorType   weights{};
+    TensorType   bias{};
+    TensorType   dst{};
+    Function     linear{};
+    unsigned int _num_threads{ 0 };
+};
+
+/** Fixture that can be used for Neon, runs the query, key and value projections of one input on @p num_threads CPU threads
+ *
+ * With @p dynamic_int8 the projections run as dynamically quantized int8 GEMMs.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class AttentionLinearLayerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, bool fuse_qkv, bool dynamic_int8, DataType data_type, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        const TensorShape io_shape(d_model, seq_len);
+        const TensorShape w_shape(d_model, d_model);
+        const TensorShape b_shape(d_model);
+
+        // Create tensors
+        src = create_tensor<TensorType>(io_shape, data_type);
+        for(unsigned int i = 0; i < 3; ++i)
+        {
+            weights[i] = create_tensor<TensorType>(w_shape, data_type);
+            bias[i]    = create_tensor<TensorType>(b_shape, data_type);
+            dst[i]     = create_tensor<TensorType>(io_shape, data_type);
+        }
+
+        LinearLayerInfo info(d_model, w_shape, b_shape, fuse_qkv);
+        info.set_dynamic_int8(dynamic_int8);
+        attention_linear.configure(&src, &weights[0], &bias[0], &src, &weights[1], &bias[1], &src, &weights[2], &bias[2],
+                                   &dst[0], &dst[1], &dst[2], info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+        for(unsigned int i = 0; i < 3; ++i)
+        {
+            weights[i].allocator()->allocate();
+            bias[i].allocator()->allocate();
+            dst[i].allocator()->allocate();
+            library->fill_tensor_uniform(Accessor(weights[i]), 1 + 2 * i, -0.1f, 0.1f);
+            library->fill_tensor_uniform(Accessor(bias[i]), 2 + 2 * i, -0.1f, 0.1f);
+        }
+
+        attention_linear.run();
+    }
+
+    void run()
+    {
+        attention_linear.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        for(auto &tensor : dst)
+        {
+            sync_tensor_if_necessary<TensorType>(tensor);
+        }
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        for(unsigned int i = 0; i < 3; ++i)
+        {
+            weights[i].allocator()->free();
+            bias[i].allocator()->free();
+            dst[i].allocator()->free();
+        }
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   src{};
+    TensorType   weights[3]{};
+    TensorType   bias[3]{};
+    TensorType   dst[3]{};
+    Function     attention_linear{};
+    unsigned int _num_threads{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LINEARLAYERFIXTURE */
@@ -0,0 +1,83 @@
+#ifndef ARM_COMPUTE_TEST_SCALEDOTPRODUCTIONATTENTIONFIXTURE
+#define ARM_COMPUTE_TEST_SCALEDOTPRODUCTIONATTENTIONFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for Neon, self-attention over seq_len rows on @p num_threads CPU threads */
+template <typename TensorType, typename Function, typename Accessor>
+class ScaleDotProductionAttentionFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, bool is_masked, DataType data_type, unsigned int num_threads)
+    {
+        _num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        const TensorShape shape(d_model, seq_len);
+
+        // Create tensors
+        query = create_tensor<TensorType>(shape, data_type);
+        key   = create_tensor<TensorType>(shape, data_type);
+        value = create_tensor<TensorType>(shape, data_type);
+        dst   = create_tensor<TensorType>(shape, data_type);
+
+        attention.configure(&query, &key, &value, &dst, ScaleDotProductionLayerInfo(d_model, heads, is_masked), 0);
+
+        ARM_COMPUTE_ASSERT(query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(query), 0, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(key), 1, -1.f, 1.f);
+        library->fill_tensor_uniform(Accessor(value), 2, -1.f, 1.f);
+    }
+
+    void run()
+    {
+        attention.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        query.allocator()->free();
+        key.allocator()->free();
+        value.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::get().set_num_threads(_num_threads);
+    }
+
+private:
+    TensorType   query{};
+    TensorType   key{};
+    TensorType   value{};
+    TensorType   dst{};
+    Function     attention{};
+    unsigned int _num_threads{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCALEDOTPRODUCTIONATTENTIONFIXTURE */
@@ -0,0 +1,148 @@
+#ifndef ACL_TESTS_DATASETS_TRANSFORMERDATASET
+#define ACL_TESTS_DATASETS_TRANSFORMERDATASET
+
+#include "utils/TypePrinter.h"
+
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace datasets
+{
+/** Sizes of a transformer layer: sequence length, model dimension and number of attention heads */
+class TransformerDataset
+{
+public:
+    using type = std::tuple<unsigned int, unsigned int, unsigned int>;
+
+    struct iterator
+    {
+        iterator(std::vector<unsigned int>::const_iterator seq_len_it,
+                 std::vector<unsigned int>::const_iterator d_model_it,
+                 std::vector<unsigned int>::const_iterator heads_it)
+            : _seq_len_it{ std::move(seq_len_it) },
+              _d_model_it{ std::move(d_model_it) },
+              _heads_it{ std::move(heads_it) }
+        {
+        }
+
+        std::string description() const
+        {
+            std::stringstream description;
+            description << "SeqLen=" << *_seq_len_it << ":";
+            description << "DModel=" << *_d_model_it << ":";
+            description << "Heads=" << *_heads_it << ":";
+            return description.str();
+        }
+
+        TransformerDataset::type operator*() const
+        {
+            return std::make_tuple(*_seq_len_it, *_d_model_it, *_heads_it);
+        }
+
+        iterator &operator++()
+        {
+            ++_seq_len_it;
+            ++_d_model_it;
+            ++_heads_it;
+
+            return *this;
+        }
+
+    private:
+        std::vector<unsigned int>::const_iterator _seq_len_it;
+        std::vector<unsigned int>::const_iterator _d_model_it;
+        std::vector<unsigned int>::const_iterator _heads_it;
+    };
+
+    iterator begin() const
+    {
+        return iterator(_seq_lens.begin(), _d_models.begin(), _heads.begin());
+    }
+
+    int size() const
+    {
+        return std::min(_seq_lens.size(), std::min(_d_models.size(), _heads.size()));
+    }
+
+    void add_config(unsigned int seq_len, unsigned int d_model, unsigned int heads)
+    {
+        _seq_lens.emplace_back(seq_len);
+        _d_models.emplace_back(d_model);
+        _heads.emplace_back(heads);
+    }
+
+protected:
+    TransformerDataset()                      = default;
+    TransformerDataset(TransformerDataset &&) = default;
+
+    /** Adds every sequence length for the BERT-base and BERT-large model sizes */
+    void add_bert_configs(std::initializer_list<unsigned int> seq_lens)
+    {
+        for(unsigned int seq_len : seq_lens)
+        {
+            add_config(seq_len, 768U, 12U);
+            add_config(seq_len, 1024U, 16U);
+        }
+    }
+
+private:
+    std::vector<unsigned int> _seq_lens{};
+    std::vector<unsigned int> _d_models{};
+    std::vector<unsigned int> _heads{};
+};
+
+/** Validation sizes, odd lengths and head dimensions reach the leftover loops of the kernels */
+class SmallTransformerDataset final : public TransformerDataset
+{
+public:
+    SmallTransformerDataset()
+    {
+        add_config(1U, 64U, 4U);
+        add_config(7U, 64U, 4U);
+        add_config(16U, 96U, 2U);
+        add_config(33U, 128U, 8U);
+        add_config(64U, 36U, 3U);
+    }
+};
+
+/** Single-row validation sizes, the decode steps of a generative model */
+class SmallDecodeTransformerDataset final : public TransformerDataset
+{
+public:
+    SmallDecodeTransformerDataset()
+    {
+        add_config(1U, 64U, 4U);
+        add_config(1U, 96U, 2U);
+        add_config(1U, 128U, 8U);
+        add_config(1U, 36U, 3U);
+    }
+};
+
+/** BERT sizes at the sequence lengths of a short prompt */
+class BERTTransformerDataset final : public TransformerDataset
+{
+public:
+    BERTTransformerDataset()
+    {
+        add_bert_configs({ 8U, 16U, 32U, 64U, 128U });
+    }
+};
+
+/** BERT sizes at long sequence lengths, up to the maximum position */
+class LongBERTTransformerDataset final : public TransformerDataset
+{
+public:
+    LongBERTTransformerDataset()
+    {
+        add_bert_configs({ 256U, 384U, 512U });
+    }
+};
+} // namespace datasets
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_DATASETS_TRANSFORMERDATASET */
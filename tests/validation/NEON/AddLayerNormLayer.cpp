@@ -0,0 +1,63 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEAddLayerNormLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/LayerNormLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Tolerance for float operations */
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+/** Tolerance for half operations, the sum is rounded to F16 before it is normalized */
+constexpr AbsoluteTolerance<float> tolerance_f16(0.01f);
+} // namespace
+
+template <typename T>
+using NEAddLayerNormLayerFixture = AddLayerNormLayerValidationFixture<Tensor, Accessor, NEAddLayerNormLayer, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(AddLayerNormLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAddLayerNormLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAddLayerNormLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // AddLayerNormLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,117 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingGatherSumLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingSumLayer.h"
+#include "arm_compute/runtime/NEON/functions/NETokenEmbeddingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/EmbeddingLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Tolerance for float operations */
+constexpr AbsoluteTolerance<float> tolerance_f32(0.00001f);
+/** Tolerance for half operations, the fused kernel accumulates the three rows in F16 */
+constexpr AbsoluteTolerance<float> tolerance_f16(0.01f);
+} // namespace
+
+template <typename T>
+using NETokenEmbeddingLayerFixture = TokenEmbeddingLayerValidationFixture<Tensor, Accessor, NETokenEmbeddingLayer, T>;
+template <typename T>
+using NEEmbeddingSumLayerFixture = EmbeddingSumLayerValidationFixture<Tensor, Accessor, NEEmbeddingSumLayer, T>;
+template <typename T>
+using NEEmbeddingGatherSumLayerFixture = EmbeddingGatherSumLayerValidationFixture<Tensor, Accessor, NEEmbeddingGatherSumLayer, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(TokenEmbeddingLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETokenEmbeddingLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("VocabSize", { 1U, 1000U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Gathered rows are copied exactly
+    validate(Accessor(_target), _reference);
+}
+TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETokenEmbeddingLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("VocabSize", { 1U, 1000U }),
+                       framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Gathered rows are copied exactly
+        validate(Accessor(_target), _reference);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // TokenEmbeddingLayer
+
+TEST_SUITE(EmbeddingSumLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingSumLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // EmbeddingSumLayer
+
+TEST_SUITE(EmbeddingGatherSumLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingGatherSumLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("VocabSize", { 1U, 1000U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingGatherSumLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("VocabSize", { 1U, 1000U }),
+                       framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // EmbeddingGatherSumLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,214 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEAttentionLinearLayer.h"
+#include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/LinearLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Tolerance for float operations */
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f);
+/** Tolerances for half operations, the GEMM accumulates in F16 */
+const RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.2));
+constexpr AbsoluteTolerance<float>        abs_tolerance_f16(0.2f);
+constexpr float                           tolerance_num_f16 = 0.02f;
+/** Tolerance for dynamically quantized int8 GEMMs against the float reference, inputs and weights keep 8 bits per row */
+constexpr AbsoluteTolerance<float> tolerance_int8(0.03f);
+/** Tolerance for 4-bit weights, the rounding error of every weight is up to a fourteenth of its group's largest one */
+constexpr AbsoluteTolerance<float> tolerance_int4(0.15f);
+/** Tolerance for BF16 GEMMs against the float reference, inputs and weights keep 8 bits of mantissa */
+constexpr AbsoluteTolerance<float> tolerance_bf16(0.02f);
+/** Tolerance for the tanh approximation of GELU against the erf based reference */
+constexpr AbsoluteTolerance<float> tolerance_approximate_gelu(0.002f);
+
+/** Activations fused into the output stage, the assembly kernels apply RELU and BOUNDED_RELU themselves */
+const auto FusedActivationDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU),
+});
+} // namespace
+
+template <typename T>
+using NELinearLayerFixture = LinearLayerValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NEAttentionLinearLayerFixture = AttentionLinearLayerValidationFixture<Tensor, Accessor, NEAttentionLinearLayer, T>;
+template <typename T>
+using NELinearLayerDynamicInt8Fixture = LinearLayerDynamicInt8ValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NELinearLayerActivationFixture = LinearLayerActivationValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NELinearLayerFastMathFixture = LinearLayerFastMathValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NELinearLayerWeightOnlyFixture = LinearLayerWeightOnlyValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NEAttentionLinearLayerDynamicInt8Fixture = AttentionLinearLayerDynamicInt8ValidationFixture<Tensor, Accessor, NEAttentionLinearLayer, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(LinearLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELinearLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(datasets::BERTTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE(FusedActivation)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerActivationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 4U }),
+                       FusedActivationDataset,
+                       framework::dataset::make("ApproximateGELU", false),
+                       framework::dataset::make("HasBias", { true, false }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunApproximateGELU, NELinearLayerActivationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 4U }),
+                       framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU)),
+                       framework::dataset::make("ApproximateGELU", true),
+                       framework::dataset::make("HasBias", { true, false }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_approximate_gelu);
+}
+TEST_SUITE_END() // FusedActivation
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerFastMathFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_bf16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELinearLayerFastMathFixture<float>, framework::DatasetMode::NIGHTLY, combine(datasets::BERTTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_bf16);
+}
+TEST_SUITE_END() // FastMath
+TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num_f16, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+TEST_SUITE(DynamicInt8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerDynamicInt8Fixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_int8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELinearLayerDynamicInt8Fixture<float>, framework::DatasetMode::NIGHTLY, combine(datasets::BERTTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_int8);
+}
+TEST_SUITE_END() // DynamicInt8
+TEST_SUITE(WeightOnly)
+FIXTURE_DATA_TEST_CASE(RunSmallInt8, NELinearLayerWeightOnlyFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallDecodeTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("Quantization", WeightOnlyQuantization::INT8),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_int8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallInt4, NELinearLayerWeightOnlyFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallDecodeTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U, 4U }),
+                       framework::dataset::make("Quantization", WeightOnlyQuantization::INT4),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_int4);
+}
+// Multi-row inputs fall back to the F32 GEMM
+FIXTURE_DATA_TEST_CASE(RunPrefill, NELinearLayerWeightOnlyFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("Expansion", { 1U }),
+                       framework::dataset::make("Quantization", WeightOnlyQuantization::INT4),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_int4);
+}
+TEST_SUITE_END() // WeightOnly
+TEST_SUITE_END() // LinearLayer
+
+TEST_SUITE(AttentionLinearLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAttentionLinearLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("FuseQKV", { false, true }),
+                       framework::dataset::make("HasBias", { true, false }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate query, key and value
+    for(int i = 0; i < 3; ++i)
+    {
+        validate(Accessor(_target[i]), _reference[i], tolerance_f32);
+    }
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+TEST_SUITE(DynamicInt8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAttentionLinearLayerDynamicInt8Fixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       framework::dataset::make("FuseQKV", { false, true }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate query, key and value
+    for(int i = 0; i < 3; ++i)
+    {
+        validate(Accessor(_target[i]), _reference[i], tolerance_int8);
+    }
+}
+TEST_SUITE_END() // DynamicInt8
+TEST_SUITE_END() // AttentionLinearLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,72 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NETopKProjectionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/TransformerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/TopKProjectionLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Tolerance for the scores, ids are whole numbers so any mismatch exceeds it */
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+/** Tolerance for half inputs, the scores are still accumulated in F32 */
+constexpr AbsoluteTolerance<float> tolerance_f16(0.001f);
+
+/** Vocabularies that fill a single partial block and several blocks with a partial last one */
+const auto VocabSizes = framework::dataset::make("VocabSize", { 300U, 1000U });
+} // namespace
+
+template <typename T>
+using NETopKProjectionLayerFixture = TopKProjectionLayerValidationFixture<Tensor, Accessor, NETopKProjectionLayer, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(TopKProjectionLayer)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKProjectionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       VocabSizes,
+                       framework::dataset::make("K", { 1U, 5U }),
+                       framework::dataset::make("ExplicitRows", { false, true }),
+                       framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate ids and scores
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKProjectionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallTransformerDataset(),
+                       VocabSizes,
+                       framework::dataset::make("K", { 1U, 5U }),
+                       framework::dataset::make("ExplicitRows", { false, true }),
+                       framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // TopKProjectionLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
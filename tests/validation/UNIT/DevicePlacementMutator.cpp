@@ -0,0 +1,107 @@
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/mutators/DevicePlacementMutator.h"
+#include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+
+namespace
+{
+constexpr unsigned int d_model = 64U;
+constexpr unsigned int seq_len = 8U;
+
+/** Adds a linear layer without accessors, placement never reads the weights */
+NodeIdxPair add_linear(Graph &g, const std::string &name, NodeIdxPair input)
+{
+    LinearLayerInfo info(d_model, TensorShape(d_model, d_model), TensorShape(d_model));
+    return { GraphBuilder::add_linear_node(g, { name, Target::NEON }, input, info), 0 };
+}
+
+/** Node of the given type, nullptr if the graph has none */
+const INode *find_node(Graph &g, NodeType type)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == type)
+        {
+            return node.get();
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(DevicePlacementMutator)
+
+/** Fused nodes keep the name of a node that had a CL function, so a table favouring CL for that name must not move them */
+TEST_CASE(FusedNodesStayOnNeon, framework::DatasetMode::ALL)
+{
+    Graph g(0, "placement");
+
+    std::vector<ITensorAccessorUPtr> accessors;
+    accessors.emplace_back(nullptr);
+    const NodeIdxPair input{ GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(d_model, seq_len), DataType::F32), accessors), 0 };
+
+    // Linear followed by GELU, fused into the linear layer
+    const NodeIdxPair ff = add_linear(g, "ff", input);
+    const NodeIdxPair act{ GraphBuilder::add_activation_node(g, { "ff_act", Target::NEON }, ff, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU)), 0 };
+
+    // Residual add followed by layer normalization, fused into an AddLayerNorm node
+    const NodeIdxPair add{ GraphBuilder::add_elementwise_node(g, { "residual", Target::NEON }, act, input, EltwiseOperation::Add, 0), 0 };
+    const NodeIdxPair norm{ GraphBuilder::add_layer_norm_node(g, { "norm", Target::NEON }, add, LayerNormLayerInfo()), 0 };
+
+    // Plain linear layer, free to move to CL
+    const NodeIdxPair proj = add_linear(g, "proj", norm);
+    GraphBuilder::add_output_node(g, { "output", Target::NEON }, proj);
+
+    NodeFusionMutator fusion;
+    fusion.mutate(g);
+    ARM_COMPUTE_EXPECT(find_node(g, NodeType::ActivationLayer) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_node(g, NodeType::AddLayerNormLayer) != nullptr, framework::LogLevel::ERRORS);
+
+    // Every compute node is much faster on CL and device boundaries are free
+    DeviceCostTable costs;
+    for(const char *name : { "ff", "ff_act", "residual", "norm", "residual+norm", "proj" })
+    {
+        costs.nodes[name] = { 1.0, 0.001 };
+    }
+    DevicePlacementMutator placement(costs);
+    placement.mutate(g);
+
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        if(node->type() == NodeType::AddLayerNormLayer || (node->type() == NodeType::LinearLayer && node->name() == "ff"))
+        {
+            ARM_COMPUTE_EXPECT(node->assigned_target() == Target::NEON, framework::LogLevel::ERRORS);
+        }
+        else if(node->type() == NodeType::LinearLayer && is_target_supported(Target::CL))
+        {
+            ARM_COMPUTE_EXPECT(node->assigned_target() == Target::CL, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE_END() // DevicePlacementMutator
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,190 @@
+#include "arm_compute/runtime/PackedWeightsCache.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <dirent.h>
+#include <unistd.h>
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+namespace
+{
+/** Empty directory removed with its blobs when the test ends */
+class ScopedDirectory
+{
+public:
+    ScopedDirectory()
+    {
+        char path[] = "/tmp/acl_packed_weights_XXXXXX";
+        const char *created = mkdtemp(path);
+        ARM_COMPUTE_ERROR_ON(created == nullptr);
+        ARM_COMPUTE_UNUSED(created);
+        _path = path;
+    }
+    ~ScopedDirectory()
+    {
+        if(DIR *dir = opendir(_path.c_str()))
+        {
+            while(dirent *entry = readdir(dir))
+            {
+                if(std::strcmp(entry->d_name, ".") != 0 && std::strcmp(entry->d_name, "..") != 0)
+                {
+                    std::remove((_path + "/" + entry->d_name).c_str());
+                }
+            }
+            closedir(dir);
+        }
+        rmdir(_path.c_str());
+    }
+    const std::string &path() const
+    {
+        return _path;
+    }
+
+private:
+    std::string _path{};
+};
+
+void init_buffer(Tensor &tensor, size_t size)
+{
+    tensor.allocator()->init(TensorInfo(TensorShape(size), 1, DataType::U8));
+}
+
+void fill_buffer(Tensor &tensor, uint8_t seed)
+{
+    tensor.allocator()->allocate();
+    for(size_t i = 0; i < tensor.info()->total_size(); ++i)
+    {
+        tensor.buffer()[i] = static_cast<uint8_t>(seed + i * 7);
+    }
+}
+
+void fill_weights(Tensor &weights)
+{
+    weights.allocator()->init(TensorInfo(TensorShape(8U, 1000U), 1, DataType::F32));
+    weights.allocator()->allocate();
+    auto *data = reinterpret_cast<float *>(weights.buffer());
+    for(size_t i = 0; i < weights.info()->tensor_shape().total_size(); ++i)
+    {
+        data[i] = static_cast<float>(i % 97) * 0.01f;
+    }
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(PackedWeightsCache)
+
+TEST_CASE(StoreAndLoad, framework::DatasetMode::ALL)
+{
+    ScopedDirectory    dir;
+    PackedWeightsCache cache(dir.path());
+
+    Tensor small, large;
+    init_buffer(small, 100);
+    init_buffer(large, 5000);
+    fill_buffer(small, 1);
+    fill_buffer(large, 2);
+    cache.store("linear/key", { &small, &large });
+
+    Tensor loaded_small, loaded_large;
+    init_buffer(loaded_small, 100);
+    init_buffer(loaded_large, 5000);
+    const PackedWeightsCache::Mapping mapping = cache.load("linear/key", { &loaded_small, &loaded_large });
+    ARM_COMPUTE_ASSERT(mapping != nullptr);
+    ARM_COMPUTE_EXPECT(std::memcmp(loaded_small.buffer(), small.buffer(), 100) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::memcmp(loaded_large.buffer(), large.buffer(), 5000) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectsMismatchingBlobs, framework::DatasetMode::ALL)
+{
+    ScopedDirectory    dir;
+    PackedWeightsCache cache(dir.path());
+
+    Tensor small, large;
+    init_buffer(small, 100);
+    init_buffer(large, 5000);
+    fill_buffer(small, 1);
+    fill_buffer(large, 2);
+    cache.store("linear/key", { &small, &large });
+
+    // Unknown key
+    Tensor other_small, other_large;
+    init_buffer(other_small, 100);
+    init_buffer(other_large, 5000);
+    ARM_COMPUTE_EXPECT(cache.load("linear/other", { &other_small, &other_large }) == nullptr, framework::LogLevel::ERRORS);
+
+    // Different buffer sizes
+    Tensor resized;
+    init_buffer(resized, 6000);
+    ARM_COMPUTE_EXPECT(cache.load("linear/key", { &other_small, &resized }) == nullptr, framework::LogLevel::ERRORS);
+
+    // Different number of buffers
+    ARM_COMPUTE_EXPECT(cache.load("linear/key", { &other_small }) == nullptr, framework::LogLevel::ERRORS);
+
+    // Rejected loads leave the buffers untouched
+    ARM_COMPUTE_EXPECT(other_small.buffer() == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(resized.buffer() == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FingerprintCoversEveryWeight, framework::DatasetMode::ALL)
+{
+    Tensor weights, same_weights;
+    fill_weights(weights);
+    fill_weights(same_weights);
+    const uint64_t fingerprint = PackedWeightsCache::fingerprint(weights);
+    ARM_COMPUTE_EXPECT(PackedWeightsCache::fingerprint(same_weights) == fingerprint, framework::LogLevel::ERRORS);
+
+    // A single weight changed in any row, as in a partially fine-tuned checkpoint
+    for(size_t row : { 0U, 1U, 500U, 999U })
+    {
+        auto *data = reinterpret_cast<float *>(same_weights.buffer()) + row * 8U + 3U;
+        const float original = *data;
+        *data += 1.f;
+        ARM_COMPUTE_EXPECT(PackedWeightsCache::fingerprint(same_weights) != fingerprint, framework::LogLevel::ERRORS);
+        *data = original;
+    }
+}
+
+/** The fused QKV projection fingerprints its weights without concatenating them */
+TEST_CASE(FingerprintOfConcatenation, framework::DatasetMode::ALL)
+{
+    Tensor weights;
+    fill_weights(weights);
+
+    // Split the 1000 rows along Y
+    Tensor       parts[3];
+    const size_t rows[3] = { 300U, 500U, 200U };
+    const auto  *data    = reinterpret_cast<const float *>(weights.buffer());
+    for(size_t i = 0; i < 3; ++i)
+    {
+        parts[i].allocator()->init(TensorInfo(TensorShape(8U, rows[i]), 1, DataType::F32));
+        parts[i].allocator()->allocate();
+        std::memcpy(parts[i].buffer(), data, rows[i] * 8U * sizeof(float));
+        data += rows[i] * 8U;
+    }
+
+    const uint64_t fingerprint = PackedWeightsCache::fingerprint({ &parts[0], &parts[1], &parts[2] });
+    ARM_COMPUTE_EXPECT(fingerprint == PackedWeightsCache::fingerprint(weights), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(fingerprint != PackedWeightsCache::fingerprint({ &parts[1], &parts[0], &parts[2] }), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // PackedWeightsCache
+TEST_SUITE_END() // UNIT
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
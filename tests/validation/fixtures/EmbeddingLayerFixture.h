@@ -0,0 +1,260 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/EmbeddingLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class TokenEmbeddingLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int d_vocab, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _target    = compute_target(seq_len, d_model, d_vocab, data_type);
+        _reference = compute_reference(seq_len, d_model, d_vocab, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill_ids(U &&tensor, unsigned int d_vocab)
+    {
+        std::uniform_int_distribution<uint32_t> distribution{ 0U, d_vocab - 1 };
+        library->fill(tensor, distribution, 0);
+    }
+
+    template <typename U>
+    void fill_vocab(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 1, -1.f, 1.f);
+    }
+
+    TensorType compute_target(unsigned int seq_len, unsigned int d_model, unsigned int d_vocab, DataType data_type)
+    {
+        // Create tensors
+        TensorType ids   = create_tensor<TensorType>(TensorShape(seq_len), DataType::U32);
+        TensorType vocab = create_tensor<TensorType>(TensorShape(d_model, d_vocab), data_type);
+        TensorType dst   = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+
+        // Create and configure function
+        FunctionType embedding;
+        embedding.configure(&ids, &vocab, &dst, EmbeddingLayerInfo(d_model, d_vocab));
+
+        ARM_COMPUTE_ASSERT(ids.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        ids.allocator()->allocate();
+        vocab.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill_ids(AccessorType(ids), d_vocab);
+        fill_vocab(AccessorType(vocab));
+
+        // Compute function
+        embedding.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(unsigned int seq_len, unsigned int d_model, unsigned int d_vocab, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<uint32_t> ids{ TensorShape(seq_len), DataType::U32 };
+        SimpleTensor<T>        vocab{ TensorShape(d_model, d_vocab), data_type };
+
+        // Fill reference
+        fill_ids(ids, d_vocab);
+        fill_vocab(vocab);
+
+        return reference::token_embedding(ids, vocab);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class EmbeddingSumLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        const TensorShape shape(d_model, seq_len);
+        _target    = compute_target(shape, data_type);
+        _reference = compute_reference(shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+    }
+
+    TensorType compute_target(const TensorShape &shape, DataType data_type)
+    {
+        // Create tensors
+        TensorType token    = create_tensor<TensorType>(shape, data_type);
+        TensorType segment  = create_tensor<TensorType>(shape, data_type);
+        TensorType position = create_tensor<TensorType>(shape, data_type);
+        TensorType dst      = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType embedding_sum;
+        embedding_sum.configure(&token, &segment, &position, &dst, EmbeddingLayerInfo(shape.x()));
+
+        ARM_COMPUTE_ASSERT(token.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        token.allocator()->allocate();
+        segment.allocator()->allocate();
+        position.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(token), 0);
+        fill(AccessorType(segment), 1);
+        fill(AccessorType(position), 2);
+
+        // Compute function
+        embedding_sum.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> token{ shape, data_type };
+        SimpleTensor<T> segment{ shape, data_type };
+        SimpleTensor<T> position{ shape, data_type };
+
+        // Fill reference
+        fill(token, 0);
+        fill(segment, 1);
+        fill(position, 2);
+
+        return reference::embedding_sum(token, segment, position);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class EmbeddingGatherSumLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int d_vocab, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        _target    = compute_target(seq_len, d_model, d_vocab, data_type);
+        _reference = compute_reference(seq_len, d_model, d_vocab, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill_ids(U &&tensor, unsigned int range, int i)
+    {
+        std::uniform_int_distribution<uint32_t> distribution{ 0U, range - 1 };
+        library->fill(tensor, distribution, i);
+    }
+
+    template <typename U>
+    void fill_table(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+    }
+
+    TensorType compute_target(unsigned int seq_len, unsigned int d_model, unsigned int d_vocab, DataType data_type)
+    {
+        // Create tensors
+        TensorType tokens         = create_tensor<TensorType>(TensorShape(seq_len), DataType::U32);
+        TensorType segments       = create_tensor<TensorType>(TensorShape(seq_len), DataType::U32);
+        TensorType vocab          = create_tensor<TensorType>(TensorShape(d_model, d_vocab), data_type);
+        TensorType segment_table  = create_tensor<TensorType>(TensorShape(d_model, _d_segment), data_type);
+        TensorType position_table = create_tensor<TensorType>(TensorShape(d_model, _d_position), data_type);
+        TensorType dst            = create_tensor<TensorType>(TensorShape(d_model, seq_len), data_type);
+
+        // Create and configure function
+        FunctionType embedding;
+        embedding.configure(&tokens, &segments, &vocab, &segment_table, &position_table, &dst,
+                            EmbeddingLayerInfo(d_model, d_vocab, _d_segment, _d_position));
+
+        ARM_COMPUTE_ASSERT(tokens.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        tokens.allocator()->allocate();
+        segments.allocator()->allocate();
+        vocab.allocator()->allocate();
+        segment_table.allocator()->allocate();
+        position_table.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill_ids(AccessorType(tokens), d_vocab, 0);
+        fill_ids(AccessorType(segments), _d_segment, 1);
+        fill_table(AccessorType(vocab), 2);
+        fill_table(AccessorType(segment_table), 3);
+        fill_table(AccessorType(position_table), 4);
+
+        // Compute function
+        embedding.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(unsigned int seq_len, unsigned int d_model, unsigned int d_vocab, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<uint32_t> tokens{ TensorShape(seq_len), DataType::U32 };
+        SimpleTensor<uint32_t> segments{ TensorShape(seq_len), DataType::U32 };
+        SimpleTensor<uint32_t> positions{ TensorShape(seq_len), DataType::U32 };
+        SimpleTensor<T>        vocab{ TensorShape(d_model, d_vocab), data_type };
+        SimpleTensor<T>        segment_table{ TensorShape(d_model, _d_segment), data_type };
+        SimpleTensor<T>        position_table{ TensorShape(d_model, _d_position), data_type };
+
+        // Fill reference
+        fill_ids(tokens, d_vocab, 0);
+        fill_ids(segments, _d_segment, 1);
+        fill_table(vocab, 2);
+        fill_table(segment_table, 3);
+        fill_table(position_table, 4);
+        for(unsigned int t = 0; t < seq_len; ++t)
+        {
+            positions[t] = t;
+        }
+
+        // Unfused gathers followed by the embedding sum
+        return reference::embedding_sum(reference::token_embedding(tokens, vocab),
+                                        reference::token_embedding(segments, segment_table),
+                                        reference::token_embedding(positions, position_table));
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    unsigned int    _d_segment{ 2U };
+    unsigned int    _d_position{ 512U };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGLAYERFIXTURE_H
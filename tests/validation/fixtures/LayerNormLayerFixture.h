@@ -0,0 +1,173 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/LayerNormLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LayerNormLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        const TensorShape shape(d_model, seq_len);
+        _target    = compute_target(shape, data_type);
+        _reference = compute_reference(shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo, float hi)
+    {
+        library->fill_tensor_uniform(tensor, i, lo, hi);
+    }
+
+    TensorType compute_target(const TensorShape &shape, DataType data_type)
+    {
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma = create_tensor<TensorType>(TensorShape(shape.x()), data_type);
+        TensorType beta  = create_tensor<TensorType>(TensorShape(shape.x()), data_type);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType layer_norm;
+        layer_norm.configure(&src, &gamma, &beta, &dst, LayerNormLayerInfo(0 /*Window::DimX*/, _epsilon));
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0, -2.f, 2.f);
+        fill(AccessorType(gamma), 1, 0.5f, 1.5f);
+        fill(AccessorType(beta), 2, -0.5f, 0.5f);
+
+        // Compute function
+        layer_norm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        SimpleTensor<T> gamma{ TensorShape(shape.x()), data_type };
+        SimpleTensor<T> beta{ TensorShape(shape.x()), data_type };
+
+        // Fill reference
+        fill(src, 0, -2.f, 2.f);
+        fill(gamma, 1, 0.5f, 1.5f);
+        fill(beta, 2, -0.5f, 0.5f);
+
+        return reference::layer_norm(src, gamma, beta, _epsilon);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    float           _epsilon{ 1e-12f };
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class AddLayerNormLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        const TensorShape shape(d_model, seq_len);
+        _target    = compute_target(shape, data_type);
+        _reference = compute_reference(shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo, float hi)
+    {
+        library->fill_tensor_uniform(tensor, i, lo, hi);
+    }
+
+    TensorType compute_target(const TensorShape &shape, DataType data_type)
+    {
+        // Create tensors
+        TensorType src0  = create_tensor<TensorType>(shape, data_type);
+        TensorType src1  = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma = create_tensor<TensorType>(TensorShape(shape.x()), data_type);
+        TensorType beta  = create_tensor<TensorType>(TensorShape(shape.x()), data_type);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType add_layer_norm;
+        add_layer_norm.configure(&src0, &src1, &gamma, &beta, &dst, LayerNormLayerInfo(0 /*Window::DimX*/, _epsilon));
+
+        ARM_COMPUTE_ASSERT(src0.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(src1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src0.allocator()->allocate();
+        src1.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src0), 0, -2.f, 2.f);
+        fill(AccessorType(src1), 1, -2.f, 2.f);
+        fill(AccessorType(gamma), 2, 0.5f, 1.5f);
+        fill(AccessorType(beta), 3, -0.5f, 0.5f);
+
+        // Compute function
+        add_layer_norm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src0{ shape, data_type };
+        SimpleTensor<T> src1{ shape, data_type };
+        SimpleTensor<T> gamma{ TensorShape(shape.x()), data_type };
+        SimpleTensor<T> beta{ TensorShape(shape.x()), data_type };
+
+        // Fill reference
+        fill(src0, 0, -2.f, 2.f);
+        fill(src1, 1, -2.f, 2.f);
+        fill(gamma, 2, 0.5f, 1.5f);
+        fill(beta, 3, -0.5f, 0.5f);
+
+        // Unfused residual add followed by the layer normalization
+        const SimpleTensor<T> sum = reference::arithmetic_operation<T>(reference::ArithmeticOperation::ADD, src0, src1, data_type, ConvertPolicy::SATURATE);
+        return reference::layer_norm(sum, gamma, beta, _epsilon);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    float           _epsilon{ 1e-12f };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMLAYERFIXTURE_H
@@ -0,0 +1,280 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LINEARLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LINEARLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/LinearLayer.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        const TensorShape src_shape(d_model, seq_len);
+        const TensorShape w_shape(d_model, d_model * expansion);
+        _target    = compute_target(src_shape, w_shape, data_type);
+        _reference = compute_reference(src_shape, w_shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float range)
+    {
+        library->fill_tensor_uniform(tensor, i, -range, range);
+    }
+
+    TensorType compute_target(const TensorShape &src_shape, const TensorShape &w_shape, DataType data_type)
+    {
+        const TensorShape b_shape(w_shape.y());
+        const TensorShape dst_shape(w_shape.y(), src_shape.y());
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(src_shape, data_type);
+        TensorType weights = create_tensor<TensorType>(w_shape, data_type);
+        TensorType bias    = create_tensor<TensorType>(b_shape, data_type);
+        TensorType dst     = create_tensor<TensorType>(dst_shape, data_type);
+
+        // Create and configure function
+        LinearLayerInfo info(w_shape.y(), w_shape, b_shape);
+        info.set_dynamic_int8(_dynamic_int8);
+        info.set_weight_only_quantization(_weight_only);
+        info.set_activation_info(_act_info);
+        info.set_approximate_gelu(_approximate_gelu);
+        info.set_fast_math(_fast_math);
+        FunctionType linear;
+        linear.configure(&src, &weights, _has_bias ? &bias : nullptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0, 1.f);
+        fill(AccessorType(weights), 1, 0.1f);
+        fill(AccessorType(bias), 2, 0.1f);
+
+        // Run twice, the second run reuses the weights reshaped by the first one
+        linear.run();
+        fill(AccessorType(src), 3, 1.f);
+        linear.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &w_shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ src_shape, data_type };
+        SimpleTensor<T> weights{ w_shape, data_type };
+        SimpleTensor<T> bias{ TensorShape(w_shape.y()), data_type };
+
+        // Fill reference
+        fill(src, 3, 1.f);
+        fill(weights, 1, 0.1f);
+        if(_has_bias)
+        {
+            fill(bias, 2, 0.1f);
+        }
+        else
+        {
+            std::fill_n(bias.data(), bias.num_elements(), T(0));
+        }
+
+        SimpleTensor<T> dst = reference::linear_layer(src, weights, bias);
+        return _act_info.enabled() ? reference::activation_layer(dst, _act_info) : dst;
+    }
+
+    TensorType             _target{};
+    SimpleTensor<T>        _reference{};
+    bool                   _dynamic_int8{false};
+    WeightOnlyQuantization _weight_only{WeightOnlyQuantization::NONE};
+    ActivationLayerInfo    _act_info{};
+    bool                   _approximate_gelu{false};
+    bool                   _has_bias{true};
+    bool                   _fast_math{false};
+};
+
+/** Runs the linear layer as a dynamically quantized int8 GEMM, the reference stays in float */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerDynamicInt8ValidationFixture : public LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, DataType data_type)
+    {
+        this->_dynamic_int8 = true;
+        LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(seq_len, d_model, heads, expansion, data_type);
+    }
+};
+
+/** Runs the linear layer with an activation fused into its output stage, the reference runs the activation separately */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerActivationValidationFixture : public LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, ActivationLayerInfo act_info, bool approximate_gelu, bool has_bias,
+               DataType data_type)
+    {
+        this->_act_info         = act_info;
+        this->_approximate_gelu = approximate_gelu;
+        this->_has_bias         = has_bias;
+        LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(seq_len, d_model, heads, expansion, data_type);
+    }
+};
+
+/** Lets the linear layer pick a BF16 GEMM on cores that have one, the reference stays in float */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerFastMathValidationFixture : public LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, DataType data_type)
+    {
+        this->_fast_math = true;
+        LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(seq_len, d_model, heads, expansion, data_type);
+    }
+};
+
+/** Runs the linear layer on weight-only quantized weights, the reference stays in float */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerWeightOnlyValidationFixture : public LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int expansion, WeightOnlyQuantization quantization, DataType data_type)
+    {
+        this->_weight_only = quantization;
+        LinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(seq_len, d_model, heads, expansion, data_type);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class AttentionLinearLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, bool fuse_qkv, bool has_bias, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        const TensorShape shape(d_model, seq_len);
+        _has_bias = has_bias;
+        compute_target(shape, fuse_qkv, data_type);
+        compute_reference(shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float range)
+    {
+        library->fill_tensor_uniform(tensor, i, -range, range);
+    }
+
+    void compute_target(const TensorShape &shape, bool fuse_qkv, DataType data_type)
+    {
+        const TensorShape w_shape(shape.x(), shape.x());
+        const TensorShape b_shape(shape.x());
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, data_type);
+        TensorType weights[3];
+        TensorType bias[3];
+        for(int i = 0; i < 3; ++i)
+        {
+            weights[i] = create_tensor<TensorType>(w_shape, data_type);
+            bias[i]    = create_tensor<TensorType>(b_shape, data_type);
+            _target[i] = create_tensor<TensorType>(shape, data_type);
+        }
+
+        // Create and configure function
+        LinearLayerInfo info(shape.x(), w_shape, b_shape, fuse_qkv);
+        info.set_dynamic_int8(_dynamic_int8);
+        FunctionType attention_linear;
+        TensorType *b[3];
+        for(int i = 0; i < 3; ++i)
+        {
+            b[i] = _has_bias ? &bias[i] : nullptr;
+        }
+        attention_linear.configure(&src, &weights[0], b[0], &src, &weights[1], b[1], &src, &weights[2], b[2],
+                                   &_target[0], &_target[1], &_target[2], info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        fill(AccessorType(src), 0, 1.f);
+        for(int i = 0; i < 3; ++i)
+        {
+            weights[i].allocator()->allocate();
+            bias[i].allocator()->allocate();
+            _target[i].allocator()->allocate();
+            fill(AccessorType(weights[i]), 1 + 2 * i, 0.1f);
+            fill(AccessorType(bias[i]), 2 + 2 * i, 0.1f);
+        }
+
+        // Compute function
+        attention_linear.run();
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        fill(src, 0, 1.f);
+        for(int i = 0; i < 3; ++i)
+        {
+            SimpleTensor<T> weights{ TensorShape(shape.x(), shape.x()), data_type };
+            SimpleTensor<T> bias{ TensorShape(shape.x()), data_type };
+            fill(weights, 1 + 2 * i, 0.1f);
+            if(_has_bias)
+            {
+                fill(bias, 2 + 2 * i, 0.1f);
+            }
+            else
+            {
+                std::fill_n(bias.data(), bias.num_elements(), T(0));
+            }
+            _reference[i] = reference::linear_layer(src, weights, bias);
+        }
+    }
+
+    /** Query, key and value projections */
+    TensorType      _target[3]{};
+    SimpleTensor<T> _reference[3]{};
+    bool            _dynamic_int8{false};
+    bool            _has_bias{true};
+};
+
+/** Runs the attention projections as dynamically quantized int8 GEMMs, the reference stays in float */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class AttentionLinearLayerDynamicInt8ValidationFixture
+    : public AttentionLinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, bool fuse_qkv, DataType data_type)
+    {
+        this->_dynamic_int8 = true;
+        AttentionLinearLayerValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(seq_len, d_model, heads, fuse_qkv, true, data_type);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LINEARLAYERFIXTURE_H
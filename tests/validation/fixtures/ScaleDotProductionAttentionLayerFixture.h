@@ -0,0 +1,91 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_SCALEDOTPRODUCTIONATTENTIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_SCALEDOTPRODUCTIONATTENTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ScaleDotProductionAttentionLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScaleDotProductionAttentionLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, bool is_masked, DataType data_type)
+    {
+        const TensorShape shape(d_model, seq_len);
+        _target    = compute_target(shape, heads, is_masked, data_type);
+        _reference = compute_reference(shape, heads, is_masked, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+    }
+
+    TensorType compute_target(const TensorShape &shape, unsigned int heads, bool is_masked, DataType data_type)
+    {
+        // Create tensors
+        TensorType query = create_tensor<TensorType>(shape, data_type);
+        TensorType key   = create_tensor<TensorType>(shape, data_type);
+        TensorType value = create_tensor<TensorType>(shape, data_type);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType attention;
+        attention.configure(&query, &key, &value, &dst, ScaleDotProductionLayerInfo(shape.x(), heads, is_masked), 0);
+
+        ARM_COMPUTE_ASSERT(query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(query), 0);
+        fill(AccessorType(key), 1);
+        fill(AccessorType(value), 2);
+
+        // Compute function
+        attention.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, unsigned int heads, bool is_masked, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> query{ shape, data_type };
+        SimpleTensor<T> key{ shape, data_type };
+        SimpleTensor<T> value{ shape, data_type };
+
+        // Fill reference
+        fill(query, 0);
+        fill(key, 1);
+        fill(value, 2);
+
+        return reference::scale_dot_production_attention(query, key, value, heads, is_masked);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_SCALEDOTPRODUCTIONATTENTIONLAYERFIXTURE_H
@@ -0,0 +1,136 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_TOPKPROJECTIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_TOPKPROJECTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LinearLayer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class TopKProjectionLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int seq_len, unsigned int d_model, unsigned int heads, unsigned int d_vocab, unsigned int k, bool explicit_rows, DataType data_type)
+    {
+        ARM_COMPUTE_UNUSED(heads);
+        // Out of order and repeated rows, an empty list projects the last row only
+        const std::vector<unsigned int> rows = explicit_rows ? std::vector<unsigned int>{ seq_len - 1, 0U, seq_len / 2, 0U } : std::vector<unsigned int>{};
+
+        const TensorShape             src_shape(d_model, seq_len);
+        const TensorShape             w_shape(d_model, d_vocab);
+        const TopKProjectionLayerInfo info(k, w_shape, TensorShape(d_vocab), rows);
+        _target    = compute_target(src_shape, data_type, info);
+        _reference = compute_reference(src_shape, data_type, info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float range)
+    {
+        library->fill_tensor_uniform(tensor, i, -range, range);
+    }
+
+    TensorType compute_target(const TensorShape &src_shape, DataType data_type, const TopKProjectionLayerInfo &info)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(src_shape, data_type);
+        TensorType weights = create_tensor<TensorType>(info.w_shape(), data_type);
+        TensorType bias    = create_tensor<TensorType>(info.b_shape(), data_type);
+        TensorType dst     = create_tensor<TensorType>(TensorShape(2U, info.k(), info.num_rows()), DataType::F32);
+
+        // Create and configure function
+        FunctionType topk;
+        topk.configure(&src, &weights, &bias, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0, 1.f);
+        fill(AccessorType(weights), 1, 0.1f);
+        fill(AccessorType(bias), 2, 0.1f);
+
+        // Compute function
+        topk.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &src_shape, DataType data_type, const TopKProjectionLayerInfo &info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ src_shape, data_type };
+        SimpleTensor<T> weights{ info.w_shape(), data_type };
+        SimpleTensor<T> bias{ info.b_shape(), data_type };
+
+        // Fill reference
+        fill(src, 0, 1.f);
+        fill(weights, 1, 0.1f);
+        fill(bias, 2, 0.1f);
+
+        // Scores are accumulated in F32 whatever T is, so the logits are computed from widened copies
+        const SimpleTensor<float> logits = reference::linear_layer(to_float(src), to_float(weights), to_float(bias));
+
+        const unsigned int d_vocab = info.w_shape().y();
+        const unsigned int k       = info.k();
+
+        SimpleTensor<float>   dst{ TensorShape(2U, k, info.num_rows()), DataType::F32 };
+        std::vector<uint32_t> ids(d_vocab);
+        for(unsigned int r = 0; r < info.num_rows(); ++r)
+        {
+            const unsigned int row    = info.rows().empty() ? src_shape.y() - 1 : info.rows()[r];
+            const float       *scores = logits.data() + row * d_vocab;
+
+            // Best score first, ties keep the lower id
+            std::iota(ids.begin(), ids.end(), 0U);
+            std::sort(ids.begin(), ids.end(), [&](uint32_t a, uint32_t b)
+            {
+                return scores[a] > scores[b] || (scores[a] == scores[b] && a < b);
+            });
+            for(unsigned int i = 0; i < k; ++i)
+            {
+                dst[(r * k + i) * 2]     = static_cast<float>(ids[i]);
+                dst[(r * k + i) * 2 + 1] = scores[ids[i]];
+            }
+        }
+        return dst;
+    }
+
+    static SimpleTensor<float> to_float(const SimpleTensor<T> &src)
+    {
+        SimpleTensor<float> dst{ src.shape(), DataType::F32 };
+        for(int i = 0; i < src.num_elements(); ++i)
+        {
+            dst[i] = static_cast<float>(src[i]);
+        }
+        return dst;
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_TOPKPROJECTIONLAYERFIXTURE_H
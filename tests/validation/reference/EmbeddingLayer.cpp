@@ -0,0 +1,47 @@
+#include "EmbeddingLayer.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> token_embedding(const SimpleTensor<uint32_t> &ids, const SimpleTensor<T> &vocab)
+{
+    const int d_model = vocab.shape()[0];
+    const int seq_len = ids.num_elements();
+
+    SimpleTensor<T> dst{ TensorShape(d_model, seq_len), vocab.data_type() };
+    for(int t = 0; t < seq_len; ++t)
+    {
+        ARM_COMPUTE_ERROR_ON(ids[t] >= vocab.shape()[1]);
+        const T *row = vocab.data() + ids[t] * d_model;
+        std::copy(row, row + d_model, dst.data() + t * d_model);
+    }
+    return dst;
+}
+
+template <typename T>
+SimpleTensor<T> embedding_sum(const SimpleTensor<T> &token, const SimpleTensor<T> &segment, const SimpleTensor<T> &position)
+{
+    SimpleTensor<T> dst{ token.shape(), token.data_type() };
+    for(int i = 0; i < token.num_elements(); ++i)
+    {
+        dst[i] = static_cast<T>(static_cast<float>(token[i]) + static_cast<float>(segment[i]) + static_cast<float>(position[i]));
+    }
+    return dst;
+}
+
+template SimpleTensor<float> token_embedding(const SimpleTensor<uint32_t> &ids, const SimpleTensor<float> &vocab);
+template SimpleTensor<half> token_embedding(const SimpleTensor<uint32_t> &ids, const SimpleTensor<half> &vocab);
+template SimpleTensor<float> embedding_sum(const SimpleTensor<float> &token, const SimpleTensor<float> &segment, const SimpleTensor<float> &position);
+template SimpleTensor<half> embedding_sum(const SimpleTensor<half> &token, const SimpleTensor<half> &segment, const SimpleTensor<half> &position);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
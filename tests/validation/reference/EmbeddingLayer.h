@@ -0,0 +1,26 @@
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGLAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGLAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Gathers the row of @p vocab, (d_model, d_vocab), of every id in @p ids, (seq_len). dst is (d_model, seq_len). */
+template <typename T>
+SimpleTensor<T> token_embedding(const SimpleTensor<uint32_t> &ids, const SimpleTensor<T> &vocab);
+
+/** Element-wise sum of the token, segment and position embeddings, all of the same shape */
+template <typename T>
+SimpleTensor<T> embedding_sum(const SimpleTensor<T> &token, const SimpleTensor<T> &segment, const SimpleTensor<T> &position);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGLAYER_H */
@@ -0,0 +1,55 @@
+#include "LayerNormLayer.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> layer_norm(const SimpleTensor<T> &src, const SimpleTensor<T> &gamma, const SimpleTensor<T> &beta, float epsilon)
+{
+    SimpleTensor<T> dst{ src.shape(), src.data_type() };
+
+    const int cols = src.shape()[0];
+    const int rows = src.num_elements() / cols;
+    for(int r = 0; r < rows; ++r)
+    {
+        const T *in  = src.data() + r * cols;
+        T       *out = dst.data() + r * cols;
+
+        // Two passes, unlike the single-pass accumulation of the kernel
+        float mean = 0.f;
+        for(int x = 0; x < cols; ++x)
+        {
+            mean += static_cast<float>(in[x]);
+        }
+        mean /= cols;
+
+        float var = 0.f;
+        for(int x = 0; x < cols; ++x)
+        {
+            const float diff = static_cast<float>(in[x]) - mean;
+            var += diff * diff;
+        }
+        var /= cols;
+
+        const float rstd = 1.f / std::sqrt(var + epsilon);
+        for(int x = 0; x < cols; ++x)
+        {
+            out[x] = static_cast<T>((static_cast<float>(in[x]) - mean) * rstd * static_cast<float>(gamma[x]) + static_cast<float>(beta[x]));
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> layer_norm(const SimpleTensor<float> &src, const SimpleTensor<float> &gamma, const SimpleTensor<float> &beta, float epsilon);
+template SimpleTensor<half> layer_norm(const SimpleTensor<half> &src, const SimpleTensor<half> &gamma, const SimpleTensor<half> &beta, float epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,25 @@
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMLAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMLAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Normalizes every row of @p src along the x axis, dst = (src - mean) / sqrt(var + epsilon) * gamma + beta
+ *
+ * @p gamma and @p beta hold one value per channel of the row.
+ */
+template <typename T>
+SimpleTensor<T> layer_norm(const SimpleTensor<T> &src, const SimpleTensor<T> &gamma, const SimpleTensor<T> &beta, float epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMLAYER_H */
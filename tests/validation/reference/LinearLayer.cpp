@@ -0,0 +1,44 @@
+#include "LinearLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> linear_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<T> &bias)
+{
+    const int k    = src.shape()[0];
+    const int n    = weights.shape()[1];
+    const int rows = src.num_elements() / k;
+
+    TensorShape dst_shape = src.shape();
+    dst_shape.set(0, n);
+    SimpleTensor<T> dst{ dst_shape, src.data_type() };
+
+    for(int r = 0; r < rows; ++r)
+    {
+        const T *in = src.data() + r * k;
+        for(int o = 0; o < n; ++o)
+        {
+            const T *w   = weights.data() + o * k;
+            float    acc = static_cast<float>(bias[o]);
+            for(int i = 0; i < k; ++i)
+            {
+                acc += static_cast<float>(in[i]) * static_cast<float>(w[i]);
+            }
+            dst[r * n + o] = static_cast<T>(acc);
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> linear_layer(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &bias);
+template SimpleTensor<half> linear_layer(const SimpleTensor<half> &src, const SimpleTensor<half> &weights, const SimpleTensor<half> &bias);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,26 @@
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_LINEARLAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_LINEARLAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** dst = src * weights^T + bias
+ *
+ * @p src is (in_features, rows), @p weights are stored as (in_features, out_features) and @p bias is (out_features).
+ * dst is (out_features, rows).
+ */
+template <typename T>
+SimpleTensor<T> linear_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<T> &bias);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_VALIDATION_REFERENCE_LINEARLAYER_H */
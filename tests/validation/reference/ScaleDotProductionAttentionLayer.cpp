@@ -0,0 +1,88 @@
+#include "ScaleDotProductionAttentionLayer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               unsigned int           num_heads,
+                                               bool                   is_masked)
+{
+    ARM_COMPUTE_ERROR_ON(num_heads == 0 || query.shape()[0] % num_heads != 0);
+
+    const int   d_model  = query.shape()[0];
+    const int   q_rows   = query.shape()[1];
+    const int   kv_rows  = key.shape()[1];
+    const int   head_dim = d_model / static_cast<int>(num_heads);
+    const float scale    = 1.f / std::sqrt(static_cast<float>(head_dim));
+
+    SimpleTensor<T>    dst{ query.shape(), query.data_type() };
+    std::vector<float> scores(kv_rows);
+
+    for(int h = 0; h < static_cast<int>(num_heads); ++h)
+    {
+        const int channel = h * head_dim;
+        for(int i = 0; i < q_rows; ++i)
+        {
+            const int visible = is_masked ? std::min(kv_rows, std::max(0, i + 1 + kv_rows - q_rows)) : kv_rows;
+
+            float max_score = -std::numeric_limits<float>::infinity();
+            for(int j = 0; j < visible; ++j)
+            {
+                float dot = 0.f;
+                for(int c = 0; c < head_dim; ++c)
+                {
+                    dot += static_cast<float>(query[i * d_model + channel + c]) * static_cast<float>(key[j * d_model + channel + c]);
+                }
+                scores[j] = dot * scale;
+                max_score = std::max(max_score, scores[j]);
+            }
+
+            float sum = 0.f;
+            for(int j = 0; j < visible; ++j)
+            {
+                scores[j] = std::exp(scores[j] - max_score);
+                sum += scores[j];
+            }
+
+            // A row without visible keys produces a zero context
+            for(int c = 0; c < head_dim; ++c)
+            {
+                float acc = 0.f;
+                for(int j = 0; j < visible; ++j)
+                {
+                    acc += scores[j] * static_cast<float>(value[j * d_model + channel + c]);
+                }
+                dst[i * d_model + channel + c] = static_cast<T>((visible > 0) ? acc / sum : 0.f);
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> scale_dot_production_attention(const SimpleTensor<float> &query,
+                                                            const SimpleTensor<float> &key,
+                                                            const SimpleTensor<float> &value,
+                                                            unsigned int               num_heads,
+                                                            bool                       is_masked);
+template SimpleTensor<half> scale_dot_production_attention(const SimpleTensor<half> &query,
+                                                           const SimpleTensor<half> &key,
+                                                           const SimpleTensor<half> &value,
+                                                           unsigned int              num_heads,
+                                                           bool                      is_masked);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
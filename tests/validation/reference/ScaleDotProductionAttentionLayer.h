@@ -0,0 +1,30 @@
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_SCALEDOTPRODUCTIONATTENTIONLAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_SCALEDOTPRODUCTIONATTENTIONLAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Multi-head scaled dot product attention, softmax(Q * K^T / sqrt(head_dim)) * V for every head
+ *
+ * @p query, @p key and @p value are (d_model, rows), head h owns the channels [h * head_dim, (h + 1) * head_dim).
+ * With @p is_masked query row i only attends to the key rows up to i + (key rows - query rows).
+ */
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               unsigned int           num_heads,
+                                               bool                   is_masked);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_VALIDATION_REFERENCE_SCALEDOTPRODUCTIONATTENTIONLAYER_H */
@@ -29,6 +29,7 @@
 
 #include "support/StringSupport.h"
 
+#include <algorithm>
 #include <map>
 
 using namespace arm_compute::graph;
@@ -68,6 +69,23 @@ std::pair<unsigned int, unsigned int> parse_validation_range(const std::string &
     }
     return range;
 }
+
+std::vector<unsigned int> parse_buckets(const std::string &buckets)
+{
+    std::vector<unsigned int> lengths;
+    std::string               str;
+    std::stringstream         stream(buckets);
+    while (std::getline(stream, str, ','))
+    {
+        if (!str.empty())
+        {
+            lengths.push_back(arm_compute::support::cpp11::stoi(str));
+        }
+    }
+    std::sort(lengths.begin(), lengths.end());
+    lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+    return lengths;
+}
 } // namespace
 
 namespace arm_compute
@@ -88,6 +106,22 @@ namespace utils
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "MLGO file : " << common_params.mlgo_file << std::endl;
+    os << "Placement cost file : " << common_params.placement_cost_file << std::endl;
+    os << "Packed weights dir : " << common_params.packed_weights_dir << std::endl;
+    os << "Dynamic int8 enabled? : " << (common_params.dynamic_int8 ? true_str : false_str) << std::endl;
+    os << "Weight-only bits : "
+       << (common_params.weight_only == WeightOnlyQuantization::INT8 ? 8 : common_params.weight_only == WeightOnlyQuantization::INT4 ? 4 : 0)
+       << std::endl;
+    os << "Weight group size : " << common_params.weight_group_size << std::endl;
+    os << "Approximate GELU? : " << (common_params.approximate_gelu ? true_str : false_str) << std::endl;
+    os << "Measure enabled? : " << (common_params.measure ? true_str : false_str) << std::endl;
+    os << "Generated tokens : " << common_params.generate << std::endl;
+    os << "Sequence buckets :";
+    for (auto bucket : common_params.buckets)
+    {
+        os << " " << bucket;
+    }
+    os << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str)
        << std::endl;
     if (!common_params.data_path.empty())
@@ -125,6 +159,10 @@ namespace utils
     {
         os << "Vocabulary file : " << common_params.vocabulary << std::endl;
     }
+    if(!common_params.merges.empty())
+    {
+        os << "Merges file : " << common_params.merges << std::endl;
+    }
     return os;
 }
 
@@ -147,12 +185,23 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
       tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
       mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file")),
+      placement_cost_file(parser.add_option<SimpleOption<std::string>>("placement-cost-file")),
+      packed_weights_dir(parser.add_option<SimpleOption<std::string>>("packed-weights-dir")),
+      dynamic_int8(parser.add_option<ToggleOption>("dynamic-int8")),
+      weight_only_bits(parser.add_option<SimpleOption<int>>("weight-only-bits", 0)),
+      weight_group_size(parser.add_option<SimpleOption<int>>("weight-group-size", 32)),
+      approximate_gelu(parser.add_option<ToggleOption>("approximate-gelu")),
 
       raw_output(parser.add_option<ToggleOption>("raw-output")),
       input_len(parser.add_option<SimpleOption<int>>("input_len")),
       text(parser.add_option<SimpleOption<std::string>>("text")),
       segment(parser.add_option<SimpleOption<std::string>>("segment")),
-      vocabulary(parser.add_option<SimpleOption<std::string>>("vocabulary"))
+      vocabulary(parser.add_option<SimpleOption<std::string>>("vocabulary")),
+      merges(parser.add_option<SimpleOption<std::string>>("merges")),
+      measure(parser.add_option<SimpleOption<int>>("measure", 0)),
+      measure_file(parser.add_option<SimpleOption<std::string>>("measure-file", "measure_output")),
+      generate(parser.add_option<SimpleOption<int>>("generate", 0)),
+      buckets(parser.add_option<SimpleOption<std::string>>("buckets"))
 {
     std::set<arm_compute::graph::Target> supported_targets{
         Target::NEON,
@@ -201,12 +250,23 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
     mlgo_file->set_help("File to load MLGO heuristics");
+    placement_cost_file->set_help("File to load per-node NEON/CL costs from, places nodes automatically when switching");
+    packed_weights_dir->set_help("Existing directory caching the reshaped NEON linear weights, later runs load them instead of reshaping");
+    dynamic_int8->set_help("Run the F32 NEON linear layers as int8 GEMMs, weights quantized per output channel and inputs per row");
+    weight_only_bits->set_help("Pack the F32 NEON linear weights to 8 or 4 bits with group-wise scales for the single-token decode steps, 0 disables it");
+    weight_group_size->set_help("Number of input features sharing a scale in the weight-only packed weights, a multiple of 16");
+    approximate_gelu->set_help("Compute the GELU fused into the NEON linear layers as 0.5x(1 + tanh(sqrt(2/pi)(x + 0.044715x^3)))");
 
     raw_output->set_help("Output raw data on output layer");
     input_len->set_help("Sentence token input length");
     text->set_help("Input text for the graph");
     segment->set_help("Input sentence segmentation");
     vocabulary->set_help("Path to vocabulary file for tex tokenization");
+    merges->set_help("Path to the BPE merges file, GPT-2 tokenizes with it and a vocab.json vocabulary");
+    measure->set_help("Profile every node when set to 1 and write <measure-file>.csv/.json after the run");
+    measure_file->set_help("Prefix of the profiling output files");
+    generate->set_help("Number of tokens to generate after the prompt with KV cache decoding, 0 runs the prompt only");
+    buckets->set_help("Comma separated sequence lengths (e.g. 16,32,64,128), one workload each sharing the weights. Inputs are padded to the nearest bucket");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -240,12 +300,34 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
     common_params.mlgo_file              = options.mlgo_file->value();
+    common_params.placement_cost_file    = options.placement_cost_file->value();
+    common_params.packed_weights_dir     = options.packed_weights_dir->value();
+    common_params.dynamic_int8           = options.dynamic_int8->is_set() ? options.dynamic_int8->value() : false;
+    switch(options.weight_only_bits->value())
+    {
+        case 8:
+            common_params.weight_only = WeightOnlyQuantization::INT8;
+            break;
+        case 4:
+            common_params.weight_only = WeightOnlyQuantization::INT4;
+            break;
+        default:
+            common_params.weight_only = WeightOnlyQuantization::NONE;
+            break;
+    }
+    common_params.weight_group_size      = static_cast<unsigned int>(options.weight_group_size->value());
+    common_params.approximate_gelu       = options.approximate_gelu->is_set() ? options.approximate_gelu->value() : false;
 
     common_params.raw_output             = options.raw_output->is_set() ? options.raw_output->value() : false;
     common_params.input_len              = options.input_len->value();
     common_params.text                   = options.text->value();
     common_params.segment                = options.segment->value();
     common_params.vocabulary             = options.vocabulary->value();
+    common_params.merges                 = options.merges->value();
+    common_params.measure                = options.measure->value() != 0;
+    common_params.measure_file           = options.measure_file->value();
+    common_params.generate               = options.generate->value();
+    common_params.buckets                = parse_buckets(options.buckets->value());
 
     return common_params;
 }
@@ -31,6 +31,8 @@
 #include "utils/command_line/CommandLineOptions.h"
 #include "utils/command_line/CommandLineParser.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace utils
@@ -109,6 +111,12 @@ struct CommonGraphParams
     std::string                      validation_path{};
     std::string                      tuner_file{};
     std::string                      mlgo_file{};
+    std::string                      placement_cost_file{};
+    std::string                      packed_weights_dir{};
+    bool                             dynamic_int8{false};
+    WeightOnlyQuantization           weight_only{WeightOnlyQuantization::NONE};
+    unsigned int                     weight_group_size{32};
+    bool                             approximate_gelu{false};
     unsigned int                     validation_range_start{0};
     unsigned int                     validation_range_end{std::numeric_limits<unsigned int>::max()};
 
@@ -116,7 +124,12 @@ struct CommonGraphParams
     std::string                      text{};
     std::string                      segment{};
     std::string                      vocabulary{};
+    std::string                      merges{};
     bool                             raw_output{false};
+    bool                             measure{false};
+    std::string                      measure_file{};
+    int                              generate{0};
+    std::vector<unsigned int>        buckets{};
 };
 
 /** Formatted output of the CommonGraphParams type
@@ -174,12 +187,23 @@ public:
     SimpleOption<std::string>              *validation_range; /**< Validation range */
     SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
     SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    SimpleOption<std::string>              *placement_cost_file; /**< File to load the per-node device costs from */
+    SimpleOption<std::string>              *packed_weights_dir; /**< Directory caching the reshaped weights */
+    ToggleOption                           *dynamic_int8;     /**< Run the linear layers as dynamically quantized int8 GEMMs */
+    SimpleOption<int>                      *weight_only_bits; /**< Bits of the weight-only quantized linear weights, 0 disables it */
+    SimpleOption<int>                      *weight_group_size; /**< Input features sharing a scale in the weight-only quantized weights */
+    ToggleOption                           *approximate_gelu; /**< Compute the fused GELU with the tanh approximation */
 
     ToggleOption                           *raw_output;       /**< Output raw data */
     SimpleOption<int>                      *input_len;        /**< Input length */
     SimpleOption<std::string>              *text;             /**< Text */
     SimpleOption<std::string>              *segment;          /**< segment */
     SimpleOption<std::string>              *vocabulary;       /**< Vocabulary */
+    SimpleOption<std::string>              *merges;           /**< BPE merges */
+    SimpleOption<int>                      *measure;          /**< Profile node execution */
+    SimpleOption<std::string>              *measure_file;     /**< Profile output file prefix */
+    SimpleOption<int>                      *generate;         /**< Tokens generated with KV cache decoding */
+    SimpleOption<std::string>              *buckets;          /**< Sequence length buckets */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -36,6 +36,7 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <fstream>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
@@ -784,13 +785,19 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
 }
 
 NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+    : _already_loaded(false),
+      _filename(std::move(filename)),
+      _file_layout(file_layout)
+#if !defined(_WIN64) && !defined(BARE_METAL)
+      ,
+      _mapping(nullptr)
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 {
 }
 
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
-    if (!_already_loaded)
+    if (!_already_loaded && !import_mapped(tensor))
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
@@ -801,6 +808,71 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     return _already_loaded;
 }
 
+bool NumPyBinLoader::import_mapped(ITensor &tensor)
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    // Only dense host tensors can adopt the mapped pages
+    auto              *host_tensor = dynamic_cast<arm_compute::Tensor *>(&tensor);
+    const ITensorInfo *info        = tensor.info();
+    if (host_tensor == nullptr || !info->padding().empty() || info->total_size() == 0 ||
+        (_file_layout != info->data_layout() && info->num_dimensions() > 2))
+    {
+        return false;
+    }
+
+    // The file data must already be laid out as the tensor expects it
+    size_t                     data_offset = 0;
+    std::vector<unsigned long> shape;
+    try
+    {
+        std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+        if (!fs.good())
+        {
+            return false;
+        }
+        const npy::header_t header = npy::parse_header(npy::read_header(fs));
+        if (header.fortran_order || header.dtype.str() != utils::get_typestring(info->data_type()))
+        {
+            return false;
+        }
+        data_offset = static_cast<size_t>(fs.tellg());
+        shape.assign(header.shape.rbegin(), header.shape.rend());
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    while (shape.size() > info->num_dimensions() && shape.back() == 1)
+    {
+        shape.pop_back();
+    }
+    if (shape.size() != info->num_dimensions() || data_offset % info->element_size() != 0)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        if (shape[i] != info->dimension(i))
+        {
+            return false;
+        }
+    }
+
+    auto mapping = std::make_unique<utils::mmap_io::MMappedFile>(_filename, 0, 0, true /* copy_on_write */);
+    if (!mapping->is_mapped() || mapping->map_size() < data_offset + info->total_size() ||
+        !bool(host_tensor->allocator()->import_memory(mapping->data() + data_offset)))
+    {
+        return false;
+    }
+    _mapping = std::move(mapping);
+    return true;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(tensor);
+    return false;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
 void atoiPreprocessor::preprocess(ITensor &tensor)
 {
     Window window;
@@ -815,7 +887,11 @@ void atoiPreprocessor::preprocess(ITensor &tensor)
 }
 
 TokenAccessor::TokenAccessor(std::string filename, std::string vocabname, std::unique_ptr<IPreprocessor> preprocessor)
-    : _already_loaded(false), _filename(std::move(filename)), _vocabname(std::move(vocabname)), _preprocessor(std::move(preprocessor))
+    : _already_loaded(false),
+      _filename(std::move(filename)),
+      _vocabname(std::move(vocabname)),
+      _preprocessor(std::move(preprocessor)),
+      _tokenizer(nullptr)
 {
 }
 
@@ -829,8 +905,12 @@ bool TokenAccessor::access_tensor(ITensor &tensor)
         // Open a text feeder from file (ifstream)
         textloader->open(_filename);
         
-        // Fill tensor with text
-        textloader->fill_token(tensor,_vocabname);
+        // Fill tensor with the token ids, the vocabulary is only loaded once
+        if(_tokenizer == nullptr)
+        {
+            _tokenizer = std::make_shared<utils::WordPieceTokenizer>(_vocabname);
+        }
+        textloader->fill_token(tensor, *_tokenizer);
 
         // Preprocess tensor
         if (_preprocessor)
@@ -843,6 +923,59 @@ bool TokenAccessor::access_tensor(ITensor &tensor)
     return _already_loaded;
 }
 
+BPETokenAccessor::BPETokenAccessor(std::string filename, std::shared_ptr<utils::BPETokenizer> tokenizer)
+    : _already_loaded(false), _filename(std::move(filename)), _tokenizer(std::move(tokenizer))
+{
+    ARM_COMPUTE_ERROR_ON(_tokenizer == nullptr);
+}
+
+bool BPETokenAccessor::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        auto textloader = utils::TextLoaderFactory::create(_filename);
+        ARM_COMPUTE_EXIT_ON_MSG(textloader == nullptr, "Unsupported Text type");
+
+        textloader->open(_filename);
+        textloader->fill_token(tensor, *_tokenizer);
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+PaddedIdsAccessor::PaddedIdsAccessor(const std::vector<unsigned int> &ids, unsigned int pad_id)
+    : _already_loaded(false), _ids(ids), _pad_id(pad_id)
+{
+}
+
+bool PaddedIdsAccessor::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        utils::fill_padded_ids(tensor, _ids, _pad_id);
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+PaddedBatchAccessor::PaddedBatchAccessor(const std::vector<std::vector<unsigned int>> &sequences, unsigned int pad_id)
+    : _already_loaded(false), _sequences(sequences), _pad_id(pad_id)
+{
+}
+
+bool PaddedBatchAccessor::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        utils::fill_padded_batch(tensor, _sequences, _pad_id);
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
 TextAccessor::TextAccessor(std::string filename, std::unique_ptr<IPreprocessor> preprocessor)
     : _already_loaded(false), _filename(std::move(filename)), _preprocessor(std::move(preprocessor))
 {
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/ITensorAccessor.h"
@@ -35,12 +36,19 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
 
 namespace arm_compute
 {
+namespace utils
+{
+class WordPieceTokenizer;
+class BPETokenizer;
+} // namespace utils
+
 namespace graph_utils
 {
 /** Preprocessor interface **/
@@ -434,7 +442,12 @@ private:
     std::random_device::result_type _seed;
 };
 
-/** Numpy Binary loader class*/
+/** Numpy Binary loader class
+ *
+ * When the file data already has the tensor's type, shape and layout, the file is mapped copy-on-write and the
+ * mapped pages become the backing memory of the host tensor, so the weights are never copied to the heap. The
+ * mapping lives as long as the loader. Other tensors are filled with one streaming copy.
+ */
 class NumPyBinLoader final : public graph::ITensorAccessor
 {
 public:
@@ -451,9 +464,15 @@ public:
     bool access_tensor(ITensor &tensor) override;
 
 private:
+    /** Imports the mapped file data as the memory of @p tensor, returns false if it has to be copied instead */
+    bool import_mapped(ITensor &tensor);
+
     bool              _already_loaded;
     const std::string _filename;
     const DataLayout  _file_layout;
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    std::unique_ptr<utils::mmap_io::MMappedFile> _mapping;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 };
 
 /** Generates appropriate random accessor
@@ -640,6 +659,8 @@ class TokenAccessor final : public graph::ITensorAccessor
 {
 public:
     /** Constructor
+     *
+     * The vocabulary is loaded on the first access and kept for the next ones.
      *
      * @param[in] filename     Path to text file
      * @param[in] vocabname    Path to vocabulary file
@@ -653,10 +674,11 @@ public:
     bool access_tensor(ITensor &tensor) override;
 
 private:
-    bool                           _already_loaded;
-    const std::string              _filename;
-    const std::string              _vocabname;
-    std::unique_ptr<IPreprocessor> _preprocessor;
+    bool                                             _already_loaded;
+    const std::string                                _filename;
+    const std::string                                _vocabname;
+    std::unique_ptr<IPreprocessor>                   _preprocessor;
+    std::shared_ptr<const utils::WordPieceTokenizer> _tokenizer;
 };
 
 /** Generates appropriate token accessor according to the specified graph parameters
@@ -686,6 +708,105 @@ get_token_accessor(const arm_compute::utils::CommonGraphParams &graph_parameters
     }
 }
 
+/** GPT-2 token accessor class
+ *
+ * Tokenizes a text file with a byte-level BPE tokenizer on every run. No [CLS]/[SEP] is added, the ids are zero padded
+ * up to the tensor length and only they are marked valid.
+ */
+class BPETokenAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] filename  Path to text file
+     * @param[in] tokenizer Tokenizer loaded once, may be shared with other accessors
+     */
+    BPETokenAccessor(std::string filename, std::shared_ptr<utils::BPETokenizer> tokenizer);
+    /** Allow instances of this class to be move constructed */
+    BPETokenAccessor(BPETokenAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool                                 _already_loaded;
+    const std::string                    _filename;
+    std::shared_ptr<utils::BPETokenizer> _tokenizer;
+};
+
+/** Generates a GPT-2 token accessor according to the specified graph parameters
+ *
+ * @param[in] graph_parameters Graph parameters
+ * @param[in] tokenizer        Byte-level BPE tokenizer
+ *
+ * @return An appropriate tensor accessor
+ */
+inline std::unique_ptr<graph::ITensorAccessor>
+get_bpe_token_accessor(const arm_compute::utils::CommonGraphParams &graph_parameters,
+                       std::shared_ptr<utils::BPETokenizer>          tokenizer)
+{
+    if (!graph_parameters.validation_file.empty())
+    {
+        return std::make_unique<DummyAccessor>();
+    }
+    else
+    {
+        return std::make_unique<BPETokenAccessor>(lower_string(graph_parameters.text), std::move(tokenizer));
+    }
+}
+
+/** Padded ids accessor class
+ *
+ * Feeds ids prepared outside the graph, e.g. a tokenized request dispatched to a sequence length bucket. The ids are
+ * padded up to the tensor length and only they are marked valid.
+ */
+class PaddedIdsAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] ids    Ids to feed, read on every run
+     * @param[in] pad_id (Optional) Id written past the last id
+     */
+    PaddedIdsAccessor(const std::vector<unsigned int> &ids, unsigned int pad_id = 0U);
+    /** Allow instances of this class to be move constructed */
+    PaddedIdsAccessor(PaddedIdsAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool                             _already_loaded;
+    const std::vector<unsigned int> &_ids;
+    unsigned int                     _pad_id;
+};
+
+/** Padded batch accessor class
+ *
+ * Feeds a batch of sequences prepared outside the graph into ids shaped (max_len, batch), one padded sequence per
+ * column. The valid lengths reach the attention layers through the graph's @ref graph::SequenceBatch.
+ */
+class PaddedBatchAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] sequences Ids of each sequence, read on every run
+     * @param[in] pad_id    (Optional) Id written past the last id of a sequence
+     */
+    PaddedBatchAccessor(const std::vector<std::vector<unsigned int>> &sequences, unsigned int pad_id = 0U);
+    /** Allow instances of this class to be move constructed */
+    PaddedBatchAccessor(PaddedBatchAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool                                          _already_loaded;
+    const std::vector<std::vector<unsigned int>> &_sequences;
+    unsigned int                                  _pad_id;
+};
+
 /** Text accessor class */
 class TextAccessor final : public graph::ITensorAccessor
 {
@@ -8,9 +8,11 @@
 
 #include "utils/Utils.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -66,6 +68,56 @@ class FileTextFeeder : public ITextDataFeeder
     std::ifstream &_fs;
 };
 
+/** Write ids at the start of a 1D tensor and pad the rest of it
+ *
+ * Only the written ids are marked valid, so the layers reading the tensor can ignore the padding. Ids past the
+ * tensor length are dropped.
+ *
+ * @param[in,out] tensor Tensor of 32-bit ids to fill (Must be allocated).
+ * @param[in]     ids    Ids to write
+ * @param[in]     pad_id (Optional) Id written past the last id
+ */
+template <typename T>
+void fill_padded_ids(T &tensor, const std::vector<unsigned int> &ids, unsigned int pad_id = 0U)
+{
+    const size_t length = tensor.info()->tensor_shape().x();
+    const size_t valid  = std::min(length, ids.size());
+    for(size_t i = 0; i < length; ++i)
+    {
+        *reinterpret_cast<unsigned int *>(tensor.ptr_to_element(Coordinates(i))) = (i < valid) ? ids[i] : pad_id;
+    }
+
+    ValidRegion valid_region = tensor.info()->valid_region();
+    valid_region.shape.set(0, valid, false);
+    tensor.info()->set_valid_region(valid_region);
+}
+
+/** Write one padded sequence of ids per column of a (max_len, batch) tensor
+ *
+ * The whole tensor stays valid, the sequence lengths are handed to the graph separately. Missing sequences are all
+ * padding, ids past the tensor length are dropped.
+ *
+ * @param[in,out] tensor    Tensor of 32-bit ids to fill (Must be allocated).
+ * @param[in]     sequences Ids of each sequence
+ * @param[in]     pad_id    (Optional) Id written past the last id of a sequence
+ */
+template <typename T>
+void fill_padded_batch(T &tensor, const std::vector<std::vector<unsigned int>> &sequences, unsigned int pad_id = 0U)
+{
+    const size_t length     = tensor.info()->tensor_shape().x();
+    const size_t batch_size = tensor.info()->tensor_shape().y();
+    for(size_t b = 0; b < batch_size; ++b)
+    {
+        const std::vector<unsigned int> *ids = (b < sequences.size()) ? &sequences[b] : nullptr;
+        for(size_t i = 0; i < length; ++i)
+        {
+            *reinterpret_cast<unsigned int *>(tensor.ptr_to_element(Coordinates(i, b))) =
+                (ids != nullptr && i < ids->size()) ? (*ids)[i] : pad_id;
+        }
+    }
+    tensor.info()->set_valid_region(ValidRegion(Coordinates(), tensor.info()->tensor_shape()));
+}
+
 /** Text Loader Interface */
 class ITextLoader
 {
@@ -138,77 +190,161 @@ class ITextLoader
             ARM_COMPUTE_ERROR_VAR("Loading text file: %s", e.what());
         }
     }
-    /** Fill an text tensor with the content of the currently open text file.
+    /** Fill a 1D token tensor with the ids of the currently open text file.
+     *
+     * The ids are written straight into the tensor. Ids past the tensor length are dropped, the rest of the tensor is
+     * padded with 0 and only the written ids are marked valid, like @ref fill_padded_ids.
+     *
+     * @param[in,out] tensor    Token tensor of 32-bit ids to fill (Must be allocated).
+     * @param[in]     tokenizer Tokenizer holding the vocabulary
+     */
+    template <typename T>
+    void fill_token(T &tensor, const WordPieceTokenizer &tokenizer)
+    {
+        fill_encoded(tensor, [&](const std::basic_string<char> &text, unsigned int *ids, size_t capacity)
+                     { return tokenizer.encode(text.data(), text.size(), ids, capacity); });
+    }
+    /** Fill a 1D token tensor with the GPT-2 ids of the currently open text file, see @ref fill_token
+     *
+     * @param[in,out] tensor    Token tensor of 32-bit ids to fill (Must be allocated).
+     * @param[in]     tokenizer Byte-level BPE tokenizer
+     */
+    template <typename T>
+    void fill_token(T &tensor, BPETokenizer &tokenizer)
+    {
+        fill_encoded(tensor, [&](const std::basic_string<char> &text, unsigned int *ids, size_t capacity)
+                     { return tokenizer.encode(text.data(), text.size(), ids, capacity); });
+    }
+    /** Fill a token tensor with the ids of the currently open text file, loading the vocabulary first
      *
-     * @param[in,out] tensor Text tensor to fill (Must be allocated, and of matching dimensions with the opened text file).
+     * @param[in,out] tensor    Token tensor to fill (Must be allocated).
+     * @param[in]     vocabname Path to the vocabulary file
      */
     template <typename T>
     void fill_token(T &tensor, const std::string &vocabname)
+    {
+        fill_token(tensor, WordPieceTokenizer(vocabname));
+    }
+    /** Tokenize the currently open text file
+     *
+     * @param[in] tokenizer Tokenizer holding the vocabulary
+     *
+     * @return The token ids, [CLS] and [SEP] included
+     */
+    std::vector<unsigned int> read_token_ids(const WordPieceTokenizer &tokenizer)
+    {
+        return tokenizer.encode(read_all());
+    }
+    /** Tokenize the currently open text file, loading the vocabulary first
+     *
+     * @param[in] vocabname Path to the vocabulary file
+     *
+     * @return The token ids, [CLS] and [SEP] included
+     */
+    std::vector<unsigned int> read_token_ids(const std::string &vocabname)
+    {
+        return read_token_ids(WordPieceTokenizer(vocabname));
+    }
+    /** Tokenize every non-empty line of the currently open text file as its own sequence, e.g. a batch of queries
+     *
+     * @param[in] tokenizer Tokenizer holding the vocabulary
+     *
+     * @return The token ids of each line, [CLS] and [SEP] included
+     */
+    std::vector<std::vector<unsigned int>> read_token_id_lines(const WordPieceTokenizer &tokenizer)
+    {
+        std::vector<std::vector<unsigned int>> sequences;
+
+        const std::basic_string<char> text = read_all();
+        for(size_t begin = 0; begin < text.size();)
+        {
+            size_t end = text.find('\n', begin);
+            end        = (end == std::basic_string<char>::npos) ? text.size() : end;
+            if(text.find_first_not_of(" \t\r", begin) < end)
+            {
+                sequences.push_back(tokenizer.encode(text.substr(begin, end - begin)));
+            }
+            begin = end + 1;
+        }
+        return sequences;
+    }
+    /** Tokenize every non-empty line of the currently open text file, loading the vocabulary first
+     *
+     * @param[in] vocabname Path to the vocabulary file
+     *
+     * @return The token ids of each line, [CLS] and [SEP] included
+     */
+    std::vector<std::vector<unsigned int>> read_token_id_lines(const std::string &vocabname)
+    {
+        return read_token_id_lines(WordPieceTokenizer(vocabname));
+    }
+    /** Read the currently open text file as one id per digit, e.g. segment ids
+     *
+     * @return The ids, characters other than digits are skipped
+     */
+    std::vector<unsigned int> read_digit_ids()
     {
         ARM_COMPUTE_ERROR_ON(!is_open());
         ARM_COMPUTE_ERROR_ON(_feeder.get() == nullptr);
 
-        /* read input from text data feeder */
+        std::vector<unsigned int> ids;
         try
         {
-            // Readin text file
-            std::basic_string<char> buffer;
             for(unsigned int i = 0; i < _length; i++)
             {
-                buffer += _feeder->get();
-            }
-
-            const char start_token[] = u8"[CLS]";
-            const char end_token[]   = u8"[SEP]";
-
-            /** Sepreate into tokens and look up vocab list */
-            std::map<std::basic_string<char>, int> token2id = utils::get_token2id(vocabname);
-            std::vector<unsigned int>              text_ids;
-            std::vector<std::basic_string<char>>   tokens_vec;
-
-            /* Split the text into words */
-            std::basic_string<char> pat = R"([[:punct:]]|[[:alpha:]]+|[[:digit:]]+)";
-            std::regex              re(pat);
-            std::smatch             m;
-
-            while(std::regex_search(buffer, m, re))
-            {
-                for(std::basic_string<char> x : m)
+                const char c = static_cast<char>(_feeder->get());
+                if(c >= '0' && c <= '9')
                 {
-                    tokens_vec.push_back(x);
+                    ids.push_back(static_cast<unsigned int>(c - '0'));
                 }
-                buffer = m.suffix();
             }
+        }
+        catch(const std::ifstream::failure &e)
+        {
+            ARM_COMPUTE_ERROR_VAR("Loading text file: %s", e.what());
+        }
+        return ids;
+    }
 
-            // [CLS]
-            text_ids.push_back(token2id[start_token]);
+    protected:
+    /** Encode the rest of the currently open text file straight into a 1D tensor of 32-bit ids, zero padded */
+    template <typename T, typename Encoder>
+    void fill_encoded(T &tensor, Encoder &&encode)
+    {
+        ARM_COMPUTE_ERROR_ON(tensor.info()->element_size() != sizeof(unsigned int));
 
-            // Input content
-            utils::find_longest_matching<char>(tokens_vec, token2id, text_ids);
+        const std::basic_string<char> text   = read_all();
+        const size_t                  length = tensor.info()->tensor_shape().x();
+        auto *ids = reinterpret_cast<unsigned int *>(tensor.buffer() + tensor.info()->offset_first_element_in_bytes());
 
-            // [SEP]
-            text_ids.push_back(token2id[end_token]);
+        const size_t valid = encode(text, ids, length);
+        std::fill(ids + valid, ids + length, 0U);
 
-            Window window;
-            window.set(Window::DimX, Window::Dimension(0, tensor.info()->tensor_shape().x(), 1));
-            Iterator out(&tensor, window);
-            int      i = 0;
-            execute_window_loop(
-                window,
-                [&](const Coordinates &)
-                {
-                    *reinterpret_cast<unsigned int *>(out.ptr()) = text_ids[i];
-                    i++;
-                },
-                out);
+        ValidRegion valid_region = tensor.info()->valid_region();
+        valid_region.shape.set(0, valid, false);
+        tensor.info()->set_valid_region(valid_region);
+    }
+    /** Read the rest of the currently open text file */
+    std::basic_string<char> read_all()
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        ARM_COMPUTE_ERROR_ON(_feeder.get() == nullptr);
+
+        std::basic_string<char> buffer;
+        buffer.reserve(_length);
+        try
+        {
+            for(unsigned int i = 0; i < _length; i++)
+            {
+                buffer += _feeder->get();
+            }
         }
         catch(const std::ifstream::failure &e)
         {
             ARM_COMPUTE_ERROR_VAR("Loading text file: %s", e.what());
         }
+        return buffer;
     }
-
-    protected:
     std::unique_ptr<ITextDataFeeder> _feeder;
     unsigned int                     _length;
 };
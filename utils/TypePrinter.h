@@ -1737,6 +1737,40 @@ inline std::string to_string(const ConvertPolicy &policy)
     return str.str();
 }
 
+/** Formatted output of the WeightOnlyQuantization type.
+ *
+ * @param[out] os           Output stream.
+ * @param[in]  quantization Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const WeightOnlyQuantization &quantization)
+{
+    switch (quantization)
+    {
+        case WeightOnlyQuantization::NONE:
+            os << "NONE";
+            break;
+        case WeightOnlyQuantization::INT8:
+            os << "INT8";
+            break;
+        case WeightOnlyQuantization::INT4:
+            os << "INT4";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+inline std::string to_string(const WeightOnlyQuantization &quantization)
+{
+    std::stringstream str;
+    str << quantization;
+    return str.str();
+}
+
 /** Formatted output of the ArithmeticOperation type.
  *
  * @param[out] os Output stream.
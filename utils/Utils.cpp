@@ -28,9 +28,15 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <algorithm>
 #include <cctype>
 #include <cerrno>
+#include <functional>
 #include <iomanip>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <sstream>
 #include <string>
 
 #pragma GCC diagnostic push
@@ -335,5 +341,672 @@ std::map<std::string,int> get_token2id(std::string path_vocab)
 
     return token2id;
 }
+
+namespace
+{
+/** Longest word matched piece by piece, longer words become [UNK] like in the reference tokenizer */
+constexpr size_t max_wordpiece_chars = 100;
+
+/** Node of the trie the double array is built from */
+struct TrieNode
+{
+    std::vector<std::pair<unsigned char, int32_t>> children{};
+    int32_t                                        value{-1};
+};
+
+int32_t trie_child(std::vector<TrieNode> &nodes, int32_t node, unsigned char c)
+{
+    for(const auto &child : nodes[node].children)
+    {
+        if(child.first == c)
+        {
+            return child.second;
+        }
+    }
+    nodes.emplace_back();
+    const int32_t child = static_cast<int32_t>(nodes.size() - 1);
+    nodes[node].children.emplace_back(c, child);
+    return child;
+}
+
+enum class CharClass
+{
+    Space,
+    Punct,
+    Alpha,
+    Digit
+};
+
+CharClass char_class(char c)
+{
+    const int uc = static_cast<unsigned char>(c);
+    if(std::isalpha(uc))
+    {
+        return CharClass::Alpha;
+    }
+    if(std::isdigit(uc))
+    {
+        return CharClass::Digit;
+    }
+    return std::ispunct(uc) ? CharClass::Punct : CharClass::Space;
+}
+} // namespace
+
+WordPieceTokenizer::WordPieceTokenizer(const std::string &path_vocab)
+    : _base(), _check(), _value(), _continuation(-1), _cls(0), _sep(0), _unk(-1)
+{
+    std::ifstream fs(path_vocab);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Cannot open vocabulary %s", path_vocab.c_str());
+
+    std::vector<TrieNode> nodes(1);
+    std::string           line;
+    for(int index = 0; std::getline(fs, line); ++index)
+    {
+        std::istringstream fields(line);
+        std::string        token;
+        int                id = index;
+        if(!(fields >> token))
+        {
+            continue;
+        }
+        fields >> id;
+
+        int32_t node = 0;
+        for(char c : token)
+        {
+            node = trie_child(nodes, node, static_cast<unsigned char>(c));
+        }
+        nodes[node].value = id;
+    }
+
+    // Place the children of every node at base + code + 1, breadth first, first fit
+    std::vector<bool>    used(1, true);
+    std::vector<int32_t> position(nodes.size(), -1);
+    std::vector<int32_t> queue{0};
+    size_t               first_free = 1;
+    position[0]                     = 0;
+    _base.assign(1, 0);
+    _check.assign(1, -1);
+    _value.assign(1, nodes[0].value);
+    for(size_t q = 0; q < queue.size(); ++q)
+    {
+        auto &node = nodes[queue[q]];
+        if(node.children.empty())
+        {
+            continue;
+        }
+        std::sort(node.children.begin(), node.children.end());
+
+        while(first_free < used.size() && used[first_free])
+        {
+            ++first_free;
+        }
+        const int32_t min_code = node.children.front().first + 1;
+        int32_t       base     = std::max<int32_t>(1, static_cast<int32_t>(first_free) - min_code);
+        for(bool fits = false; !fits; base += fits ? 0 : 1)
+        {
+            fits = true;
+            for(const auto &child : node.children)
+            {
+                const size_t slot = base + child.first + 1;
+                if(slot < used.size() && used[slot])
+                {
+                    fits = false;
+                    break;
+                }
+            }
+        }
+
+        const int32_t state = position[queue[q]];
+        _base[state]        = base;
+        const size_t size   = base + node.children.back().first + 2;
+        if(size > used.size())
+        {
+            used.resize(size, false);
+            _base.resize(size, 0);
+            _check.resize(size, -1);
+            _value.resize(size, -1);
+        }
+        for(const auto &child : node.children)
+        {
+            const int32_t slot = base + child.first + 1;
+            used[slot]         = true;
+            _check[slot]       = state;
+            _value[slot]       = nodes[child.second].value;
+            position[child.second] = slot;
+            queue.push_back(child.second);
+        }
+    }
+
+    // Continuation pieces are matched from the state after their "##" prefix
+    _continuation = next(next(0, '#'), '#');
+
+    const int cls = find(u8"[CLS]");
+    const int sep = find(u8"[SEP]");
+    _cls          = static_cast<unsigned int>(std::max(cls, 0));
+    _sep          = static_cast<unsigned int>(std::max(sep, 0));
+    _unk          = find(u8"[UNK]");
+}
+
+int32_t WordPieceTokenizer::next(int32_t state, unsigned char c) const
+{
+    if(state < 0)
+    {
+        return -1;
+    }
+    const size_t slot = static_cast<size_t>(_base[state]) + c + 1;
+    return (_base[state] > 0 && slot < _check.size() && _check[slot] == state) ? static_cast<int32_t>(slot) : -1;
+}
+
+int WordPieceTokenizer::find(const std::string &token) const
+{
+    int32_t state = 0;
+    for(char c : token)
+    {
+        state = next(state, static_cast<unsigned char>(c));
+    }
+    return (state < 0) ? -1 : _value[state];
+}
+
+size_t WordPieceTokenizer::encode(const char *text, size_t length, unsigned int *ids, size_t capacity) const
+{
+    size_t count = 0;
+    auto   emit  = [&](unsigned int id)
+    {
+        if(count < capacity)
+        {
+            ids[count] = id;
+        }
+        ++count;
+    };
+
+    emit(_cls);
+    for(size_t begin = 0; begin < length;)
+    {
+        const CharClass cls = char_class(text[begin]);
+        if(cls == CharClass::Space)
+        {
+            ++begin;
+            continue;
+        }
+
+        // A punctuation mark is a word on its own, letters and digits run until the class changes
+        size_t end = begin + 1;
+        if(cls != CharClass::Punct)
+        {
+            while(end < length && char_class(text[end]) == cls)
+            {
+                ++end;
+            }
+        }
+
+        const size_t word_start = count;
+        bool         matched    = (end - begin) <= max_wordpiece_chars;
+        for(size_t pos = begin; matched && pos < end;)
+        {
+            // Longest piece from pos, walking the trie once
+            int32_t state   = (pos == begin) ? 0 : _continuation;
+            int32_t best_id = -1;
+            size_t  best_end = pos;
+            for(size_t i = pos; i < end && state >= 0; ++i)
+            {
+                state = next(state, static_cast<unsigned char>(text[i]));
+                if(state >= 0 && _value[state] >= 0)
+                {
+                    best_id  = _value[state];
+                    best_end = i + 1;
+                }
+            }
+
+            matched = best_id >= 0;
+            if(matched)
+            {
+                emit(static_cast<unsigned int>(best_id));
+                pos = best_end;
+            }
+        }
+
+        if(!matched)
+        {
+            count = word_start;
+            if(_unk >= 0)
+            {
+                emit(static_cast<unsigned int>(_unk));
+            }
+        }
+        begin = end;
+    }
+    emit(_sep);
+
+    return std::min(count, capacity);
+}
+
+std::vector<unsigned int> WordPieceTokenizer::encode(const std::string &text) const
+{
+    // Every piece holds at least one character
+    std::vector<unsigned int> ids(text.size() + 2);
+    ids.resize(encode(text.data(), text.size(), ids.data(), ids.size()));
+    return ids;
+}
+
+namespace
+{
+/** Code point GPT-2 maps each byte to, printable bytes map to themselves */
+std::array<uint32_t, 256> byte_code_points()
+{
+    std::array<uint32_t, 256> code_points{};
+    uint32_t                  shifted = 256;
+    for(uint32_t b = 0; b < 256; ++b)
+    {
+        const bool printable = (b >= '!' && b <= '~') || (b >= 0xA1 && b <= 0xAC) || (b >= 0xAE);
+        code_points[b]       = printable ? b : shifted++;
+    }
+    return code_points;
+}
+
+/** Raw bytes of a byte-level token written as UTF-8, e.g. "\xC4\xA0the" (Ġthe) is " the" */
+bool token_bytes(const std::string &token, const std::unordered_map<uint32_t, char> &code_point_bytes, std::string &bytes)
+{
+    bytes.clear();
+    for(size_t i = 0; i < token.size();)
+    {
+        const auto lead = static_cast<unsigned char>(token[i]);
+        size_t     len  = (lead < 0x80) ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : 4;
+        uint32_t   cp   = (len == 1) ? lead : lead & (0x3F >> (len - 1));
+        if(i + len > token.size())
+        {
+            return false;
+        }
+        for(size_t k = 1; k < len; ++k)
+        {
+            cp = (cp << 6) | (static_cast<unsigned char>(token[i + k]) & 0x3F);
+        }
+        const auto b = code_point_bytes.find(cp);
+        if(b == code_point_bytes.end())
+        {
+            return false;
+        }
+        bytes += b->second;
+        i += len;
+    }
+    return true;
+}
+
+void append_utf8(std::string &dst, uint32_t cp)
+{
+    if(cp < 0x80)
+    {
+        dst += static_cast<char>(cp);
+    }
+    else if(cp < 0x800)
+    {
+        dst += static_cast<char>(0xC0 | (cp >> 6));
+        dst += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else if(cp < 0x10000)
+    {
+        dst += static_cast<char>(0xE0 | (cp >> 12));
+        dst += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        dst += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else
+    {
+        dst += static_cast<char>(0xF0 | (cp >> 18));
+        dst += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        dst += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        dst += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+/** Reads the JSON object of string keys to integer values of vocab.json */
+std::vector<std::pair<std::string, int>> read_json_vocab(const std::string &path)
+{
+    std::ifstream fs(path, std::ios::in | std::ios::binary);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Cannot open vocabulary %s", path.c_str());
+    const std::string json((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+
+    std::vector<std::pair<std::string, int>> vocab;
+    size_t                                   i    = 0;
+    auto                                     skip = [&]()
+    {
+        while(i < json.size() && std::isspace(static_cast<unsigned char>(json[i])))
+        {
+            ++i;
+        }
+    };
+    auto expect = [&](char c)
+    {
+        skip();
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(i >= json.size() || json[i] != c, "Malformed vocabulary %s at %zu", path.c_str(), i);
+        ++i;
+    };
+
+    expect('{');
+    skip();
+    while(i < json.size() && json[i] != '}')
+    {
+        expect('"');
+        std::string key;
+        while(i < json.size() && json[i] != '"')
+        {
+            char c = json[i++];
+            if(c != '\\')
+            {
+                key += c;
+                continue;
+            }
+            ARM_COMPUTE_EXIT_ON_MSG_VAR(i >= json.size(), "Malformed vocabulary %s", path.c_str());
+            c = json[i++];
+            switch(c)
+            {
+                case 'b':
+                    key += '\b';
+                    break;
+                case 'f':
+                    key += '\f';
+                    break;
+                case 'n':
+                    key += '\n';
+                    break;
+                case 'r':
+                    key += '\r';
+                    break;
+                case 't':
+                    key += '\t';
+                    break;
+                case 'u':
+                {
+                    ARM_COMPUTE_EXIT_ON_MSG_VAR(i + 4 > json.size(), "Malformed vocabulary %s", path.c_str());
+                    uint32_t cp = std::stoul(json.substr(i, 4), nullptr, 16);
+                    i += 4;
+                    // Surrogate pair
+                    if(cp >= 0xD800 && cp < 0xDC00 && i + 6 <= json.size() && json[i] == '\\' && json[i + 1] == 'u')
+                    {
+                        const uint32_t low = std::stoul(json.substr(i + 2, 4), nullptr, 16);
+                        cp                 = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                    append_utf8(key, cp);
+                    break;
+                }
+                default:
+                    key += c;
+                    break;
+            }
+        }
+        expect('"');
+        expect(':');
+        skip();
+        size_t     end = i;
+        const long id  = std::strtol(json.c_str() + i, nullptr, 10);
+        while(end < json.size() && (json[end] == '-' || std::isdigit(static_cast<unsigned char>(json[end]))))
+        {
+            ++end;
+        }
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(end == i, "Malformed vocabulary %s at %zu", path.c_str(), i);
+        i = end;
+        vocab.emplace_back(std::move(key), static_cast<int>(id));
+
+        skip();
+        if(i < json.size() && json[i] == ',')
+        {
+            ++i;
+            skip();
+        }
+    }
+    expect('}');
+    return vocab;
+}
+
+bool is_space_byte(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/** Letters, digits and other symbols of the GPT-2 pre-tokenizer, non-ASCII bytes count as letters */
+CharClass bpe_char_class(char c)
+{
+    const int uc = static_cast<unsigned char>(c);
+    if(is_space_byte(c))
+    {
+        return CharClass::Space;
+    }
+    if(uc >= 0x80 || std::isalpha(uc))
+    {
+        return CharClass::Alpha;
+    }
+    return std::isdigit(uc) ? CharClass::Digit : CharClass::Punct;
+}
+
+/** Length of the contraction ('s, 't, 're, 've, 'm, 'll, 'd) at @p text, 0 if there is none */
+size_t contraction_length(const char *text, size_t length)
+{
+    if(length < 2 || text[0] != '\'')
+    {
+        return 0;
+    }
+    const char c = text[1];
+    if(c == 's' || c == 't' || c == 'm' || c == 'd')
+    {
+        return 2;
+    }
+    if(length >= 3 && ((c == 'r' && text[2] == 'e') || (c == 'v' && text[2] == 'e') || (c == 'l' && text[2] == 'l')))
+    {
+        return 3;
+    }
+    return 0;
+}
+} // namespace
+
+BPETokenizer::BPETokenizer(const std::string &path_vocab, const std::string &path_merges, size_t cache_size)
+    : _id2bytes(), _byte_ids(), _merges(), _cache_size(std::max<size_t>(cache_size, 1)), _lru(), _cache()
+{
+    const std::array<uint32_t, 256> code_points = byte_code_points();
+    std::unordered_map<uint32_t, char> code_point_bytes;
+    for(uint32_t b = 0; b < 256; ++b)
+    {
+        code_point_bytes[code_points[b]] = static_cast<char>(b);
+    }
+
+    // Tokens are keyed by their raw bytes from here on
+    std::unordered_map<std::string, uint32_t> token2id;
+    std::string                               bytes;
+    for(const auto &entry : read_json_vocab(path_vocab))
+    {
+        if(entry.second < 0 || !token_bytes(entry.first, code_point_bytes, bytes))
+        {
+            continue;
+        }
+        const auto id = static_cast<uint32_t>(entry.second);
+        if(_id2bytes.size() <= id)
+        {
+            _id2bytes.resize(id + 1);
+        }
+        _id2bytes[id]   = bytes;
+        token2id[bytes] = id;
+    }
+
+    for(uint32_t b = 0; b < 256; ++b)
+    {
+        const auto it = token2id.find(std::string(1, static_cast<char>(b)));
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(it == token2id.end(), "Vocabulary %s misses byte %u", path_vocab.c_str(), b);
+        _byte_ids[b] = it->second;
+    }
+
+    std::ifstream fs(path_merges, std::ios::in | std::ios::binary);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Cannot open merges %s", path_merges.c_str());
+    std::string line;
+    std::string left;
+    std::string right;
+    int32_t     rank = 0;
+    while(std::getline(fs, line))
+    {
+        if(line.compare(0, 8, "#version") == 0)
+        {
+            continue;
+        }
+        const size_t split = line.find(' ');
+        if(split == std::string::npos || !token_bytes(line.substr(0, split), code_point_bytes, left) ||
+           !token_bytes(line.substr(split + 1, line.find_last_not_of("\r") - split), code_point_bytes, right))
+        {
+            continue;
+        }
+
+        const auto l = token2id.find(left);
+        const auto r = token2id.find(right);
+        const auto m = token2id.find(left + right);
+        if(l != token2id.end() && r != token2id.end() && m != token2id.end())
+        {
+            const uint64_t key = (static_cast<uint64_t>(l->second) << 32) | r->second;
+            _merges.emplace(key, Merge{rank, m->second});
+        }
+        ++rank;
+    }
+}
+
+const std::vector<unsigned int> &BPETokenizer::encode_word(const char *word, size_t length)
+{
+    std::string key(word, length);
+    const auto  hit = _cache.find(key);
+    if(hit != _cache.end())
+    {
+        _lru.splice(_lru.begin(), _lru, hit->second);
+        return hit->second->second;
+    }
+
+    // Symbols form a linked list, merged ones are unlinked and marked dead
+    constexpr uint32_t   dead = std::numeric_limits<uint32_t>::max();
+    const int32_t        n    = static_cast<int32_t>(length);
+    std::vector<uint32_t> symbol(n);
+    std::vector<int32_t> prev(n);
+    std::vector<int32_t> next(n);
+    for(int32_t i = 0; i < n; ++i)
+    {
+        symbol[i] = _byte_ids[static_cast<unsigned char>(word[i])];
+        prev[i]   = i - 1;
+        next[i]   = (i + 1 < n) ? i + 1 : -1;
+    }
+
+    // Candidate merges ordered by rank then position: (rank, left position, left id, right id)
+    using Candidate = std::tuple<int32_t, int32_t, uint32_t, uint32_t>;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+    auto push = [&](int32_t l)
+    {
+        if(l < 0 || next[l] < 0)
+        {
+            return;
+        }
+        const auto merge = _merges.find((static_cast<uint64_t>(symbol[l]) << 32) | symbol[next[l]]);
+        if(merge != _merges.end())
+        {
+            queue.emplace(merge->second.rank, l, symbol[l], symbol[next[l]]);
+        }
+    };
+    for(int32_t i = 0; i < n; ++i)
+    {
+        push(i);
+    }
+
+    while(!queue.empty())
+    {
+        const Candidate candidate = queue.top();
+        queue.pop();
+
+        // Skip candidates whose symbols were merged since they were queued
+        const int32_t l = std::get<1>(candidate);
+        const int32_t r = next[l];
+        if(symbol[l] == dead || r < 0 || symbol[l] != std::get<2>(candidate) || symbol[r] != std::get<3>(candidate))
+        {
+            continue;
+        }
+
+        symbol[l] = _merges.at((static_cast<uint64_t>(symbol[l]) << 32) | symbol[r]).id;
+        symbol[r] = dead;
+        next[l]   = next[r];
+        if(next[r] >= 0)
+        {
+            prev[next[r]] = l;
+        }
+        push(prev[l]);
+        push(l);
+    }
+
+    std::vector<unsigned int> ids;
+    for(int32_t i = 0; i >= 0 && i < n; i = next[i])
+    {
+        ids.push_back(symbol[i]);
+    }
+
+    _lru.emplace_front(std::move(key), std::move(ids));
+    _cache[_lru.front().first] = _lru.begin();
+    if(_lru.size() > _cache_size)
+    {
+        _cache.erase(_lru.back().first);
+        _lru.pop_back();
+    }
+    return _lru.front().second;
+}
+
+size_t BPETokenizer::encode(const char *text, size_t length, unsigned int *ids, size_t capacity)
+{
+    size_t count = 0;
+    for(size_t begin = 0; begin < length;)
+    {
+        size_t end = begin + contraction_length(text + begin, length - begin);
+        if(end == begin)
+        {
+            // A space only prefixes the run that follows it
+            size_t first = begin;
+            if(text[first] == ' ' && first + 1 < length && !is_space_byte(text[first + 1]))
+            {
+                ++first;
+            }
+
+            const CharClass cls = bpe_char_class(text[first]);
+            end                 = first + 1;
+            while(end < length && bpe_char_class(text[end]) == cls)
+            {
+                ++end;
+            }
+            // A whitespace run leaves its last character to the word that follows it
+            if(cls == CharClass::Space && end < length && end - begin > 1)
+            {
+                --end;
+            }
+        }
+
+        for(unsigned int id : encode_word(text + begin, end - begin))
+        {
+            if(count < capacity)
+            {
+                ids[count] = id;
+            }
+            ++count;
+        }
+        begin = end;
+    }
+    return std::min(count, capacity);
+}
+
+std::vector<unsigned int> BPETokenizer::encode(const std::string &text)
+{
+    // Every token holds at least one byte
+    std::vector<unsigned int> ids(text.size());
+    ids.resize(encode(text.data(), text.size(), ids.data(), ids.size()));
+    return ids;
+}
+
+std::string BPETokenizer::decode(const std::vector<unsigned int> &ids) const
+{
+    std::string text;
+    for(unsigned int id : ids)
+    {
+        if(id < _id2bytes.size())
+        {
+            text += _id2bytes[id];
+        }
+    }
+    return text;
+}
 } // namespace utils
 } // namespace arm_compute
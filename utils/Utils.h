@@ -45,14 +45,17 @@
 #include "arm_compute/runtime/CL/CLTensor.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <array>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <list>
 #include <memory>
 #include <random>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace arm_compute
@@ -941,6 +944,118 @@ void find_longest_matching(std::vector<std::basic_string<T>>   &tokens_vec,
     }
 }
 
+/** WordPiece tokenizer over a vocabulary loaded once
+ *
+ * The vocabulary is held in a double-array trie, continuation pieces under their "##" prefix. Text is split into
+ * punctuation marks, runs of letters and runs of digits, then each word is matched greedily with the longest piece,
+ * one trie walk per piece and no allocation per token. A word that cannot be fully matched becomes [UNK].
+ */
+class WordPieceTokenizer final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] path_vocab Vocabulary file, one "token id" pair per line. Lines holding only a token get their line
+     *                       index as id.
+     */
+    explicit WordPieceTokenizer(const std::string &path_vocab);
+    /** Id of a vocabulary token
+     *
+     * @param[in] token Token to look up
+     *
+     * @return The id, -1 if @p token is not in the vocabulary
+     */
+    int find(const std::string &token) const;
+    /** Tokenize a text between [CLS] and [SEP]
+     *
+     * @param[in]  text     Text to tokenize
+     * @param[in]  length   Length of @p text in bytes
+     * @param[out] ids      Destination of the ids
+     * @param[in]  capacity Number of ids @p ids can hold, the ids past it are dropped
+     *
+     * @return Number of ids written
+     */
+    size_t encode(const char *text, size_t length, unsigned int *ids, size_t capacity) const;
+    /** Tokenize a text between [CLS] and [SEP]
+     *
+     * @param[in] text Text to tokenize
+     *
+     * @return The token ids
+     */
+    std::vector<unsigned int> encode(const std::string &text) const;
+
+private:
+    int32_t next(int32_t state, unsigned char c) const;
+
+    std::vector<int32_t> _base;
+    std::vector<int32_t> _check;
+    std::vector<int32_t> _value;
+    int32_t              _continuation;
+    unsigned int         _cls;
+    unsigned int         _sep;
+    int                  _unk;
+};
+/** GPT-2 byte-level BPE tokenizer over a vocabulary and merges loaded once
+ *
+ * Text is split like the GPT-2 pre-tokenizer: contractions, runs of letters, digits or other symbols with an optional
+ * leading space, and whitespace. Every byte of a word starts as its own vocabulary symbol, then the merges are applied
+ * lowest rank first through a priority queue. Merge ranks are keyed by pairs of vocabulary ids, so no string is built
+ * while merging. The ids of the most recently encoded words are kept in an LRU cache.
+ *
+ * @note Bytes of non-ASCII characters are treated as letters.
+ */
+class BPETokenizer final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] path_vocab  Vocabulary file, the vocab.json object of token to id
+     * @param[in] path_merges Merges file, one "left right" pair per line in rank order
+     * @param[in] cache_size  (Optional) Number of encoded words kept
+     */
+    BPETokenizer(const std::string &path_vocab, const std::string &path_merges, size_t cache_size = 4096);
+    /** Tokenize a text, no token is added around it
+     *
+     * @param[in]  text     Text to tokenize
+     * @param[in]  length   Length of @p text in bytes
+     * @param[out] ids      Destination of the ids
+     * @param[in]  capacity Number of ids @p ids can hold, the ids past it are dropped
+     *
+     * @return Number of ids written
+     */
+    size_t encode(const char *text, size_t length, unsigned int *ids, size_t capacity);
+    /** Tokenize a text, no token is added around it
+     *
+     * @param[in] text Text to tokenize
+     *
+     * @return The token ids
+     */
+    std::vector<unsigned int> encode(const std::string &text);
+    /** Text of a sequence of ids, unknown ids are skipped
+     *
+     * @param[in] ids Token ids
+     *
+     * @return The decoded bytes
+     */
+    std::string decode(const std::vector<unsigned int> &ids) const;
+
+private:
+    struct Merge
+    {
+        int32_t  rank;
+        uint32_t id;
+    };
+    using CacheEntry = std::pair<std::string, std::vector<unsigned int>>;
+
+    const std::vector<unsigned int> &encode_word(const char *word, size_t length);
+
+    std::vector<std::string>                                         _id2bytes;
+    std::array<uint32_t, 256>                                        _byte_ids;
+    std::unordered_map<uint64_t, Merge>                              _merges;
+    size_t                                                           _cache_size;
+    std::list<CacheEntry>                                            _lru;
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> _cache;
+};
 } // namespace utils
 } // namespace arm_compute
 #endif /* __UTILS_UTILS_H__*/